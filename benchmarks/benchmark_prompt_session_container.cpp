@@ -0,0 +1,128 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/server/scene/prompt_session_container.h"
+#include "mir/test/doubles/stub_session.h"
+#include "mir/test/doubles/null_prompt_session.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace ms = mir::scene;
+namespace mtd = mir::test::doubles;
+
+using ParticipantType = ms::PromptSessionContainer::ParticipantType;
+
+namespace
+{
+template<typename Duration>
+auto ns(Duration duration) -> long long
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        std::cout<<"Usage: "<<argv[0]<<" <number of applications> <focus change count>"<<std::endl;
+        exit(1);
+    }
+
+    int const application_count = std::atoi(argv[1]);
+    uint64_t const focus_changes = std::atoll(argv[2]);
+    int const providers_per_prompt = 2;
+
+    // Like a phone: one launcher (the helper) has a prompt session open for each application it
+    // started, each with a couple of prompt providers (e.g. an input method and an account picker)
+    auto const launcher = std::make_shared<mtd::StubSession>();
+    std::vector<std::shared_ptr<ms::Session>> applications;
+    std::vector<std::shared_ptr<ms::Session>> providers;
+    std::vector<std::shared_ptr<ms::PromptSession>> prompt_sessions;
+
+    for (int i = 0; i < application_count; ++i)
+    {
+        applications.push_back(std::make_shared<mtd::StubSession>());
+        prompt_sessions.push_back(std::make_shared<mtd::NullPromptSession>());
+        for (int j = 0; j < providers_per_prompt; ++j)
+            providers.push_back(std::make_shared<mtd::StubSession>());
+    }
+
+    ms::PromptSessionContainer container;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < application_count; ++i)
+    {
+        auto const prompt_session = prompt_sessions[i].get();
+        container.insert_prompt_session(prompt_sessions[i]);
+        container.insert_participant(prompt_session, launcher, ParticipantType::helper);
+        container.insert_participant(prompt_session, applications[i], ParticipantType::application);
+        for (int j = 0; j < providers_per_prompt; ++j)
+            container.insert_participant(prompt_session, providers[i * providers_per_prompt + j], ParticipantType::prompt_provider);
+    }
+
+    auto const insert_duration = std::chrono::steady_clock::now() - start;
+
+    // Each focus change asks which prompt sessions the newly focused application takes part in,
+    // and who else participates in them
+    uint64_t visited = 0;
+    std::vector<std::shared_ptr<ms::PromptSession>> focused_prompt_sessions;
+    start = std::chrono::steady_clock::now();
+
+    for (uint64_t i = 0; i < focus_changes; ++i)
+    {
+        auto const& focused = applications[i % application_count];
+
+        focused_prompt_sessions.clear();
+        container.for_each_prompt_session_with_participant(
+            focused,
+            ParticipantType::application,
+            [&](std::shared_ptr<ms::PromptSession> const& prompt_session)
+            {
+                focused_prompt_sessions.push_back(prompt_session);
+            });
+
+        for (auto const& prompt_session : focused_prompt_sessions)
+        {
+            container.for_each_participant_in_prompt_session(
+                prompt_session.get(),
+                [&](std::weak_ptr<ms::Session> const&, ParticipantType) { ++visited; });
+        }
+    }
+
+    auto const lookup_duration = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < application_count; ++i)
+    {
+        for (int j = 0; j < providers_per_prompt; ++j)
+            container.remove_participant(prompt_sessions[i].get(), providers[i * providers_per_prompt + j], ParticipantType::prompt_provider);
+        container.remove_prompt_session(prompt_sessions[i]);
+    }
+
+    auto const remove_duration = std::chrono::steady_clock::now() - start;
+
+    std::cout<<"Starting "<<application_count<<" prompt sessions took "<<ns(insert_duration)<<"ns"<<std::endl;
+    std::cout<<focus_changes<<" focus changes took "<<ns(lookup_duration)<<"ns ("<<visited<<" participants visited)"<<std::endl;
+    std::cout<<"Stopping "<<application_count<<" prompt sessions took "<<ns(remove_duration)<<"ns"<<std::endl;
+    exit(0);
+}
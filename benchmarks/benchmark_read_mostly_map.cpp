@@ -0,0 +1,133 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/client/read_mostly_map.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace mcl = mir::client;
+
+namespace
+{
+struct Buffer
+{
+    int id;
+};
+
+// The locking scheme ConnectionSurfaceMap used before it moved to ReadMostlyMap
+class SharedMutexMap
+{
+public:
+    auto find(int key) const -> std::shared_ptr<Buffer>
+    {
+        std::shared_lock<decltype(guard)> lk(guard);
+        auto const found = map.find(key);
+        return found != map.end() ? found->second : nullptr;
+    }
+
+    void insert(int key, std::shared_ptr<Buffer> const& value)
+    {
+        std::lock_guard<decltype(guard)> lk(guard);
+        map[key] = value;
+    }
+
+    void erase(int key)
+    {
+        std::lock_guard<decltype(guard)> lk(guard);
+        map.erase(key);
+    }
+
+private:
+    std::shared_timed_mutex mutable guard;
+    std::unordered_map<int, std::shared_ptr<Buffer>> map;
+};
+
+/// Each reader thread stands in for a thread receiving buffer events; one writer allocates and frees buffers
+template<typename Map>
+auto run(Map& map, int reader_count, uint64_t lookups_per_reader, int buffer_count) -> std::chrono::nanoseconds
+{
+    for (int i = 0; i < buffer_count; ++i)
+        map.insert(i, std::make_shared<Buffer>(Buffer{i}));
+
+    std::atomic<bool> done{false};
+    std::thread writer{[&]
+        {
+            int next = buffer_count;
+            while (!done)
+            {
+                map.insert(next, std::make_shared<Buffer>(Buffer{next}));
+                map.erase(next - buffer_count);
+                ++next;
+                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            }
+        }};
+
+    auto const start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < reader_count; ++i)
+    {
+        readers.emplace_back([&, i]
+            {
+                for (uint64_t lookup = 0; lookup < lookups_per_reader; ++lookup)
+                    map.find((i + lookup) % buffer_count);
+            });
+    }
+
+    for (auto& reader : readers)
+        reader.join();
+
+    auto const duration = std::chrono::steady_clock::now() - start;
+
+    done = true;
+    writer.join();
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration);
+}
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        std::cout<<"Usage: "<<argv[0]<<" <number of reader threads> <lookups per thread>"<<std::endl;
+        exit(1);
+    }
+
+    int const reader_count = std::atoi(argv[1]);
+    uint64_t const lookups = std::atoll(argv[2]);
+    int const buffer_count = 16;
+
+    SharedMutexMap shared_mutex_map;
+    auto const shared_mutex_duration = run(shared_mutex_map, reader_count, lookups, buffer_count);
+
+    mcl::ReadMostlyMap<int, std::shared_ptr<Buffer>> read_mostly_map;
+    auto const read_mostly_duration = run(read_mostly_map, reader_count, lookups, buffer_count);
+
+    std::cout<<reader_count<<" threads doing "<<lookups<<" lookups each took "
+             <<shared_mutex_duration.count()<<"ns with a shared mutex and "
+             <<read_mostly_duration.count()<<"ns with ReadMostlyMap"<<std::endl;
+    exit(0);
+}
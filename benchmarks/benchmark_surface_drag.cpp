@@ -0,0 +1,234 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/server/scene/basic_surface.h"
+#include "src/server/compositor/stream.h"
+#include "src/server/report/null_report_factory.h"
+#include "src/server/frontend_wayland/null_event_sink.h"
+#include "mir/scene/null_surface_observer.h"
+#include "mir/scene/surface_event_source.h"
+#include "mir/scene/output_properties_cache.h"
+#include "mir/geometry/rectangle.h"
+#include "mir/time/alarm_factory.h"
+#include "mir/lockable_callback.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace ms = mir::scene;
+namespace mf = mir::frontend;
+namespace mc = mir::compositor;
+namespace geom = mir::geometry;
+
+namespace
+{
+class CountingObserver : public ms::NullSurfaceObserver
+{
+public:
+    CountingObserver(std::atomic<uint64_t>& notifications)
+        : notifications{notifications}
+    {
+    }
+
+    void moved_to(ms::Surface const*, geom::Point const&) override
+    {
+        ++notifications;
+    }
+
+    void content_resized_to(ms::Surface const*, geom::Size const&) override
+    {
+        ++notifications;
+    }
+
+private:
+    std::atomic<uint64_t>& notifications;
+};
+
+/// Alarms that fire when the benchmark says a frame is up, rather than in real time
+class FrameAlarmFactory : public mir::time::AlarmFactory
+{
+public:
+    std::unique_ptr<mir::time::Alarm> create_alarm(std::function<void()> const& callback) override
+    {
+        return std::make_unique<FrameAlarm>(*this, callback);
+    }
+
+    std::unique_ptr<mir::time::Alarm> create_alarm(std::unique_ptr<mir::LockableCallback> callback) override
+    {
+        std::shared_ptr<mir::LockableCallback> const shared_callback{std::move(callback)};
+        return create_alarm([shared_callback]
+            {
+                shared_callback->lock();
+                (*shared_callback)();
+                shared_callback->unlock();
+            });
+    }
+
+    void end_frame()
+    {
+        auto const due = std::move(scheduled);
+        scheduled.clear();
+        for (auto const alarm : due)
+            alarm->fire();
+    }
+
+private:
+    class FrameAlarm : public mir::time::Alarm
+    {
+    public:
+        FrameAlarm(FrameAlarmFactory& factory, std::function<void()> const& callback)
+            : factory{factory},
+              callback{callback}
+        {
+        }
+
+        ~FrameAlarm()
+        {
+            cancel();
+        }
+
+        bool cancel() override
+        {
+            auto& scheduled = factory.scheduled;
+            auto const i = std::find(scheduled.begin(), scheduled.end(), this);
+            if (i == scheduled.end())
+                return false;
+            scheduled.erase(i);
+            current_state = cancelled;
+            return true;
+        }
+
+        State state() const override
+        {
+            return current_state;
+        }
+
+        bool reschedule_in(std::chrono::milliseconds) override
+        {
+            auto const superseded = cancel();
+            factory.scheduled.push_back(this);
+            current_state = pending;
+            return superseded;
+        }
+
+        bool reschedule_for(mir::time::Timestamp) override
+        {
+            return reschedule_in({});
+        }
+
+        void fire()
+        {
+            current_state = triggered;
+            callback();
+        }
+
+    private:
+        FrameAlarmFactory& factory;
+        std::function<void()> const callback;
+        State current_state{cancelled};
+    };
+
+    std::vector<FrameAlarm*> scheduled;
+};
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        std::cout<<"Usage: "<<argv[0]<<" <number of observers> <pointer motion count>"<<std::endl;
+        exit(1);
+    }
+
+    int const observer_count = std::atoi(argv[1]);
+    uint64_t const motion_count = std::atoll(argv[2]);
+
+    geom::Size const size{640, 480};
+    FrameAlarmFactory frames;
+    ms::BasicSurface surface{
+        nullptr,
+        "dragged",
+        geom::Rectangle{{0, 0}, size},
+        std::shared_ptr<ms::Surface>{},
+        mir_pointer_unconfined,
+        {{std::make_shared<mc::Stream>(size, mir_pixel_format_argb_8888), {}, {}}},
+        nullptr,
+        mir::report::null_scene_report(),
+        frames};
+
+    // Half of the observers stand in for the legacy frontend, the rest for anything else watching the window
+    ms::OutputPropertiesCache outputs;
+    std::atomic<uint64_t> notifications{0};
+    std::vector<std::shared_ptr<ms::SurfaceObserver>> observers;
+    for (int i = 0; i < observer_count; ++i)
+    {
+        if (i % 2)
+        {
+            observers.push_back(std::make_shared<CountingObserver>(notifications));
+        }
+        else
+        {
+            observers.push_back(std::make_shared<ms::SurfaceEventSource>(
+                mf::SurfaceId{i}, outputs, std::make_shared<mf::NullEventSink>()));
+        }
+        surface.add_observer(observers.back());
+    }
+
+    // A high resolution mouse reports several motions per pixel travelled; an interactive move
+    // follows each of them, and an interactive resize grows the window along with it
+    auto const motions_per_pixel = 4;
+    // A 1000Hz mouse against a 60Hz display
+    auto const motions_per_frame = 16;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint64_t i = 0; i < motion_count; ++i)
+    {
+        int const travelled = i / motions_per_pixel;
+        surface.move_to({travelled, travelled});
+
+        if (i % motions_per_frame == motions_per_frame - 1)
+            frames.end_frame();
+    }
+    frames.end_frame();
+
+    auto const move_duration = std::chrono::steady_clock::now() - start;
+    auto const move_notifications = notifications.exchange(0);
+
+    start = std::chrono::steady_clock::now();
+
+    for (uint64_t i = 0; i < motion_count; ++i)
+    {
+        int const travelled = i / motions_per_pixel;
+        surface.resize({640 + travelled, 480 + travelled});
+    }
+
+    auto const resize_duration = std::chrono::steady_clock::now() - start;
+    auto const resize_notifications = notifications.exchange(0);
+
+    std::cout<<"Dragging a window with "<<observer_count<<" observers through "<<motion_count<<" motions took "
+             <<std::chrono::duration_cast<std::chrono::nanoseconds>(move_duration).count()<<"ns ("
+             <<move_notifications<<" notifications)"<<std::endl;
+    std::cout<<"Resizing a window with "<<observer_count<<" observers through "<<motion_count<<" motions took "
+             <<std::chrono::duration_cast<std::chrono::nanoseconds>(resize_duration).count()<<"ns ("
+             <<resize_notifications<<" notifications)"<<std::endl;
+    exit(0);
+}
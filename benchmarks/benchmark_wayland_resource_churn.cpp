@@ -0,0 +1,119 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// A synthetic Wayland client that creates and destroys short-lived objects (regions and frame callbacks) as
+// quickly as the server will process them, in the way a busy browser does. Run it against a server to measure
+// the cost of the server's per-object allocation.
+
+#include <wayland-client.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+struct Globals
+{
+    wl_compositor* compositor{nullptr};
+};
+
+void handle_global(void* data, wl_registry* registry, uint32_t id, char const* interface, uint32_t version)
+{
+    auto const globals = static_cast<Globals*>(data);
+    if (strcmp(interface, wl_compositor_interface.name) == 0)
+    {
+        globals->compositor = static_cast<wl_compositor*>(
+            wl_registry_bind(registry, id, &wl_compositor_interface, std::min(version, 4u)));
+    }
+}
+
+void handle_global_remove(void*, wl_registry*, uint32_t)
+{
+}
+
+wl_registry_listener const registry_listener{handle_global, handle_global_remove};
+
+int const objects_per_batch{100};
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 2)
+    {
+        std::cout<<"Usage: "<<argv[0]<<" <number of batches of "<<objects_per_batch<<" regions and callbacks>"<<std::endl;
+        exit(1);
+    }
+
+    int const batch_count = std::atoi(argv[1]);
+
+    auto const display = wl_display_connect(nullptr);
+    if (!display)
+    {
+        std::cerr<<"Failed to connect to Wayland server (is WAYLAND_DISPLAY set?)"<<std::endl;
+        exit(1);
+    }
+
+    Globals globals;
+    auto const registry = wl_display_get_registry(display);
+    wl_registry_add_listener(registry, &registry_listener, &globals);
+    wl_display_roundtrip(display);
+
+    if (!globals.compositor)
+    {
+        std::cerr<<"Server does not support wl_compositor"<<std::endl;
+        exit(1);
+    }
+
+    auto const start = std::chrono::steady_clock::now();
+
+    for (auto batch = 0; batch != batch_count; ++batch)
+    {
+        for (auto i = 0; i != objects_per_batch; ++i)
+        {
+            auto const region = wl_compositor_create_region(globals.compositor);
+            wl_region_add(region, 0, 0, 64, 64);
+            wl_region_destroy(region);
+        }
+
+        // Frame callbacks pending on a surface are released along with it
+        auto const surface = wl_compositor_create_surface(globals.compositor);
+        for (auto i = 0; i != objects_per_batch; ++i)
+        {
+            wl_callback_destroy(wl_surface_frame(surface));
+        }
+        wl_surface_commit(surface);
+        wl_surface_destroy(surface);
+
+        if (wl_display_roundtrip(display) < 0)
+        {
+            std::cerr<<"Lost connection to Wayland server"<<std::endl;
+            exit(1);
+        }
+    }
+
+    std::chrono::duration<double> const duration = std::chrono::steady_clock::now() - start;
+    auto const object_count = 2.0 * batch_count * objects_per_batch;
+
+    std::cout<<"Created and destroyed "<<object_count<<" objects in "<<duration.count()<<"s ("
+             <<object_count / duration.count()<<" per second)"<<std::endl;
+
+    wl_compositor_destroy(globals.compositor);
+    wl_registry_destroy(registry);
+    wl_display_disconnect(display);
+}
@@ -77,6 +77,7 @@ void set_modifier(MirEvent& event, MirInputEventModifiers modifiers);
 void set_cursor_position(MirEvent& event, mir::geometry::Point const& pos);
 void set_cursor_position(MirEvent& event, float x, float y);
 void set_button_state(MirEvent& event, MirPointerButtons button_state);
+void set_unaccelerated_motion(MirEvent& event, float dx, float dy);
 
 // Deprecated version with uint64_t mac
 EventUPtr make_event(MirInputDeviceId device_id, std::chrono::nanoseconds timestamp,
@@ -157,6 +158,11 @@ EventUPtr make_event(MirInputDeviceId device_id, std::chrono::nanoseconds timest
     std::vector<uint8_t> const& mac, MirInputEventModifiers modifiers,
     std::vector<ContactState> const& contacts);
 
+// Touchpad gesture event
+EventUPtr make_touchpad_gesture_event(MirInputDeviceId device_id, std::chrono::nanoseconds timestamp,
+    MirInputEventModifiers modifiers, MirTouchpadGesture gesture, MirTouchpadGestureAction action,
+    unsigned int finger_count, float dx, float dy, float scale, float rotation, bool cancelled);
+
 EventUPtr clone_event(MirEvent const& event);
 void transform_positions(MirEvent& event, mir::geometry::Displacement const& movement);
 void set_window_id(MirEvent& event, int window_id);
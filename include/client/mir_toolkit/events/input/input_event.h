@@ -37,6 +37,7 @@ typedef enum {
     mir_input_event_type_key = 0,
     mir_input_event_type_touch = 1,
     mir_input_event_type_pointer = 2,
+    mir_input_event_type_touchpad_gesture = 3,
 
     mir_input_event_types
 } MirInputEventType;
@@ -74,6 +75,7 @@ typedef unsigned int MirInputEventModifiers;
 #include "mir_toolkit/events/input/touch_event.h"
 #include "mir_toolkit/events/input/keyboard_event.h"
 #include "mir_toolkit/events/input/pointer_event.h"
+#include "mir_toolkit/events/input/touchpad_gesture_event.h"
 
 #ifdef __cplusplus
 /**
@@ -134,6 +136,15 @@ MirTouchEvent const* mir_input_event_get_touch_event(MirInputEvent const* event)
  */
 MirPointerEvent const* mir_input_event_get_pointer_event(MirInputEvent const* event);
 
+/**
+ * Retrieve the MirTouchpadGestureEvent associated with a given input event.
+ *
+ * \param[in] event The input event
+ * \return          The MirTouchpadGestureEvent or NULL if event type is not
+ *                  mir_input_event_type_touchpad_gesture
+ */
+MirTouchpadGestureEvent const* mir_input_event_get_touchpad_gesture_event(MirInputEvent const* event);
+
 /**
  * Query if an input event contains a cookie
  *
@@ -68,6 +68,10 @@ typedef enum {
     mir_pointer_axis_relative_x = 4,
 /* Relative axis containing the last reported y differential from the pointer */
     mir_pointer_axis_relative_y = 5,
+/* Relative axis containing the last reported x differential from the pointer, before acceleration */
+    mir_pointer_axis_relative_unaccelerated_x = 6,
+/* Relative axis containing the last reported y differential from the pointer, before acceleration */
+    mir_pointer_axis_relative_unaccelerated_y = 7,
 
     mir_pointer_axes
 } MirPointerAxis;
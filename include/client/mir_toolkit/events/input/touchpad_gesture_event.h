@@ -0,0 +1,140 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_TOOLKIT_TOUCHPAD_GESTURE_EVENT_H_
+#define MIR_TOOLKIT_TOUCHPAD_GESTURE_EVENT_H_
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+/**
+ * \addtogroup mir_toolkit
+ * @{
+ */
+extern "C" {
+#endif
+
+/**
+ * An event type describing a multi-finger gesture on a touchpad.
+ */
+typedef struct MirTouchpadGestureEvent MirTouchpadGestureEvent;
+
+/**
+ * Possible touchpad gestures
+ */
+typedef enum {
+    /* Fingers moving together in the same direction */
+    mir_touchpad_gesture_swipe = 0,
+    /* Fingers moving towards or away from each other, possibly rotating */
+    mir_touchpad_gesture_pinch = 1,
+
+    mir_touchpad_gestures
+} MirTouchpadGesture;
+
+/**
+ * Possible touchpad gesture actions
+ */
+typedef enum {
+    /* The fingers have been placed and the gesture recognised */
+    mir_touchpad_gesture_action_begin = 0,
+    /* The fingers have moved */
+    mir_touchpad_gesture_action_update = 1,
+    /* The fingers have been lifted, or the gesture was cancelled */
+    mir_touchpad_gesture_action_end = 2,
+
+    mir_touchpad_gesture_actions
+} MirTouchpadGestureAction;
+
+/**
+ * Retrieve the gesture being performed.
+ *
+ *  \param [in] event       The touchpad gesture event
+ *  \return                 The gesture
+ */
+MirTouchpadGesture mir_touchpad_gesture_event_gesture(MirTouchpadGestureEvent const* event);
+
+/**
+ * Retrieve the stage of the gesture a given event reports.
+ *
+ *  \param [in] event       The touchpad gesture event
+ *  \return                 Whether the gesture began, was updated or ended
+ */
+MirTouchpadGestureAction mir_touchpad_gesture_event_action(MirTouchpadGestureEvent const* event);
+
+/**
+ * Retrieve the number of fingers performing the gesture.
+ *
+ *  \param [in] event       The touchpad gesture event
+ *  \return                 The finger count, which does not change during a gesture
+ */
+unsigned int mir_touchpad_gesture_event_finger_count(MirTouchpadGestureEvent const* event);
+
+/**
+ * Retrieve the motion of the centre of the fingers since the last event.
+ *
+ *  \param [in] event       The touchpad gesture event
+ *  \return                 The x differential, in the same units as pointer motion
+ */
+float mir_touchpad_gesture_event_dx(MirTouchpadGestureEvent const* event);
+
+/**
+ * Retrieve the motion of the centre of the fingers since the last event.
+ *
+ *  \param [in] event       The touchpad gesture event
+ *  \return                 The y differential, in the same units as pointer motion
+ */
+float mir_touchpad_gesture_event_dy(MirTouchpadGestureEvent const* event);
+
+/**
+ * Retrieve the scale of a pinch relative to the distance between the fingers
+ * when it began.
+ *
+ *  \param [in] event       The touchpad gesture event
+ *  \return                 The absolute scale, 1.0 for swipes
+ */
+float mir_touchpad_gesture_event_scale(MirTouchpadGestureEvent const* event);
+
+/**
+ * Retrieve the rotation of a pinch since the last event.
+ *
+ *  \param [in] event       The touchpad gesture event
+ *  \return                 The rotation in degrees clockwise, 0.0 for swipes
+ */
+float mir_touchpad_gesture_event_rotation(MirTouchpadGestureEvent const* event);
+
+/**
+ * Query whether a gesture ended by being cancelled rather than completed.
+ *
+ *  \param [in] event       The touchpad gesture event
+ *  \return                 True if the action is mir_touchpad_gesture_action_end
+ *                          and the gesture was cancelled
+ */
+bool mir_touchpad_gesture_event_cancelled(MirTouchpadGestureEvent const* event);
+
+/**
+ * Retrieve the corresponding input event.
+ *
+ * \param [in] event The touchpad gesture event
+ * \return           The input event
+ */
+MirInputEvent const* mir_touchpad_gesture_event_input_event(MirTouchpadGestureEvent const* event);
+
+#ifdef __cplusplus
+}
+/**@}*/
+#endif
+
+#endif /* MIR_TOOLKIT_TOUCHPAD_GESTURE_EVENT_H_ */
@@ -240,6 +240,17 @@ typedef enum MirPromptSessionState
  * Always interpreted as one 16-bit integer per pixel with components in
  * high-to-low bit order following the format name. These are the fastest
  * formats, however colour quality is visibly lower.
+ *
+ * YUV pixel formats (nv12/yuyv/i420):
+ * 8-bit BT.601 limited-range luma (Y) and chroma (U, V) samples, with chroma
+ * at half the horizontal resolution (and, for nv12 and i420, half the vertical
+ * resolution) of luma. These are what video decoders and cameras produce, and
+ * are converted to RGB by the server as they are composited.
+ *   yuyv is packed: each pair of pixels is the bytes Y0,U,Y1,V.
+ *   nv12 and i420 are planar: the stride is that of the Y plane, which is
+ * followed directly by the chroma. For nv12 that is one plane of interleaved
+ * U,V bytes with the same stride; for i420 it is a U plane then a V plane,
+ * each with half the stride.
  */
 typedef enum MirPixelFormat
 {
@@ -253,6 +264,9 @@ typedef enum MirPixelFormat
     mir_pixel_format_rgb_565 = 7,
     mir_pixel_format_rgba_5551 = 8,
     mir_pixel_format_rgba_4444 = 9,
+    mir_pixel_format_nv12 = 10,
+    mir_pixel_format_yuyv = 11,
+    mir_pixel_format_i420 = 12,
     /*
      * TODO: Big endian support would require additional formats in order to
      *       composite software surfaces using OpenGL (GL_RGBA/GL_BGRA_EXT):
@@ -263,11 +277,15 @@ typedef enum MirPixelFormat
 } MirPixelFormat;
 
 /* This could be improved... https://bugs.launchpad.net/mir/+bug/1236254 */
+/* For planar (nv12/i420) formats this is the bytes per pixel of the Y plane */
 #define MIR_BYTES_PER_PIXEL(f) ((f) == mir_pixel_format_bgr_888   ? 3 : \
                                 (f) == mir_pixel_format_rgb_888   ? 3 : \
                                 (f) == mir_pixel_format_rgb_565   ? 2 : \
                                 (f) == mir_pixel_format_rgba_5551 ? 2 : \
                                 (f) == mir_pixel_format_rgba_4444 ? 2 : \
+                                (f) == mir_pixel_format_yuyv      ? 2 : \
+                                (f) == mir_pixel_format_nv12      ? 1 : \
+                                (f) == mir_pixel_format_i420      ? 1 : \
                                                                     4)
 
 /** Direction relative to the "natural" orientation of the display */
@@ -471,6 +489,7 @@ typedef enum MirPointerConfinementState
     mir_pointer_unconfined,
     MIR_DEPRECATED_ENUM(mir_pointer_confined_to_surface, "mir_pointer_confined_to_window"),
     mir_pointer_confined_to_window = mir_pointer_confined_to_surface,
+    mir_pointer_locked_to_window, /**< The cursor stays put, only relative motion is reported */
 } MirPointerConfinementState;
 #pragma GCC diagnostic pop
 
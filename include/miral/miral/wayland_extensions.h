@@ -130,6 +130,22 @@ public:
     /// Allows clients to retrieve additional information about outputs
     /// \remark Since MirAL 2.6
     static char const* const zxdg_output_manager_v1;
+
+    /// Allows clients to receive unaccelerated pointer motion, unconstrained by the edges of outputs
+    /// \remark Since MirAL 2.9
+    static char const* const zwp_relative_pointer_manager_v1;
+
+    /// Allows clients to lock the pointer in place or confine it to a surface (e.g. for games)
+    /// \remark Since MirAL 2.9
+    static char const* const zwp_pointer_constraints_v1;
+
+    /// Allows clients to receive touchpad swipe and pinch gestures
+    /// \remark Since MirAL 2.9
+    static char const* const zwp_pointer_gestures_v1;
+
+    /// Allows clients to keep the outputs from dimming and turning off (e.g. while playing video)
+    /// \remark Since MirAL 2.9
+    static char const* const zwp_idle_inhibit_manager_v1;
     /** @} */
 
     /// Add a bespoke Wayland extension both to "supported" and "enabled by default".
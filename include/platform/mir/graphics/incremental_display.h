@@ -0,0 +1,61 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_GRAPHICS_INCREMENTAL_DISPLAY_H_
+#define MIR_GRAPHICS_INCREMENTAL_DISPLAY_H_
+
+#include <functional>
+
+namespace mir
+{
+namespace graphics
+{
+class DisplayConfiguration;
+class DisplaySyncGroup;
+
+/**
+ * Optionally implemented by a Display's NativeDisplay, for displays that can apply a
+ * configuration without replacing the sync groups of outputs it leaves unchanged.
+ *
+ * The sync groups that are kept can go on being composited while the others are replaced.
+ */
+class IncrementalDisplay
+{
+public:
+    virtual ~IncrementalDisplay() = default;
+
+    /**
+     * Applies a new display configuration, keeping the sync groups it does not affect.
+     *
+     * \param [in] conf      The new configuration
+     * \param [in] removing  Called for each sync group before it is destroyed; once this returns
+     *                       the group must no longer be in use
+     * \param [in] added     Called for each sync group after it is created
+     */
+    virtual void configure_incrementally(
+        DisplayConfiguration const& conf,
+        std::function<void(DisplaySyncGroup& group)> const& removing,
+        std::function<void(DisplaySyncGroup& group)> const& added) = 0;
+
+protected:
+    IncrementalDisplay() = default;
+    IncrementalDisplay(IncrementalDisplay const&) = delete;
+    IncrementalDisplay& operator=(IncrementalDisplay const&) = delete;
+};
+}
+}
+
+#endif /* MIR_GRAPHICS_INCREMENTAL_DISPLAY_H_ */
@@ -50,6 +50,13 @@ public:
     virtual std::shared_ptr<Buffer> buffer() const = 0;
 
     virtual geometry::Rectangle screen_position() const = 0;
+
+    /**
+     * The region of buffer(), in buffer pixels, that is scaled to fill
+     * screen_position().
+     */
+    virtual geometry::Rectangle src_bounds() const = 0;
+
     virtual std::experimental::optional<geometry::Rectangle> clip_area() const = 0;
 
     // These are from the old CompositingCriteria. There is a little bit
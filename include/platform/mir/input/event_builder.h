@@ -54,6 +54,16 @@ public:
                                     float relative_y_value) = 0;
 
     virtual EventUPtr touch_event(Timestamp timestamp, std::vector<mir::events::ContactState> const& contacts) = 0;
+
+    /// A motion event that also carries the relative motion from before pointer acceleration was applied
+    virtual EventUPtr pointer_motion_event(Timestamp timestamp, MirPointerButtons buttons_pressed,
+                                           float relative_x_value, float relative_y_value,
+                                           float unaccelerated_x_value, float unaccelerated_y_value) = 0;
+
+    /// A stage of a multi-finger touchpad swipe or pinch, scale and rotation are only meaningful for pinches
+    virtual EventUPtr touchpad_gesture_event(Timestamp timestamp, MirTouchpadGesture gesture,
+                                             MirTouchpadGestureAction action, unsigned int finger_count,
+                                             float dx, float dy, float scale, float rotation, bool cancelled) = 0;
 protected:
     EventBuilder(EventBuilder const&) = delete;
     EventBuilder& operator=(EventBuilder const&) = delete;
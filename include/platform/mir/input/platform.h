@@ -90,6 +90,15 @@ public:
      * Tell the platform to continue after device reconfiguration.
      */
     virtual void continue_after_config() = 0;
+    /*!
+     * Request the platform to stop reading devices that should not wake an idle
+     * system (anything other than keyboards and pointers).
+     */
+    virtual void suspend_non_wake_devices() = 0;
+    /*!
+     * Tell the platform to resume reading devices suspended by suspend_non_wake_devices().
+     */
+    virtual void resume_non_wake_devices() = 0;
 
 private:
     Platform(Platform const&) = delete;
@@ -52,6 +52,9 @@ extern char const* const enable_key_repeat_opt;
 extern char const* const x11_display_opt;
 extern char const* const wayland_extensions_opt;
 extern char const* const enable_mirclient_opt;
+extern char const* const idle_timeout_opt;
+extern char const* const kinetic_scroll_opt;
+extern char const* const heap_accounting_period_opt;
 
 extern char const* const name_opt;
 extern char const* const offscreen_opt;
@@ -101,6 +101,7 @@ public:
     MOCK_METHOD3(glTexParameteri, void(GLenum, GLenum, GLenum));
     MOCK_METHOD2(glUniform1f, void(GLint, GLfloat));
     MOCK_METHOD3(glUniform2f, void(GLint, GLfloat, GLfloat));
+    MOCK_METHOD5(glUniform4f, void(GLint, GLfloat, GLfloat, GLfloat, GLfloat));
     MOCK_METHOD2(glUniform1i, void(GLint, GLint));
     MOCK_METHOD4(glUniformMatrix4fv,
                  void(GLuint, GLsizei, GLboolean, const GLfloat *));
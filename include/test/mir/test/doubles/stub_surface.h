@@ -69,6 +69,8 @@ struct StubSurface : scene::Surface
     void rename(std::string const&) override {}
     void set_confine_pointer_state(MirPointerConfinementState) override {}
     MirPointerConfinementState confine_pointer_state() const override { return mir_pointer_unconfined; }
+    void set_confinement_region(std::vector<geometry::Rectangle> const&) override {}
+    auto confinement_region() const -> std::vector<geometry::Rectangle> override { return {}; }
     void placed_relative(geometry::Rectangle const&) override {}
     void start_drag_and_drop(std::vector<uint8_t> const&) override {}
     MirDepthLayer depth_layer() const override { return mir_depth_layer_application; }
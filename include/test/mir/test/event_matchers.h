@@ -97,6 +97,16 @@ inline MirPointerEvent const* maybe_pointer_event(MirEvent const* event)
         return nullptr;
     return mir_input_event_get_pointer_event(input_event);
 }
+
+inline MirTouchpadGestureEvent const* maybe_touchpad_gesture_event(MirEvent const* event)
+{
+    if (mir_event_get_type(event) != mir_event_type_input)
+        return nullptr;
+    auto input_event = mir_event_get_input_event(event);
+    if (mir_input_event_get_type(input_event) != mir_input_event_type_touchpad_gesture)
+        return nullptr;
+    return mir_input_event_get_touchpad_gesture_event(input_event);
+}
 /**
  * \}
  */
@@ -438,6 +448,23 @@ MATCHER_P2(PointerEventWithDiff, expect_dx, expect_dy, "")
     return true;
 }
 
+MATCHER_P2(PointerEventWithUnacceleratedDiff, expect_dx, expect_dy, "")
+{
+    auto pev = maybe_pointer_event(to_address(arg));
+    if (pev == nullptr)
+        return false;
+    auto const error = 0.00001f;
+    auto const actual_dx = mir_pointer_event_axis_value(pev,
+                                                mir_pointer_axis_relative_unaccelerated_x);
+    if (std::abs(expect_dx - actual_dx) > error)
+        return false;
+    auto const actual_dy = mir_pointer_event_axis_value(pev,
+                                                mir_pointer_axis_relative_unaccelerated_y);
+    if (std::abs(expect_dy - actual_dy) > error)
+        return false;
+    return true;
+}
+
 MATCHER_P2(PointerEnterEventWithDiff, expect_dx, expect_dy, "")
 {
     auto pev = maybe_pointer_event(to_address(arg));
@@ -507,6 +534,16 @@ MATCHER(PointerMovementEvent, "")
     return true;
 }
 
+MATCHER_P2(TouchpadGestureEvent, gesture, action, "")
+{
+    auto gev = maybe_touchpad_gesture_event(to_address(arg));
+    if (gev == nullptr)
+        return false;
+
+    return mir_touchpad_gesture_event_gesture(gev) == gesture &&
+        mir_touchpad_gesture_event_action(gev) == action;
+}
+
 MATCHER_P2(WindowEvent, attrib, value, "")
 {
     auto as_address = to_address(arg);
@@ -19,6 +19,11 @@
 #ifndef MIR_WAYLAND_OBJECT_H_
 #define MIR_WAYLAND_OBJECT_H_
 
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 struct wl_resource;
 struct wl_global;
 struct wl_client;
@@ -62,6 +67,72 @@ public:
     wl_global* const global;
 };
 
+/// Recycles fixed-size blocks for wrapper objects that are created and destroyed at a high rate
+///
+/// Memory is taken from the heap a slab at a time and freed blocks go on a free list for the next object of the
+/// same size, so a client creating thousands of callbacks a second does not hit the general purpose allocator.
+/// Slabs are only released when the allocator is destroyed.
+class SlabAllocator
+{
+public:
+    /// Standard allocator interface (for std::allocate_shared())
+    template<typename T>
+    struct Adapter
+    {
+        using value_type = T;
+
+        explicit Adapter(SlabAllocator& slab) : slab{&slab} {}
+        template<typename U>
+        Adapter(Adapter<U> const& other) : slab{other.slab} {}
+
+        auto allocate(std::size_t n) -> T* { return static_cast<T*>(slab->allocate(n * sizeof(T))); }
+        void deallocate(T* block, std::size_t n) noexcept { slab->deallocate(block, n * sizeof(T)); }
+
+        template<typename U>
+        auto operator==(Adapter<U> const& other) const -> bool { return slab == other.slab; }
+        template<typename U>
+        auto operator!=(Adapter<U> const& other) const -> bool { return slab != other.slab; }
+
+        SlabAllocator* slab;
+    };
+
+    explicit SlabAllocator(std::size_t blocks_per_slab);
+    ~SlabAllocator();
+
+    SlabAllocator(SlabAllocator const&) = delete;
+    SlabAllocator& operator=(SlabAllocator const&) = delete;
+
+    auto allocate(std::size_t size) -> void*;
+    /// size must be the size passed to allocate()
+    void deallocate(void* block, std::size_t size) noexcept;
+
+    /// The number of blocks handed out and not yet returned
+    auto blocks_in_use() const -> std::size_t;
+    /// The number of slabs taken from the heap
+    auto slab_count() const -> std::size_t;
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    struct SizeClass
+    {
+        std::size_t block_size;
+        FreeBlock* free_list;
+        std::vector<std::unique_ptr<char[]>> slabs;
+    };
+
+    std::size_t const blocks_per_slab;
+
+    std::mutex mutable mutex;
+    std::vector<SizeClass> size_classes;
+    std::size_t in_use{0};
+
+    auto size_class_for(std::lock_guard<std::mutex> const&, std::size_t block_size) -> SizeClass&;
+};
+
 void internal_error_processing_request(wl_client* client, char const* method_name);
 
 }
@@ -20,9 +20,7 @@
 #define MIR_CLIENT_CONNECTION_SURFACE_MAP_H_
 
 #include "mir/client/surface_map.h"
-
-#include <shared_mutex>
-#include <unordered_map>
+#include "read_mostly_map.h"
 
 class MirPresentationChain;
 class MirRenderSurface;
@@ -58,16 +56,14 @@ public:
 #pragma GCC diagnostic pop
     void with_all_windows_do(std::function<void(MirWindow*)> const&) const override;
 private:
-    std::shared_timed_mutex mutable guard;
-    std::unordered_map<frontend::SurfaceId, std::shared_ptr<MirWindow>> surfaces;
-    std::shared_timed_mutex mutable stream_guard;
-    std::unordered_map<frontend::BufferStreamId, std::shared_ptr<MirBufferStream>> streams;
-    std::unordered_map<frontend::BufferStreamId, std::shared_ptr<MirPresentationChain>> chains;
-    std::shared_timed_mutex mutable buffer_guard;
-    std::unordered_map<int, std::shared_ptr<MirBuffer>> buffers;
+    // Looked up from the RPC thread for every incoming event, so lookups must not wait on changes
+    ReadMostlyMap<frontend::SurfaceId, std::shared_ptr<MirWindow>> surfaces;
+    ReadMostlyMap<frontend::BufferStreamId, std::shared_ptr<MirBufferStream>> streams;
+    ReadMostlyMap<frontend::BufferStreamId, std::shared_ptr<MirPresentationChain>> chains;
+    ReadMostlyMap<int, std::shared_ptr<MirBuffer>> buffers;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-    std::unordered_map<void*, std::shared_ptr<MirRenderSurface>> render_surfaces;
+    ReadMostlyMap<void*, std::shared_ptr<MirRenderSurface>> render_surfaces;
 #pragma GCC diagnostic pop
 };
 
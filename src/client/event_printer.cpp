@@ -336,6 +336,20 @@ std::ostream& mir::operator<<(std::ostream& out, MirInputEvent const& event)
                 << ", hscroll=" << mir_pointer_event_axis_value(pointer_event, mir_pointer_axis_hscroll)
                 << ", modifiers=" << static_cast<MirInputEventModifier>(mir_pointer_event_modifiers(pointer_event)) << ')';
         }
+    case mir_input_event_type_touchpad_gesture:
+        {
+            auto gesture_event = mir_input_event_get_touchpad_gesture_event(&event);
+
+            return out << "touchpad_gesture_event(when=" << event_time << ", from=" << device_id << ", window_id=" << window_id
+                << ", gesture=" << mir_touchpad_gesture_event_gesture(gesture_event)
+                << ", action=" << mir_touchpad_gesture_event_action(gesture_event)
+                << ", fingers=" << mir_touchpad_gesture_event_finger_count(gesture_event)
+                << ", dx=" << mir_touchpad_gesture_event_dx(gesture_event)
+                << ", dy=" << mir_touchpad_gesture_event_dy(gesture_event)
+                << ", scale=" << mir_touchpad_gesture_event_scale(gesture_event)
+                << ", rotation=" << mir_touchpad_gesture_event_rotation(gesture_event)
+                << ", cancelled=" << mir_touchpad_gesture_event_cancelled(gesture_event) << ')';
+        }
     default:
         return out << "<INVALID>";
     }
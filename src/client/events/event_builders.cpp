@@ -216,6 +216,16 @@ void mev::set_button_state(MirEvent& event, MirPointerButtons button_state)
     event.to_input()->to_pointer()->set_buttons(button_state);
 }
 
+void mev::set_unaccelerated_motion(MirEvent& event, float dx, float dy)
+{
+    if (event.type() != mir_event_type_input ||
+        event.to_input()->input_type() != mir_input_event_type_pointer)
+        BOOST_THROW_EXCEPTION(std::invalid_argument("Unaccelerated motion is only valid for pointer events."));
+
+    event.to_input()->to_pointer()->set_dx_unaccelerated(dx);
+    event.to_input()->to_pointer()->set_dy_unaccelerated(dy);
+}
+
 // Deprecated version with uint64_t mac
 mir::EventUPtr mev::make_event(MirInputDeviceId device_id, std::chrono::nanoseconds timestamp,
     uint64_t /*mac*/, MirKeyboardAction action, xkb_keysym_t key_code,
@@ -391,6 +401,15 @@ mir::EventUPtr mev::make_event(std::chrono::nanoseconds timestamp,
     return make_uptr_event(e);
 }
 
+mir::EventUPtr mev::make_touchpad_gesture_event(MirInputDeviceId device_id, std::chrono::nanoseconds timestamp,
+    MirInputEventModifiers modifiers, MirTouchpadGesture gesture, MirTouchpadGestureAction action,
+    unsigned int finger_count, float dx, float dy, float scale, float rotation, bool cancelled)
+{
+    auto e = new_event<MirTouchpadGestureEvent>(device_id, timestamp, modifiers, gesture, action, finger_count,
+                                                dx, dy, scale, rotation, cancelled);
+    return make_uptr_event(e);
+}
+
 mir::EventUPtr mev::clone_event(MirEvent const& event)
 {
     return make_uptr_event(new MirEvent(event));
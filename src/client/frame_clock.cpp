@@ -30,31 +30,38 @@ typedef std::unique_lock<std::mutex> Lock;
 
 FrameClock::FrameClock(FrameClock::GetCurrentTime gct)
     : get_current_time{gct}
-    , config_changed{false}
-    , phase{0}
-    , period{0}
     , resync_callback{std::bind(&FrameClock::fallback_resync_callback, this)}
+    , timing{Timing{0, 0, 0, 0, false}}
 {
 }
 
 void FrameClock::set_period(std::chrono::nanoseconds ns)
 {
     Lock lock(mutex);
-    period = ns;
-    config_changed = true;
+    auto updated = timing.load();
+    updated.period = ns.count();
+    config_updated(lock, updated);
 }
 
 void FrameClock::set_resync_callback(ResyncCallback cb)
 {
     Lock lock(mutex);
     resync_callback = cb;
-    config_changed = true;
+    auto updated = timing.load();
+    config_updated(lock, updated);
+}
+
+void FrameClock::config_updated(Lock const&, Timing& updated)
+{
+    updated.config_generation++;
+    updated.config_changed = true;
+    timing.store(updated);
 }
 
 PosixTimestamp FrameClock::fallback_resync_callback() const
 {
     auto const now = get_current_time(PosixTimestamp().clock_id);
-    Lock lock(mutex);
+    std::chrono::nanoseconds const period{timing.load().period};
     /*
      * The result here needs to be in phase for all processes that call it,
      * so that nesting servers does not add lag.
@@ -64,7 +71,10 @@ PosixTimestamp FrameClock::fallback_resync_callback() const
 
 PosixTimestamp FrameClock::next_frame_after(PosixTimestamp when) const
 {
-    Lock lock(mutex);
+    auto const current = timing.load();
+    std::chrono::nanoseconds const period{current.period};
+    std::chrono::nanoseconds phase{current.phase};
+
     /*
      * Unthrottled is an option too. But why?... Because a stream might exist
      * that's not bound to a surface. And if it's not bound to a surface then
@@ -109,14 +119,46 @@ PosixTimestamp FrameClock::next_frame_after(PosixTimestamp when) const
      * Crucially this is not required on most frames, so that even if it is
      * implemented as a round trip to the server, that won't happen often.
      */
-    if (missed_frames > 1 || config_changed)
+    if (missed_frames > 1 || current.config_changed)
     {
-        lock.unlock();
-        auto const server_frame = resync_callback();
-        lock.lock();
+        /*
+         * If another thread resynced while we waited for it, use its result
+         * rather than asking again (and racing to store an older phase).
+         */
+        Lock resync_lock(resync_mutex);
+        auto const latest = timing.load();
+        if (latest.resync_generation != current.resync_generation &&
+            !latest.config_changed && latest.period != 0)
+        {
+            std::chrono::nanoseconds const latest_period{latest.period};
+            std::chrono::nanoseconds const latest_phase{latest.phase};
+            target = when - ((when % latest_period) - latest_phase) + latest_period;
+            now = get_current_time(target.clock_id);
+            if (now >= target)
+                target = target + ((now - target) / latest_period + 1) * latest_period;
+            return target;
+        }
+
+        ResyncCallback resync;
+        {
+            Lock lock(mutex);
+            resync = resync_callback;
+        }
+        auto const server_frame = resync();
 
         phase = server_frame % period;
 
+        {
+            Lock lock(mutex);
+            auto updated = timing.load();
+            updated.phase = phase.count();
+            updated.resync_generation++;
+            // A configuration change while we were resyncing needs another resync
+            if (updated.config_generation == current.config_generation)
+                updated.config_changed = false;
+            timing.store(updated);
+        }
+
         /*
          * Avoid mismatches (which will throw) and ensure we're always
          * comparing timestamps of the same clock ID. This means our result
@@ -149,7 +191,6 @@ PosixTimestamp FrameClock::next_frame_after(PosixTimestamp when) const
             target = server_frame + (age_frames + 1) * period;
         }
         assert(target > now);
-        config_changed = false;
     }
     else if (missed_frames > 0)
     {
@@ -20,6 +20,7 @@
 #define MIR_CLIENT_FRAME_CLOCK_H_
 
 #include "mir/time/posix_timestamp.h"
+#include "mir/seqlock.h"
 #include <chrono>
 #include <functional>
 #include <mutex>
@@ -62,11 +63,24 @@ private:
 
     GetCurrentTime const get_current_time;
 
-    mutable std::mutex mutex;  // Protects below fields:
-    mutable bool config_changed;
-    mutable std::chrono::nanoseconds phase;
-    std::chrono::nanoseconds period;
+    /// Everything next_frame_after() needs on a normal frame, so it can be read without locking
+    struct Timing
+    {
+        std::chrono::nanoseconds::rep period;
+        std::chrono::nanoseconds::rep phase;
+        std::uint32_t config_generation;  ///< Bumped by each configuration change
+        std::uint32_t resync_generation;  ///< Bumped by each resync
+        bool config_changed;
+    };
+
+    mutable std::mutex resync_mutex;  // Held while resyncing, so only one thread asks at a time
+
+    mutable std::mutex mutex;  // Serializes changes to timing, and protects below fields:
     ResyncCallback resync_callback;
+
+    mutable SeqLock<Timing> timing;
+
+    void config_updated(std::unique_lock<std::mutex> const&, Timing& updated);
 };
 
 }} // namespace mir::client
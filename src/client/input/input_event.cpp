@@ -49,6 +49,8 @@ std::string input_event_type_to_string(MirInputEventType input_event_type)
             return "mir_input_event_type_touch";
         case mir_input_event_type_pointer:
             return "mir_input_event_type_pointer";
+        case mir_input_event_type_touchpad_gesture:
+            return "mir_input_event_type_touchpad_gesture";
         default:
             abort();
     }
@@ -102,6 +104,11 @@ MirInputEvent const* mir_touch_event_input_event(MirTouchEvent const* event)
     return reinterpret_cast<MirInputEvent const*>(event);
 }
 
+MirInputEvent const* mir_touchpad_gesture_event_input_event(MirTouchpadGestureEvent const* event)
+{
+    return reinterpret_cast<MirInputEvent const*>(event);
+}
+
 /* Key event accessors */
 
 MirKeyboardEvent const* mir_input_event_get_keyboard_event(MirInputEvent const* ev)
@@ -243,6 +250,60 @@ MirPointerEvent const* mir_input_event_get_pointer_event(MirInputEvent const* ev
     return reinterpret_cast<MirPointerEvent const*>(ev);
 })
 
+/* Touchpad gesture event accessors */
+
+MirTouchpadGestureEvent const* mir_input_event_get_touchpad_gesture_event(MirInputEvent const* ev) MIR_HANDLE_EVENT_EXCEPTION(
+{
+    if(ev->input_type() != mir_input_event_type_touchpad_gesture)
+    {
+        mir::log_critical("expected touchpad gesture input event but event was of type " +
+            input_event_type_to_string(ev->input_type()));
+        abort();
+    }
+
+    return reinterpret_cast<MirTouchpadGestureEvent const*>(ev);
+})
+
+MirTouchpadGesture mir_touchpad_gesture_event_gesture(MirTouchpadGestureEvent const* gev) MIR_HANDLE_EVENT_EXCEPTION(
+{
+    return gev->gesture();
+})
+
+MirTouchpadGestureAction mir_touchpad_gesture_event_action(MirTouchpadGestureEvent const* gev) MIR_HANDLE_EVENT_EXCEPTION(
+{
+    return gev->action();
+})
+
+unsigned int mir_touchpad_gesture_event_finger_count(MirTouchpadGestureEvent const* gev) MIR_HANDLE_EVENT_EXCEPTION(
+{
+    return gev->finger_count();
+})
+
+float mir_touchpad_gesture_event_dx(MirTouchpadGestureEvent const* gev) MIR_HANDLE_EVENT_EXCEPTION(
+{
+    return gev->dx();
+})
+
+float mir_touchpad_gesture_event_dy(MirTouchpadGestureEvent const* gev) MIR_HANDLE_EVENT_EXCEPTION(
+{
+    return gev->dy();
+})
+
+float mir_touchpad_gesture_event_scale(MirTouchpadGestureEvent const* gev) MIR_HANDLE_EVENT_EXCEPTION(
+{
+    return gev->scale();
+})
+
+float mir_touchpad_gesture_event_rotation(MirTouchpadGestureEvent const* gev) MIR_HANDLE_EVENT_EXCEPTION(
+{
+    return gev->rotation();
+})
+
+bool mir_touchpad_gesture_event_cancelled(MirTouchpadGestureEvent const* gev) MIR_HANDLE_EVENT_EXCEPTION(
+{
+    return gev->cancelled();
+})
+
 MirEvent const* mir_input_event_get_event(MirInputEvent const* event)
 {
     return event;
@@ -281,6 +342,10 @@ float mir_pointer_event_axis_value(MirPointerEvent const* pev, MirPointerAxis ax
        return pev->dx();
    case mir_pointer_axis_relative_y:
        return pev->dy();
+   case mir_pointer_axis_relative_unaccelerated_x:
+       return pev->dx_unaccelerated();
+   case mir_pointer_axis_relative_unaccelerated_y:
+       return pev->dy_unaccelerated();
    case mir_pointer_axis_vscroll:
        return pev->vscroll();
    case mir_pointer_axis_hscroll:
@@ -319,6 +384,8 @@ bool mir_input_event_has_cookie(MirInputEvent const* ev) MIR_HANDLE_EVENT_EXCEPT
             }
             break;
         }
+        case mir_input_event_type_touchpad_gesture:
+            break;
         case mir_input_event_types:
             abort();
             break;
@@ -0,0 +1,170 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_CLIENT_READ_MOSTLY_MAP_H_
+#define MIR_CLIENT_READ_MOSTLY_MAP_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace mir
+{
+namespace client
+{
+/**
+ * A hash map for lookups on hot paths (e.g. every incoming buffer event) with rare changes.
+ *
+ * Readers never take a lock: they look up in an immutable snapshot of the map. Changes copy the
+ * map, publish the copy, and wait for any readers still using the old snapshot before freeing it.
+ * Readers count themselves against one of two alternating epochs, so a change only waits for
+ * readers that entered before it, not for those that start reading the new snapshot.
+ *
+ * Callbacks passed to for_each() run while the snapshot is in use, so must not change the map.
+ */
+template<typename Key, typename Value>
+class ReadMostlyMap
+{
+public:
+    ReadMostlyMap() : current{new Map} {}
+
+    ~ReadMostlyMap()
+    {
+        delete current.load();
+    }
+
+    /// \return the value for key, or a default constructed Value if there is none
+    auto find(Key const& key) const -> Value
+    {
+        ReadSection const section{*this};
+        auto const found = section.map.find(key);
+        return found != section.map.end() ? found->second : Value{};
+    }
+
+    template<typename Callable>
+    void for_each(Callable const& fn) const
+    {
+        ReadSection const section{*this};
+        for (auto const& entry : section.map)
+            fn(entry.second);
+    }
+
+    void insert(Key const& key, Value const& value)
+    {
+        std::lock_guard<std::mutex> lock{writer_mutex};
+        std::unique_ptr<Map> updated{new Map{*current.load()}};
+        (*updated)[key] = value;
+        publish(std::move(updated));
+    }
+
+    void erase(Key const& key)
+    {
+        std::lock_guard<std::mutex> lock{writer_mutex};
+        auto const existing = current.load();
+        if (existing->find(key) == existing->end())
+            return;
+        std::unique_ptr<Map> updated{new Map{*existing}};
+        updated->erase(key);
+        publish(std::move(updated));
+    }
+
+private:
+    ReadMostlyMap(ReadMostlyMap const&) = delete;
+    ReadMostlyMap& operator=(ReadMostlyMap const&) = delete;
+
+    using Map = std::unordered_map<Key, Value>;
+
+    struct ReadSection
+    {
+        ReadSection(ReadMostlyMap const& owner) :
+            readers{owner.enter()},
+            map{*owner.current.load()}
+        {
+        }
+
+        ~ReadSection()
+        {
+            readers.fetch_sub(1, std::memory_order_release);
+        }
+
+        std::atomic<unsigned>& readers;
+        Map const& map;
+    };
+
+    // Readers on different threads count themselves in different cache lines, so they don't contend
+    static std::size_t const reader_slots = 16;
+
+    struct alignas(64) ReaderCount
+    {
+        std::atomic<unsigned> count{0};
+    };
+
+    static auto reader_slot() -> std::size_t
+    {
+        static std::atomic<std::size_t> next_slot{0};
+        thread_local std::size_t const slot = next_slot++ % reader_slots;
+        return slot;
+    }
+
+    /// Registers a reader against the current epoch, before it loads the map
+    auto enter() const -> std::atomic<unsigned>&
+    {
+        auto const slot = reader_slot();
+
+        for (;;)
+        {
+            auto const entered = epoch.load();
+            auto& count = readers[entered][slot].count;
+            count.fetch_add(1);
+
+            // If a writer retired this epoch meanwhile it may not have seen us: count against the new one
+            if (epoch.load() == entered)
+                return count;
+
+            count.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    void publish(std::unique_ptr<Map> updated)
+    {
+        std::unique_ptr<Map const> const previous{current.exchange(updated.release())};
+
+        // Readers that could have loaded the previous map registered against the retired epoch before
+        // loading it. Later readers count against the new epoch, so a stream of them can't hold us up.
+        // (The counts and epoch are accessed sequentially consistently: a reader's increment followed by
+        // its load of the epoch must be ordered against our store of the epoch followed by our loads.)
+        auto const retired = epoch.load();
+        epoch.store(retired ^ 1u);
+
+        for (auto const& slot : readers[retired])
+        {
+            while (slot.count.load() != 0)
+                std::this_thread::yield();
+        }
+    }
+
+    std::mutex writer_mutex;
+    std::atomic<Map*> current;
+    std::atomic<unsigned> epoch{0};
+    ReaderCount mutable readers[2][reader_slots];
+};
+}
+}
+
+#endif /* MIR_CLIENT_READ_MOSTLY_MAP_H_ */
@@ -21,8 +21,6 @@
 
 #include "mir_protobuf.pb.h"
 #include "mir_protobuf_wire.pb.h"
-#include "mir/frontend/client_constants.h"
-#include "mir/variable_length_array.h"
 #include "mir/protobuf/protocol_version.h"
 #include "mir/log.h"
 
@@ -30,6 +28,7 @@
 #include <google/protobuf/stubs/callback.h>
 #endif
 
+#include <algorithm>
 #include <sstream>
 
 namespace mclr = mir::client::rpc;
@@ -52,12 +51,23 @@ int get_protocol_version()
 
     return protocol_version;
 }
+
+// Enough for the calls a client has in flight at once; more just grows the vector
+size_t const expected_pending_calls = 16;
 }
 
 mclrd::PendingCallCache::PendingCallCache(
     std::shared_ptr<RpcReport> const& rpc_report)
     : rpc_report{rpc_report}
 {
+    pending_calls.reserve(expected_pending_calls);
+}
+
+auto mclrd::PendingCallCache::find(int id) -> std::vector<PendingCall>::iterator
+{
+    return std::find_if(
+        pending_calls.begin(), pending_calls.end(),
+        [id](PendingCall const& call) { return call.id == id; });
 }
 
 void mclrd::PendingCallCache::save_completion_details(
@@ -67,15 +77,11 @@ void mclrd::PendingCallCache::save_completion_details(
 {
     std::unique_lock<std::mutex> lock(mutex);
 
-    pending_calls[invoke.id()] = PendingCall(response, complete);
-}
-
-void mclrd::PendingCallCache::populate_message_for_result(
-    mir::protobuf::wire::Result& result,
-    std::function<void(google::protobuf::MessageLite*)> const& populator)
-{
-    std::unique_lock<std::mutex> lock(mutex);
-    populator(pending_calls.at(result.id()).response);
+    auto const call = find(invoke.id());
+    if (call != pending_calls.end())
+        *call = PendingCall(invoke.id(), response, complete);
+    else
+        pending_calls.emplace_back(invoke.id(), response, complete);
 }
 
 void mclrd::PendingCallCache::complete_response(mir::protobuf::wire::Result& result)
@@ -84,10 +90,10 @@ void mclrd::PendingCallCache::complete_response(mir::protobuf::wire::Result& res
 
     {
         std::unique_lock<std::mutex> lock(mutex);
-        auto call = pending_calls.find(result.id());
+        auto call = find(result.id());
         if (call != pending_calls.end())
         {
-            completion = std::move(call->second);
+            completion = *call;
             pending_calls.erase(call);
         }
         ++running_callbacks;
@@ -117,7 +123,7 @@ void mclrd::PendingCallCache::force_completion()
     while (!pending_calls.empty())
     {
         auto i = pending_calls.begin();
-        auto completion = std::move(i->second);
+        auto completion = *i;
         pending_calls.erase(i);
         lock.unlock();
         completion.complete->Run();
@@ -148,29 +154,15 @@ mclr::MirBasicRpcChannel::MirBasicRpcChannel() :
 
 mclr::MirBasicRpcChannel::~MirBasicRpcChannel() = default;
 
-mir::protobuf::wire::Invocation mclr::MirBasicRpcChannel::invocation_for(
+void mclr::MirBasicRpcChannel::prepare_invocation(
+    mir::protobuf::wire::Invocation& invocation,
     std::string const& method_name,
-    google::protobuf::MessageLite const* request,
     size_t num_side_channel_fds)
 {
-    mir::VariableLengthArray<mir::frontend::serialization_buffer_size>
-#if GOOGLE_PROTOBUF_VERSION >= 3010000
-        buffer{static_cast<size_t>(request->ByteSizeLong())};
-#else
-        buffer{static_cast<size_t>(request->ByteSize())};
-#endif
-
-    request->SerializeWithCachedSizesToArray(buffer.data());
-
-    mir::protobuf::wire::Invocation invoke;
-
-    invoke.set_id(next_id());
-    invoke.set_method_name(method_name);
-    invoke.set_parameters(buffer.data(), buffer.size());
-    invoke.set_protocol_version(protocol_version);
-    invoke.set_side_channel_fds(num_side_channel_fds);
-
-    return invoke;
+    invocation.set_id(next_id());
+    invocation.set_method_name(method_name);
+    invocation.set_protocol_version(protocol_version);
+    invocation.set_side_channel_fds(num_side_channel_fds);
 }
 
 int mclr::MirBasicRpcChannel::next_id()
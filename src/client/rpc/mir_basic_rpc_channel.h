@@ -20,12 +20,11 @@
 #define MIR_CLIENT_RPC_MIR_BASIC_RPC_CHANNEL_H_
 
 #include <memory>
-#include <map>
 #include <mutex>
 #include <atomic>
 #include <vector>
 #include <condition_variable>
-#include <functional>
+#include <stdexcept>
 
 namespace google
 {
@@ -69,9 +68,17 @@ public:
         google::protobuf::Closure* complete);
 
 
-    void populate_message_for_result(
-        mir::protobuf::wire::Result& result,
-        std::function<void(google::protobuf::MessageLite*)> const& populator);
+    /// Hands populator the response awaited by call id under the lock. A template so that replies don't
+    /// pay for wrapping populator in a std::function; throws std::out_of_range if no such call is pending.
+    template<typename Populator>
+    void populate_message_for_result(int id, Populator const& populator)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        auto const call = find(id);
+        if (call == pending_calls.end())
+            throw std::out_of_range{"no pending call with this id"};
+        populator(call->response);
+    }
 
     void complete_response(mir::protobuf::wire::Result& result);
 
@@ -86,21 +93,27 @@ private:
     struct PendingCall
     {
         PendingCall(
+            int id,
             google::protobuf::MessageLite* response,
             google::protobuf::Closure* target)
-        : response(response), complete(target) {}
+        : id(id), response(response), complete(target) {}
 
         PendingCall()
-        : response(0), complete() {}
+        : id(0), response(0), complete() {}
 
+        int id;
         google::protobuf::MessageLite* response;
         google::protobuf::Closure* complete;
     };
 
+    /// Only a handful of calls are ever in flight, so a linear search beats a node-based map
+    auto find(int id) -> std::vector<PendingCall>::iterator;
+
     std::mutex mutable mutex;
     std::condition_variable mutable pending_calls_shrank;
     int running_callbacks = 0;
-    std::map<int, PendingCall> pending_calls;
+    /// In call order (ids are issued in sequence); reserved up front so saving a call doesn't allocate
+    std::vector<PendingCall> pending_calls;
     std::shared_ptr<RpcReport> const rpc_report;
 };
 }
@@ -121,9 +134,10 @@ public:
 
 protected:
     MirBasicRpcChannel();
-    mir::protobuf::wire::Invocation invocation_for(
+    /// Fills in everything but the parameters, which are encoded straight into the send buffer
+    void prepare_invocation(
+        mir::protobuf::wire::Invocation& invocation,
         std::string const& method_name,
-        google::protobuf::MessageLite const* request,
         size_t num_side_channel_fds);
     int next_id();
 
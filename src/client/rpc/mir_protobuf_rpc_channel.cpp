@@ -41,6 +41,8 @@
 #include "mir_protobuf_wire.pb.h"
 
 #include "mir/event_printer.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <boost/bind.hpp>
 #include <boost/throw_exception.hpp>
 #include <endian.h>
@@ -55,6 +57,18 @@ namespace mclr = mir::client::rpc;
 namespace md = mir::dispatch;
 namespace mp = mir::protobuf;
 
+namespace
+{
+template<size_t size>
+auto arena_options_using(std::array<char, size>& initial_block) -> google::protobuf::ArenaOptions
+{
+    google::protobuf::ArenaOptions options;
+    options.initial_block = initial_block.data();
+    options.initial_block_size = initial_block.size();
+    return options;
+}
+}
+
 mclr::MirProtobufRpcChannel::MirProtobufRpcChannel(
     std::unique_ptr<mclr::StreamTransport> transport,
     std::shared_ptr<mcl::SurfaceMap> const& surface_map,
@@ -70,6 +84,7 @@ mclr::MirProtobufRpcChannel::MirProtobufRpcChannel(
     rpc_report(rpc_report),
     pending_calls(rpc_report),
     input_report(input_report),
+    reply_arena{arena_options_using(reply_arena_block)},
     surface_map(surface_map),
     buffer_factory(buffer_factory),
     display_configuration(disp_config),
@@ -126,6 +141,7 @@ void mclr::MirProtobufRpcChannel::receive_any_file_descriptors_for(MessageType*
         {
             std::vector<mir::Fd> fds(response->fds_on_side_channel());
             transport->receive_data(dummy.data(), dummy.size(), fds);
+            response->mutable_fd()->Reserve(fds.size());
             for (auto &fd: fds)
                 response->add_fd(fd);
 
@@ -137,54 +153,39 @@ void mclr::MirProtobufRpcChannel::receive_any_file_descriptors_for(MessageType*
 
 void mclr::MirProtobufRpcChannel::receive_file_descriptors(google::protobuf::MessageLite* response)
 {
-    auto const message_type = response->GetTypeName();
-
+    // Unlike GetTypeName(), a dynamic_cast doesn't build a string for every reply
     mir::protobuf::Surface* surface = nullptr;
     mir::protobuf::Buffer* buffer = nullptr;
     mir::protobuf::Platform* platform = nullptr;
     mir::protobuf::SocketFD* socket_fd = nullptr;
     mir::protobuf::PlatformOperationMessage* platform_operation_message = nullptr;
 
-    if (message_type == "mir.protobuf.Buffer")
-    {
-        buffer = static_cast<mir::protobuf::Buffer*>(response);
-    }
-    else if (message_type == "mir.protobuf.BufferStream")
+    if (auto const buffer_stream = dynamic_cast<mir::protobuf::BufferStream*>(response))
     {
-        auto buffer_stream = static_cast<mir::protobuf::BufferStream*>(response);
-        if (buffer_stream && buffer_stream->has_buffer())
+        if (buffer_stream->has_buffer())
             buffer = buffer_stream->mutable_buffer();
     }
-    else if (message_type == "mir.protobuf.Surface")
+    else if ((surface = dynamic_cast<mir::protobuf::Surface*>(response)))
     {
-        surface = static_cast<mir::protobuf::Surface*>(response);
-        if (surface && surface->has_buffer_stream() && surface->buffer_stream().has_buffer())
+        if (surface->has_buffer_stream() && surface->buffer_stream().has_buffer())
             buffer = surface->mutable_buffer_stream()->mutable_buffer();
     }
-    else if (message_type == "mir.protobuf.Screencast")
+    else if (auto const screencast = dynamic_cast<mir::protobuf::Screencast*>(response))
     {
-        auto screencast = static_cast<mir::protobuf::Screencast*>(response);
-        if (screencast && screencast->has_buffer_stream() && screencast->buffer_stream().has_buffer())
+        if (screencast->has_buffer_stream() && screencast->buffer_stream().has_buffer())
             buffer = screencast->mutable_buffer_stream()->mutable_buffer();
     }
-    else if (message_type == "mir.protobuf.Platform")
-    {
-        platform = static_cast<mir::protobuf::Platform*>(response);
-    }
-    else if (message_type == "mir.protobuf.Connection")
+    else if (auto const connection = dynamic_cast<mir::protobuf::Connection*>(response))
     {
-        auto connection = static_cast<mir::protobuf::Connection*>(response);
-        if (connection && connection->has_platform())
+        if (connection->has_platform())
             platform = connection->mutable_platform();
     }
-    else if (message_type == "mir.protobuf.SocketFD")
-    {
-        socket_fd = static_cast<mir::protobuf::SocketFD*>(response);
-    }
-    else if (message_type == "mir.protobuf.PlatformOperationMessage")
+    else
     {
-        platform_operation_message =
-            static_cast<mir::protobuf::PlatformOperationMessage*>(response);
+        buffer = dynamic_cast<mir::protobuf::Buffer*>(response);
+        platform = dynamic_cast<mir::protobuf::Platform*>(response);
+        socket_fd = dynamic_cast<mir::protobuf::SocketFD*>(response);
+        platform_operation_message = dynamic_cast<mir::protobuf::PlatformOperationMessage*>(response);
     }
 
     receive_any_file_descriptors_for(surface);
@@ -219,22 +220,19 @@ void mclr::MirProtobufRpcChannel::call_method(
         discard = true;
 
     // Only send message when details saved for handling response
-    std::vector<mir::Fd> fds;
-    if (parameters->GetTypeName() == "mir.protobuf.BufferRequest")
+    send_fds.clear();
+    if (auto const buffer_request = dynamic_cast<mir::protobuf::BufferRequest const*>(parameters))
     {
-        auto const* buffer = reinterpret_cast<mir::protobuf::BufferRequest const*>(parameters);
-        for (auto& fd : buffer->buffer().fd())
-            fds.emplace_back(mir::Fd{IntOwnedFd{fd}});
+        for (auto& fd : buffer_request->buffer().fd())
+            send_fds.emplace_back(mir::Fd{IntOwnedFd{fd}});
     }
-    else if (parameters->GetTypeName() == "mir.protobuf.PlatformOperationMessage")
+    else if (auto const operation = dynamic_cast<mir::protobuf::PlatformOperationMessage const*>(parameters))
     {
-        auto const* request =
-            reinterpret_cast<mir::protobuf::PlatformOperationMessage const*>(parameters);
-        for (auto& fd : request->fd())
-            fds.emplace_back(mir::Fd{IntOwnedFd{fd}});
+        for (auto& fd : operation->fd())
+            send_fds.emplace_back(mir::Fd{IntOwnedFd{fd}});
     }
 
-    auto const& invocation = invocation_for(method_name, parameters, fds.size());
+    prepare_invocation(invocation, method_name, send_fds.size());
 
     rpc_report->invocation_requested(invocation);
 
@@ -246,7 +244,7 @@ void mclr::MirProtobufRpcChannel::call_method(
         prioritise_next_request = false;
     }
 
-    send_message(invocation, invocation, fds);
+    send_message(*parameters);
 }
 
 void mclr::MirProtobufRpcChannel::discard_future_calls()
@@ -260,30 +258,43 @@ void mclr::MirProtobufRpcChannel::wait_for_outstanding_calls()
     pending_calls.wait_till_complete();
 }
 
-void mclr::MirProtobufRpcChannel::send_message(
-    mir::protobuf::wire::Invocation const& body,
-    mir::protobuf::wire::Invocation const& invocation,
-    std::vector<mir::Fd>& fds)
+void mclr::MirProtobufRpcChannel::send_message(google::protobuf::MessageLite const& parameters)
 {
+    using google::protobuf::io::CodedOutputStream;
+    using google::protobuf::internal::WireFormatLite;
+
+    /*
+     * The parameters are encoded as the Invocation's "parameters" field directly after
+     * the other fields, saving serializing them to an intermediate string first.
+     * (Protobuf parsers accept fields in any order.)
+     */
+    int const parameters_field = mir::protobuf::wire::Invocation::kParametersFieldNumber;
 #if GOOGLE_PROTOBUF_VERSION >= 3010000
-    const size_t size = body.ByteSizeLong();
+    size_t const parameters_size = parameters.ByteSizeLong();
+    size_t const header_fields_size = invocation.ByteSizeLong();
 #else
-    const size_t size = body.ByteSize();
+    size_t const parameters_size = parameters.ByteSize();
+    size_t const header_fields_size = invocation.ByteSize();
 #endif
-    const unsigned char header_bytes[2] =
-    {
-        static_cast<unsigned char>((size >> 8) & 0xff),
-        static_cast<unsigned char>((size >> 0) & 0xff)
-    };
-
-    detail::SendBuffer send_buffer(sizeof header_bytes + size);
-    std::copy(header_bytes, header_bytes + sizeof header_bytes, send_buffer.begin());
-    body.SerializeToArray(send_buffer.data() + sizeof header_bytes, size);
+    size_t const size =
+        header_fields_size +
+        WireFormatLite::TagSize(parameters_field, WireFormatLite::TYPE_BYTES) +
+        CodedOutputStream::VarintSize32(parameters_size) +
+        parameters_size;
+
+    send_buffer.resize(size_of_header + size);
+    auto out = send_buffer.data();
+    *out++ = static_cast<uint8_t>((size >> 8) & 0xff);
+    *out++ = static_cast<uint8_t>((size >> 0) & 0xff);
+    out = invocation.SerializeWithCachedSizesToArray(out);
+    out = WireFormatLite::WriteTagToArray(parameters_field, WireFormatLite::WIRETYPE_LENGTH_DELIMITED, out);
+    out = CodedOutputStream::WriteVarint32ToArray(parameters_size, out);
+    parameters.SerializeWithCachedSizesToArray(out);
 
     try
     {
         std::lock_guard<decltype(write_mutex)> lock(write_mutex);
-        transport->send_message(send_buffer, fds);
+        transport->send_message(send_buffer, send_fds);
     }
     catch (std::runtime_error const& err)
     {
@@ -296,7 +307,7 @@ void mclr::MirProtobufRpcChannel::send_message(
 
 void mclr::MirProtobufRpcChannel::process_event_sequence(std::string const& event)
 {
-    mp::EventSequence seq;
+    auto& seq = *google::protobuf::Arena::CreateMessage<mp::EventSequence>(&reply_arena);
 
     seq.ParseFromString(event);
 
@@ -484,7 +495,9 @@ void mclr::MirProtobufRpcChannel::on_data_available()
      */
     std::lock_guard<decltype(read_mutex)> lock(read_mutex);
 
-    auto result = mcl::make_protobuf_object<mp::wire::Result>();
+    // Nothing decoded from the previous reply is still in use
+    reply_arena.Reset();
+    auto const result = google::protobuf::Arena::CreateMessage<mp::wire::Result>(&reply_arena);
     try
     {
         uint16_t message_size;
@@ -514,7 +527,7 @@ void mclr::MirProtobufRpcChannel::on_data_available()
         if (result->has_id())
         {
             pending_calls.populate_message_for_result(
-                *result,
+                result->id(),
                 [&](google::protobuf::MessageLite* result_message)
                     {
                         result_message->ParseFromString(result->response());
@@ -530,9 +543,9 @@ void mclr::MirProtobufRpcChannel::on_data_available()
                 }
                 else
                 {
-                    // It's too difficult to convince C++ to move this lambda everywhere, so
-                    // just give up and let it pretend its a shared_ptr.
-                    std::shared_ptr<mp::wire::Result> appeaser{std::move(result)};
+                    // This outlives the reply arena. It's too difficult to convince C++ to move
+                    // this lambda everywhere, so just give up and let it pretend its a shared_ptr.
+                    std::shared_ptr<mp::wire::Result> appeaser{mcl::make_protobuf_object(*result)};
                     delayed_processor->enqueue([delayed_result = std::move(appeaser), this]() mutable
                     {
                         pending_calls.complete_response(*delayed_result);
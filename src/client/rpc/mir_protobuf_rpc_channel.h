@@ -29,6 +29,11 @@
 #include "../ping_handler.h"
 #include "../error_handler.h"
 
+#include "mir_protobuf_wire.pb.h"
+
+#include <google/protobuf/arena.h>
+
+#include <array>
 #include <thread>
 #include <atomic>
 #include <experimental/optional>
@@ -118,16 +123,25 @@ private:
     std::mutex discard_mutex;
     bool discard{false};
 
+    /* Reused by every call (under discard_mutex) so that, once they have grown to
+     * fit, sending doesn't allocate. */
+    mir::protobuf::wire::Invocation invocation;
+    std::vector<mir::Fd> send_fds;
+    detail::SendBuffer send_buffer;
+
     static constexpr size_t size_of_header = 2;
-    detail::SendBuffer header_bytes;
     detail::SendBuffer body_bytes;
 
+    /* Replies (and the event sequences they carry) are decoded onto this arena (under
+     * read_mutex). It is reset as each reply arrives, so anything outliving the reply
+     * must be copied off it first. */
+    alignas(8) std::array<char, 4096> reply_arena_block;
+    google::protobuf::Arena reply_arena;
+
     void receive_file_descriptors(google::protobuf::MessageLite* response);
     template<class MessageType>
     void receive_any_file_descriptors_for(MessageType* response);
-    void send_message(mir::protobuf::wire::Invocation const& body,
-                      mir::protobuf::wire::Invocation const& invocation,
-                      std::vector<mir::Fd>& fds);
+    void send_message(google::protobuf::MessageLite const& parameters);
 
     void read_message();
     void process_event_sequence(std::string const& event);
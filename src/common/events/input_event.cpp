@@ -21,6 +21,7 @@
 #include "mir/events/keyboard_event.h"
 #include "mir/events/pointer_event.h"
 #include "mir/events/touch_event.h"
+#include "mir/events/touchpad_gesture_event.h"
 
 #include <stdlib.h>
 
@@ -49,6 +50,8 @@ MirInputEventType MirInputEvent::input_type() const
         return mir_input_event_type_touch;
     case mir::capnp::InputEvent::Which::POINTER:
         return mir_input_event_type_pointer;
+    case mir::capnp::InputEvent::Which::TOUCHPAD_GESTURE:
+        return mir_input_event_type_touchpad_gesture;
     default:
         abort();
     }
@@ -104,6 +107,16 @@ MirTouchEvent const* MirInputEvent::to_touch() const
     return static_cast<MirTouchEvent const*>(this);
 }
 
+MirTouchpadGestureEvent* MirInputEvent::to_touchpad_gesture()
+{
+    return static_cast<MirTouchpadGestureEvent*>(this);
+}
+
+MirTouchpadGestureEvent const* MirInputEvent::to_touchpad_gesture() const
+{
+    return static_cast<MirTouchpadGestureEvent const*>(this);
+}
+
 std::chrono::nanoseconds MirInputEvent::event_time() const
 {
     return std::chrono::nanoseconds{event.asReader().getInput().getEventTime().getCount()};
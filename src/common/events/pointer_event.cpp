@@ -48,6 +48,8 @@ MirPointerEvent::MirPointerEvent(MirInputDeviceId dev,
     ptr.setY(y);
     ptr.setDx(dx);
     ptr.setDy(dy);
+    ptr.setDxUnaccelerated(dx);
+    ptr.setDyUnaccelerated(dy);
     ptr.setVscroll(vscroll);
     ptr.setHscroll(hscroll);
     ptr.setButtons(buttons);
@@ -104,6 +106,26 @@ void MirPointerEvent::set_dy(float dy)
     event.getInput().getPointer().setDy(dy);
 }
 
+float MirPointerEvent::dx_unaccelerated() const
+{
+    return event.asReader().getInput().getPointer().getDxUnaccelerated();
+}
+
+void MirPointerEvent::set_dx_unaccelerated(float dx)
+{
+    event.getInput().getPointer().setDxUnaccelerated(dx);
+}
+
+float MirPointerEvent::dy_unaccelerated() const
+{
+    return event.asReader().getInput().getPointer().getDyUnaccelerated();
+}
+
+void MirPointerEvent::set_dy_unaccelerated(float dy)
+{
+    event.getInput().getPointer().setDyUnaccelerated(dy);
+}
+
 float MirPointerEvent::vscroll() const
 {
     return event.asReader().getInput().getPointer().getVscroll();
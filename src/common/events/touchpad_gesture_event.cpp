@@ -0,0 +1,129 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/events/touchpad_gesture_event.h"
+
+MirTouchpadGestureEvent::MirTouchpadGestureEvent()
+{
+    event.initInput();
+    event.getInput().initTouchpadGesture();
+}
+
+MirTouchpadGestureEvent::MirTouchpadGestureEvent(MirInputDeviceId dev,
+                            std::chrono::nanoseconds et,
+                            MirInputEventModifiers mods,
+                            MirTouchpadGesture gesture,
+                            MirTouchpadGestureAction action,
+                            unsigned int finger_count,
+                            float dx,
+                            float dy,
+                            float scale,
+                            float rotation,
+                            bool cancelled)
+    : MirInputEvent(dev, et, mods, {})
+{
+    auto gev = event.getInput().initTouchpadGesture();
+    gev.setGesture(static_cast<mir::capnp::TouchpadGestureEvent::Gesture>(gesture));
+    gev.setAction(static_cast<mir::capnp::TouchpadGestureEvent::Action>(action));
+    gev.setFingerCount(finger_count);
+    gev.setDx(dx);
+    gev.setDy(dy);
+    gev.setScale(scale);
+    gev.setRotation(rotation);
+    gev.setCancelled(cancelled);
+}
+
+MirTouchpadGesture MirTouchpadGestureEvent::gesture() const
+{
+    return static_cast<MirTouchpadGesture>(event.asReader().getInput().getTouchpadGesture().getGesture());
+}
+
+void MirTouchpadGestureEvent::set_gesture(MirTouchpadGesture gesture)
+{
+    event.getInput().getTouchpadGesture().setGesture(
+        static_cast<mir::capnp::TouchpadGestureEvent::Gesture>(gesture));
+}
+
+MirTouchpadGestureAction MirTouchpadGestureEvent::action() const
+{
+    return static_cast<MirTouchpadGestureAction>(event.asReader().getInput().getTouchpadGesture().getAction());
+}
+
+void MirTouchpadGestureEvent::set_action(MirTouchpadGestureAction action)
+{
+    event.getInput().getTouchpadGesture().setAction(
+        static_cast<mir::capnp::TouchpadGestureEvent::Action>(action));
+}
+
+unsigned int MirTouchpadGestureEvent::finger_count() const
+{
+    return event.asReader().getInput().getTouchpadGesture().getFingerCount();
+}
+
+void MirTouchpadGestureEvent::set_finger_count(unsigned int count)
+{
+    event.getInput().getTouchpadGesture().setFingerCount(count);
+}
+
+float MirTouchpadGestureEvent::dx() const
+{
+    return event.asReader().getInput().getTouchpadGesture().getDx();
+}
+
+void MirTouchpadGestureEvent::set_dx(float dx)
+{
+    event.getInput().getTouchpadGesture().setDx(dx);
+}
+
+float MirTouchpadGestureEvent::dy() const
+{
+    return event.asReader().getInput().getTouchpadGesture().getDy();
+}
+
+void MirTouchpadGestureEvent::set_dy(float dy)
+{
+    event.getInput().getTouchpadGesture().setDy(dy);
+}
+
+float MirTouchpadGestureEvent::scale() const
+{
+    return event.asReader().getInput().getTouchpadGesture().getScale();
+}
+
+void MirTouchpadGestureEvent::set_scale(float scale)
+{
+    event.getInput().getTouchpadGesture().setScale(scale);
+}
+
+float MirTouchpadGestureEvent::rotation() const
+{
+    return event.asReader().getInput().getTouchpadGesture().getRotation();
+}
+
+void MirTouchpadGestureEvent::set_rotation(float rotation)
+{
+    event.getInput().getTouchpadGesture().setRotation(rotation);
+}
+
+bool MirTouchpadGestureEvent::cancelled() const
+{
+    return event.asReader().getInput().getTouchpadGesture().getCancelled();
+}
+
+void MirTouchpadGestureEvent::set_cancelled(bool cancelled)
+{
+    event.getInput().getTouchpadGesture().setCancelled(cancelled);
+}
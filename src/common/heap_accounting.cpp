@@ -0,0 +1,112 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/heap_accounting.h"
+
+#include <atomic>
+
+namespace mha = mir::heap_accounting;
+
+namespace
+{
+// Everything here is constant initialized: the accounting allocator runs before (and after)
+// any dynamic initialization in this library.
+struct Counters
+{
+    std::atomic<size_t> bytes_in_use;
+    std::atomic<size_t> blocks_in_use;
+    std::atomic<uint64_t> bytes_allocated;
+    std::atomic<uint64_t> allocations;
+};
+
+Counters counters[static_cast<size_t>(mha::Subsystem::count)];
+std::atomic<bool> counting{false};
+
+thread_local mha::Subsystem current_subsystem{mha::Subsystem::other};
+
+auto counters_for(mha::Subsystem subsystem) -> Counters&
+{
+    return counters[static_cast<size_t>(subsystem)];
+}
+}
+
+auto mha::name_of(Subsystem subsystem) -> char const*
+{
+    switch (subsystem)
+    {
+    case Subsystem::other:              return "other";
+    case Subsystem::compositor:         return "compositor";
+    case Subsystem::renderer:           return "renderer";
+    case Subsystem::wayland:            return "wayland";
+    case Subsystem::window_management:  return "window_management";
+    case Subsystem::input:              return "input";
+    case Subsystem::decorations:        return "decorations";
+    case Subsystem::xwayland:           return "xwayland";
+    case Subsystem::count:              break;
+    }
+
+    return "unknown";
+}
+
+mha::Scope::Scope(Subsystem subsystem) noexcept
+    : enclosing{current_subsystem}
+{
+    current_subsystem = subsystem;
+}
+
+mha::Scope::~Scope() noexcept
+{
+    current_subsystem = enclosing;
+}
+
+auto mha::enabled() -> bool
+{
+    return counting.load(std::memory_order_relaxed);
+}
+
+auto mha::usage_of(Subsystem subsystem) -> Usage
+{
+    auto const& c = counters_for(subsystem);
+    return {
+        c.bytes_in_use.load(std::memory_order_relaxed),
+        c.blocks_in_use.load(std::memory_order_relaxed),
+        c.bytes_allocated.load(std::memory_order_relaxed),
+        c.allocations.load(std::memory_order_relaxed)};
+}
+
+auto mha::charge_allocation(size_t size) noexcept -> Subsystem
+{
+    auto const subsystem = current_subsystem;
+    auto& c = counters_for(subsystem);
+
+    c.bytes_in_use.fetch_add(size, std::memory_order_relaxed);
+    c.blocks_in_use.fetch_add(1, std::memory_order_relaxed);
+    c.bytes_allocated.fetch_add(size, std::memory_order_relaxed);
+    c.allocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (!counting.load(std::memory_order_relaxed))
+        counting.store(true, std::memory_order_relaxed);
+
+    return subsystem;
+}
+
+void mha::credit_deallocation(Subsystem subsystem, size_t size) noexcept
+{
+    auto& c = counters_for(subsystem);
+
+    c.bytes_in_use.fetch_sub(size, std::memory_order_relaxed);
+    c.blocks_in_use.fetch_sub(1, std::memory_order_relaxed);
+}
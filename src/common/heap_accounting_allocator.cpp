@@ -0,0 +1,83 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// The accounting allocator: preload this (LD_PRELOAD=libmirheapaccounting.so) to count heap use
+// by the subsystems tagged with mir::heap_accounting::Scope.
+
+#include "mir/heap_accounting.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace mha = mir::heap_accounting;
+
+namespace
+{
+/// Prefixed to each block, so it is freed from the account it was charged to
+struct alignas(alignof(std::max_align_t)) Header
+{
+    size_t size;
+    mha::Subsystem subsystem;
+};
+
+auto allocate(size_t size) noexcept -> void*
+{
+    auto const header = static_cast<Header*>(std::malloc(sizeof(Header) + size));
+    if (!header)
+        return nullptr;
+
+    header->size = size;
+    header->subsystem = mha::charge_allocation(size);
+    return header + 1;
+}
+
+auto allocate_or_throw(size_t size) -> void*
+{
+    for (;;)
+    {
+        if (auto const block = allocate(size))
+            return block;
+
+        if (auto const handler = std::get_new_handler())
+            handler();
+        else
+            throw std::bad_alloc{};
+    }
+}
+
+void deallocate(void* block) noexcept
+{
+    if (!block)
+        return;
+
+    auto const header = static_cast<Header*>(block) - 1;
+    mha::credit_deallocation(header->subsystem, header->size);
+    std::free(header);
+}
+}
+
+// Over-aligned allocations use the standard library's operators, so aren't counted
+void* operator new(size_t size) { return allocate_or_throw(size); }
+void* operator new[](size_t size) { return allocate_or_throw(size); }
+void* operator new(size_t size, std::nothrow_t const&) noexcept { return allocate(size); }
+void* operator new[](size_t size, std::nothrow_t const&) noexcept { return allocate(size); }
+
+void operator delete(void* block) noexcept { deallocate(block); }
+void operator delete[](void* block) noexcept { deallocate(block); }
+void operator delete(void* block, std::nothrow_t const&) noexcept { deallocate(block); }
+void operator delete[](void* block, std::nothrow_t const&) noexcept { deallocate(block); }
+void operator delete(void* block, size_t) noexcept { deallocate(block); }
+void operator delete[](void* block, size_t) noexcept { deallocate(block); }
@@ -27,6 +27,7 @@ mgl::Primitive mgl::tessellate_renderable_into_rectangle(
     mg::Renderable const& renderable, geom::Displacement const& offset)
 {
     auto const& buf_size = renderable.buffer()->size();
+    auto const src = renderable.src_bounds();
     auto rect = renderable.screen_position();
     rect.top_left = rect.top_left - offset;
     GLfloat left = rect.top_left.x.as_int();
@@ -37,15 +38,20 @@ mgl::Primitive mgl::tessellate_renderable_into_rectangle(
     mgl::Primitive rectangle;
     rectangle.type = GL_TRIANGLE_STRIP;
 
-    GLfloat tex_right = static_cast<GLfloat>(rect.size.width.as_int()) /
+    // The source region of the buffer is scaled to fill the screen rectangle
+    GLfloat tex_left = static_cast<GLfloat>(src.top_left.x.as_int()) /
+                       buf_size.width.as_int();
+    GLfloat tex_top = static_cast<GLfloat>(src.top_left.y.as_int()) /
+                      buf_size.height.as_int();
+    GLfloat tex_right = static_cast<GLfloat>(src.right().as_int()) /
                         buf_size.width.as_int();
-    GLfloat tex_bottom = static_cast<GLfloat>(rect.size.height.as_int()) /
+    GLfloat tex_bottom = static_cast<GLfloat>(src.bottom().as_int()) /
                          buf_size.height.as_int();
 
     auto& vertices = rectangle.vertices;
-    vertices[0] = {{left,  top,    0.0f}, {0.0f,      0.0f}};
-    vertices[1] = {{left,  bottom, 0.0f}, {0.0f,      tex_bottom}};
-    vertices[2] = {{right, top,    0.0f}, {tex_right, 0.0f}};
+    vertices[0] = {{left,  top,    0.0f}, {tex_left,  tex_top}};
+    vertices[1] = {{left,  bottom, 0.0f}, {tex_left,  tex_bottom}};
+    vertices[2] = {{right, top,    0.0f}, {tex_right, tex_top}};
     vertices[3] = {{right, bottom, 0.0f}, {tex_right, tex_bottom}};
     return rectangle;
 }
@@ -33,6 +33,7 @@
 #include "mir/events/keymap_event.h"
 #include "mir/events/touch_event.h"
 #include "mir/events/pointer_event.h"
+#include "mir/events/touchpad_gesture_event.h"
 #include "mir/events/orientation_event.h"
 #include "mir/events/prompt_session_event.h"
 #include "mir/events/resize_event.h"
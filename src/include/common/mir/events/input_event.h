@@ -49,6 +49,9 @@ struct MirInputEvent : MirEvent
     MirTouchEvent* to_touch();
     MirTouchEvent const* to_touch() const;
 
+    MirTouchpadGestureEvent* to_touchpad_gesture();
+    MirTouchpadGestureEvent const* to_touchpad_gesture() const;
+
 protected:
     MirInputEvent(MirInputDeviceId dev,
                   std::chrono::nanoseconds et,
@@ -51,6 +51,13 @@ struct MirPointerEvent : MirInputEvent
     float dy() const;
     void set_dy(float y);
 
+    /// The relative motion before pointer acceleration, which defaults to dx() and dy()
+    float dx_unaccelerated() const;
+    void set_dx_unaccelerated(float x);
+
+    float dy_unaccelerated() const;
+    void set_dy_unaccelerated(float y);
+
     float vscroll() const;
     void set_vscroll(float v);
 
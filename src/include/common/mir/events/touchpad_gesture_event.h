@@ -0,0 +1,62 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_COMMON_TOUCHPAD_GESTURE_EVENT_H_
+#define MIR_COMMON_TOUCHPAD_GESTURE_EVENT_H_
+
+#include "mir/events/input_event.h"
+
+struct MirTouchpadGestureEvent : MirInputEvent
+{
+    MirTouchpadGestureEvent();
+    MirTouchpadGestureEvent(MirInputDeviceId dev,
+                            std::chrono::nanoseconds et,
+                            MirInputEventModifiers mods,
+                            MirTouchpadGesture gesture,
+                            MirTouchpadGestureAction action,
+                            unsigned int finger_count,
+                            float dx,
+                            float dy,
+                            float scale,
+                            float rotation,
+                            bool cancelled);
+
+    MirTouchpadGesture gesture() const;
+    void set_gesture(MirTouchpadGesture gesture);
+
+    MirTouchpadGestureAction action() const;
+    void set_action(MirTouchpadGestureAction action);
+
+    unsigned int finger_count() const;
+    void set_finger_count(unsigned int count);
+
+    float dx() const;
+    void set_dx(float dx);
+
+    float dy() const;
+    void set_dy(float dy);
+
+    float scale() const;
+    void set_scale(float scale);
+
+    float rotation() const;
+    void set_rotation(float rotation);
+
+    bool cancelled() const;
+    void set_cancelled(bool cancelled);
+};
+
+#endif /* MIR_COMMON_TOUCHPAD_GESTURE_EVENT_H_ */
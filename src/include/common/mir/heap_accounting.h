@@ -0,0 +1,92 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_HEAP_ACCOUNTING_H_
+#define MIR_HEAP_ACCOUNTING_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mir
+{
+/**
+ * Accounts heap use to the subsystem that made each allocation.
+ *
+ * Code tags the work it does with a Scope; allocations made on that thread while the scope
+ * is alive are charged to its subsystem, and stay charged to it until they are freed
+ * (wherever that happens). Untagged allocations are charged to Subsystem::other.
+ *
+ * Counting needs the accounting allocator (libmirheapaccounting, loaded with LD_PRELOAD),
+ * which replaces operator new and delete. Without it scopes cost a thread-local store and
+ * nothing is counted.
+ */
+namespace heap_accounting
+{
+enum class Subsystem : uint8_t
+{
+    other,
+    compositor,
+    renderer,
+    wayland,
+    window_management,
+    input,
+    decorations,
+    xwayland,
+    count
+};
+
+auto name_of(Subsystem subsystem) -> char const*;
+
+/// Charges allocations made by this thread to subsystem for the lifetime of the scope
+class Scope
+{
+public:
+    explicit Scope(Subsystem subsystem) noexcept;
+    ~Scope() noexcept;
+
+private:
+    Scope(Scope const&) = delete;
+    Scope& operator=(Scope const&) = delete;
+
+    Subsystem const enclosing;
+};
+
+struct Usage
+{
+    size_t bytes_in_use;
+    size_t blocks_in_use;
+    uint64_t bytes_allocated;   ///< Since startup; the difference between samples gives the allocation rate
+    uint64_t allocations;       ///< Since startup
+};
+
+/// Whether the accounting allocator is counting allocations in this process
+auto enabled() -> bool;
+
+auto usage_of(Subsystem subsystem) -> Usage;
+
+/**
+ * \name Accounting allocator hooks
+ * These must not allocate.
+ * @{ */
+/// Charges an allocation to the current thread's subsystem, which is returned
+auto charge_allocation(size_t size) noexcept -> Subsystem;
+/// Credits a deallocation back to the subsystem charge_allocation() returned
+void credit_deallocation(Subsystem subsystem, size_t size) noexcept;
+/** @} */
+}
+}
+
+#endif // MIR_HEAP_ACCOUNTING_H_
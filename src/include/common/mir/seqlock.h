@@ -0,0 +1,97 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_SEQLOCK_H_
+#define MIR_SEQLOCK_H_
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace mir
+{
+/**
+ * Publishes a small value to any number of readers that never block the writer or each other.
+ *
+ * Readers retry if they overlap a store, so this suits values that are read far more often than
+ * they change (e.g. frame timings). The layout holds no pointers and only lock-free atomics, so it
+ * can also be placed in memory shared between processes.
+ *
+ * Only one thread may store at a time.
+ */
+template<typename T>
+class SeqLock
+{
+public:
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock values are copied bytewise");
+    static_assert(std::is_default_constructible<T>::value, "SeqLock values must be default constructible");
+
+    SeqLock() : SeqLock(T{}) {}
+
+    explicit SeqLock(T const& initial)
+    {
+        store(initial);
+    }
+
+    void store(T const& value)
+    {
+        Word buffer[word_count]{};
+        std::memcpy(buffer, &value, sizeof(T));
+
+        auto const seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);  // odd: a store is in progress
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (unsigned i = 0; i != word_count; ++i)
+            words[i].store(buffer[i], std::memory_order_relaxed);
+
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    auto load() const -> T
+    {
+        Word buffer[word_count];
+
+        for (;;)
+        {
+            auto const before = sequence.load(std::memory_order_acquire);
+            if (before & 1)
+                continue;
+
+            for (unsigned i = 0; i != word_count; ++i)
+                buffer[i] = words[i].load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == before)
+                break;
+        }
+
+        T value;
+        std::memcpy(&value, buffer, sizeof(T));
+        return value;
+    }
+
+private:
+    using Word = std::uint64_t;
+    static unsigned const word_count = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+    std::atomic<std::uint32_t> sequence{0};
+    std::atomic<Word> words[word_count];
+};
+}
+
+#endif /* MIR_SEQLOCK_H_ */
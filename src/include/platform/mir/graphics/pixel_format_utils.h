@@ -39,6 +39,8 @@ int blue_channel_depth(MirPixelFormat format);
 int green_channel_depth(MirPixelFormat format);
 int alpha_channel_depth(MirPixelFormat format);
 bool valid_pixel_format(MirPixelFormat format);
+/// Whether the format holds YUV (rather than RGB) samples
+bool is_yuv(MirPixelFormat format);
 /*!
  * \}
  */
@@ -0,0 +1,49 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_GRAPHICS_YUV_TO_RGBA_H_
+#define MIR_GRAPHICS_YUV_TO_RGBA_H_
+
+namespace mir
+{
+namespace graphics
+{
+namespace gl
+{
+/**
+ * GLSL defining vec4 yuv_to_rgba(in float y, in float u, in float v), which converts
+ * BT.601 limited-range YUV samples (as video decoders produce) to opaque RGBA.
+ *
+ * Prepend this to a ProgramFactory::compile_fragment_shader() fragment whose
+ * sample_to_rgba() samples the Y, U and V planes.
+ */
+char const* const yuv_to_rgba_fragment =
+    "vec4 yuv_to_rgba(in float y, in float u, in float v)\n"
+    "{\n"
+    "    float luma = 1.16438356 * (y - 0.0625);\n"
+    "    float cb = u - 0.5;\n"
+    "    float cr = v - 0.5;\n"
+    "    return vec4(\n"
+    "        luma + 1.59602679 * cr,\n"
+    "        luma - 0.39176229 * cb - 0.81296764 * cr,\n"
+    "        luma + 2.01723214 * cb,\n"
+    "        1.0);\n"
+    "}\n";
+}
+}
+}
+
+#endif // MIR_GRAPHICS_YUV_TO_RGBA_H_
@@ -43,7 +43,10 @@ public:
     virtual ~BufferStream() = default;
 
     virtual auto lock_compositor_buffer(void const* user_id) -> std::shared_ptr<graphics::Buffer> = 0;
+    /// The size the stream is shown at, which is the buffer size unless a viewport is set
     virtual auto stream_size() -> geometry::Size = 0;
+    /// The region of the current buffer that is scaled to stream_size()
+    virtual auto src_bounds() -> geometry::Rectangle = 0;
     virtual auto buffers_ready_for_compositor(void const* user_id) const -> int = 0;
     virtual void drop_old_buffers() = 0;
     virtual auto has_submitted_buffer() const -> bool = 0;
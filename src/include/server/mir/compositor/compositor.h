@@ -21,6 +21,7 @@
 
 namespace mir
 {
+namespace graphics { class DisplaySyncGroup; }
 namespace compositor
 {
 
@@ -32,6 +33,11 @@ public:
     virtual void start() = 0;
     virtual void stop() = 0;
 
+    /// Starts compositing to a sync group the display has just created (if the compositor is started)
+    virtual void add_display_sync_group(graphics::DisplaySyncGroup& group) = 0;
+    /// Stops compositing to a sync group the display is about to destroy. Returns once the group is no longer used.
+    virtual void remove_display_sync_group(graphics::DisplaySyncGroup& group) = 0;
+
 protected:
     Compositor() = default;
     Compositor(Compositor const&) = delete;
@@ -36,8 +36,13 @@ public:
     virtual ~SceneElement() = default;
 
     virtual std::shared_ptr<graphics::Renderable> renderable() const = 0;
+
+    /// Report whether the element was drawn. A surface is exposed once any of its elements is
+    /// rendered, and occluded once all of them are occluded; until then its visibility is unchanged.
+    ///@{
     virtual void rendered() = 0;
     virtual void occluded() = 0;
+    ///@}
 
 protected:
     SceneElement() = default;
@@ -86,6 +86,7 @@ class Shell;
 class ShellReport;
 class SurfaceStack;
 class PersistentSurfaceStore;
+class IdleHandler;
 namespace decoration { class Manager; }
 namespace detail { class FrontendShell; }
 }
@@ -111,6 +112,7 @@ class SceneReport;
 class PromptSessionListener;
 class PromptSessionManager;
 class CoordinateTranslator;
+class IdleHub;
 }
 namespace graphics
 {
@@ -118,6 +120,7 @@ class Platform;
 class Display;
 class DisplayReport;
 class DisplayConfigurationObserver;
+class FrameTimingTracker;
 class GraphicBufferAllocator;
 class Cursor;
 class CursorImage;
@@ -220,6 +223,7 @@ public:
     virtual std::shared_ptr<scene::ApplicationNotRespondingDetector>
         wrap_application_not_responding_detector(
             std::shared_ptr<scene::ApplicationNotRespondingDetector> const& wrapped);
+    std::shared_ptr<shell::IdleHandler> the_idle_handler() override;
     /** @} */
 
     /** @name graphics configuration - customization
@@ -242,6 +246,8 @@ public:
     virtual std::shared_ptr<input::CursorImages> the_cursor_images();
     std::shared_ptr<ObserverRegistrar<graphics::DisplayConfigurationObserver>>
         the_display_configuration_observer_registrar();
+    /// Fed from the_display_report(), so only tracks frames if that isn't overridden
+    std::shared_ptr<graphics::FrameTimingTracker> the_frame_timing_tracker();
 
     /** @} */
 
@@ -328,6 +334,7 @@ public:
      *  @{ */
     virtual std::shared_ptr<scene::SessionCoordinator>  the_session_coordinator();
     virtual std::shared_ptr<scene::CoordinateTranslator> the_coordinate_translator();
+    virtual std::shared_ptr<scene::IdleHub>             the_idle_hub();
     /** @} */
 
 
@@ -447,6 +454,7 @@ protected:
     CachedPtr<compositor::CompositorReport> compositor_report;
     CachedPtr<logging::Logger> logger;
     CachedPtr<graphics::DisplayReport> display_report;
+    CachedPtr<graphics::FrameTimingTracker> frame_timing_tracker;
     CachedPtr<time::Clock> clock;
     CachedPtr<MainLoop> main_loop;
     CachedPtr<ServerStatusListener> server_status_listener;
@@ -466,6 +474,8 @@ protected:
     CachedPtr<shell::ShellReport> shell_report;
     CachedPtr<shell::decoration::Manager> decoration_manager;
     CachedPtr<scene::ApplicationNotRespondingDetector> application_not_responding_detector;
+    CachedPtr<scene::IdleHub> idle_hub;
+    CachedPtr<shell::IdleHandler> idle_handler;
     CachedPtr<cookie::Authority> cookie_authority;
     CachedPtr<input::KeyMapper> key_mapper;
     std::shared_ptr<ConsoleServices> console_services;
@@ -21,7 +21,8 @@
 
 #include <mir_toolkit/common.h>
 #include "mir/graphics/buffer_id.h"
-#include "mir/geometry/size.h"
+#include "mir/geometry/rectangle.h"
+#include <experimental/optional>
 #include <functional>
 #include <memory>
 
@@ -55,6 +56,16 @@ public:
     //      side once we only support the NBS system.
     virtual void allow_framedropping(bool) = 0;
     virtual void set_scale(float scale) = 0;
+
+    /**
+     * Crop and scale the buffers of the stream (as wp_viewport does).
+     *
+     * \param [in] source       The region of the buffer to show, or nullopt for the whole buffer
+     * \param [in] destination  The size to show it at, or nullopt for the size of the region
+     */
+    virtual void set_viewport(
+        std::experimental::optional<geometry::Rectangle> const& source,
+        std::experimental::optional<geometry::Size> const& destination) = 0;
 protected:
     BufferStream() = default;
     BufferStream(BufferStream const&) = delete;
@@ -159,16 +159,14 @@ public:
 private:
     void execute_with_context_as_thread_default(std::function<void()> code);
 
-    bool should_process_actions_for(void const* owner);
     void handle_exception(std::exception_ptr const& e);
 
     std::shared_ptr<time::Clock> const clock;
     detail::GMainContextHandle const main_context;
     std::atomic<bool> running_;
+    detail::ServerActionSources server_actions;
     detail::FdSources fd_sources;
     detail::SignalSources signal_sources;
-    std::mutex do_not_process_mutex;
-    std::vector<void const*> do_not_process;
     std::mutex run_on_halt_mutex;
     std::deque<ServerAction> run_on_halt_queue;
     std::function<void()> before_iteration_hook;
@@ -67,11 +67,6 @@ private:
 void add_idle_gsource(
     GMainContext* main_context, int priority, std::function<void()> const& callback);
 
-void add_server_action_gsource(
-    GMainContext* main_context,
-    void const* owner,
-    std::function<void()> const& action,
-    std::function<bool(void const*)> const& should_dispatch);
 
 GSourceHandle add_timer_gsource(
     GMainContext* main_context,
@@ -98,6 +93,27 @@ private:
     std::vector<std::unique_ptr<FdSource>> sources;
 };
 
+/// A single persistent source that runs enqueued actions in order
+///
+/// Enqueueing only appends to a queue; the first action of a burst wakes the source through an eventfd, and
+/// each dispatch runs everything queued so far. Actions of paused owners stay queued, in order, until resumed.
+class ServerActionSources
+{
+public:
+    ServerActionSources(GMainContext* main_context);
+    ~ServerActionSources();
+
+    void enqueue(void const* owner, std::function<void()> const& action);
+    void pause_processing_for(void const* owner);
+    void resume_processing_for(void const* owner);
+
+private:
+    struct ActionQueue;
+
+    std::shared_ptr<ActionQueue> const queue;
+    GSourceHandle gsource;
+};
+
 class SignalSources
 {
 public:
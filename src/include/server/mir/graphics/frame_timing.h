@@ -0,0 +1,48 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_GRAPHICS_FRAME_TIMING_H_
+#define MIR_GRAPHICS_FRAME_TIMING_H_
+
+#include "mir/optional_value.h"
+#include "mir/time/posix_timestamp.h"
+
+namespace mir
+{
+namespace graphics
+{
+/// When the outputs refresh, as reported by the display platform
+class FrameTiming
+{
+public:
+    FrameTiming() = default;
+    virtual ~FrameTiming() = default;
+
+    /**
+     * The first refresh after t of the fastest output that has refreshed recently
+     *
+     * \return nothing if no output has reported enough frames to know its refresh period
+     */
+    virtual auto next_frame_after(time::PosixTimestamp const& t) const -> optional_value<time::PosixTimestamp> = 0;
+
+private:
+    FrameTiming(FrameTiming const&) = delete;
+    FrameTiming& operator=(FrameTiming const&) = delete;
+};
+}
+}
+
+#endif /* MIR_GRAPHICS_FRAME_TIMING_H_ */
@@ -0,0 +1,78 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_GRAPHICS_FRAME_TIMING_TRACKER_H_
+#define MIR_GRAPHICS_FRAME_TIMING_TRACKER_H_
+
+#include "mir/graphics/frame_timing.h"
+#include "mir/graphics/display_report.h"
+#include "mir/graphics/frame.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace mir
+{
+namespace graphics
+{
+/// Works out each output's refresh period and phase from the frames it presents
+class FrameTimingTracker : public FrameTiming
+{
+public:
+    void frame_presented(unsigned int output_id, Frame const& frame);
+
+    auto next_frame_after(time::PosixTimestamp const& t) const -> optional_value<time::PosixTimestamp> override;
+
+private:
+    struct OutputTiming
+    {
+        Frame last_frame;
+        std::chrono::nanoseconds period{0};
+    };
+
+    std::mutex mutable mutex;
+    std::map<unsigned int, OutputTiming> outputs;
+};
+
+/// Passes vsyncs to a FrameTimingTracker as well as reporting them
+class FrameTimingDisplayReport : public DisplayReport
+{
+public:
+    FrameTimingDisplayReport(
+        std::shared_ptr<DisplayReport> const& wrapped,
+        std::shared_ptr<FrameTimingTracker> const& tracker);
+
+    void report_successful_setup_of_native_resources() override;
+    void report_successful_egl_make_current_on_construction() override;
+    void report_successful_egl_buffer_swap_on_construction() override;
+    void report_successful_display_construction() override;
+    void report_egl_configuration(EGLDisplay disp, EGLConfig cfg) override;
+    void report_vsync(unsigned int output_id, Frame const& f) override;
+    void report_successful_drm_mode_set_crtc_on_construction() override;
+    void report_drm_master_failure(int error) override;
+    void report_vt_switch_away_failure() override;
+    void report_vt_switch_back_failure() override;
+
+private:
+    std::shared_ptr<DisplayReport> const wrapped;
+    std::shared_ptr<FrameTimingTracker> const tracker;
+};
+}
+}
+
+#endif /* MIR_GRAPHICS_FRAME_TIMING_TRACKER_H_ */
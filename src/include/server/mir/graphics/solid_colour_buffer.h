@@ -0,0 +1,71 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_GRAPHICS_SOLID_COLOUR_BUFFER_H_
+#define MIR_GRAPHICS_SOLID_COLOUR_BUFFER_H_
+
+#include "mir/graphics/buffer_basic.h"
+
+#include <functional>
+#include <mutex>
+
+namespace mir
+{
+namespace graphics
+{
+/**
+ * A buffer every pixel of which is the same colour.
+ *
+ * There is no pixel storage behind it: renderers are expected to recognise it
+ * and fill its screen area with colour() rather than sampling a texture.
+ */
+class SolidColourBuffer : public BufferBasic, public NativeBufferBase
+{
+public:
+    /// Premultiplied RGBA, each component in [0, 1]
+    struct Colour
+    {
+        float r, g, b, a;
+    };
+
+    /**
+     * \param [in] size         The nominal size of the buffer
+     * \param [in] colour       The colour of every pixel
+     * \param [in] on_consumed  Called (once) when the colour is first drawn
+     */
+    SolidColourBuffer(geometry::Size size, Colour const& colour, std::function<void()>&& on_consumed);
+
+    std::shared_ptr<NativeBuffer> native_buffer_handle() const override;
+    geometry::Size size() const override;
+    MirPixelFormat pixel_format() const override;
+    NativeBufferBase* native_buffer_base() override;
+
+    auto colour() const -> Colour;
+
+    /// Called by the renderer after drawing the buffer
+    void mark_consumed();
+
+private:
+    geometry::Size const size_;
+    Colour const colour_;
+
+    std::mutex mutex;
+    std::function<void()> on_consumed;
+};
+}
+}
+
+#endif /* MIR_GRAPHICS_SOLID_COLOUR_BUFFER_H_ */
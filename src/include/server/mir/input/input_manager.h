@@ -32,6 +32,9 @@ public:
     virtual void stop() = 0;
     virtual void pause_for_config() = 0;
     virtual void continue_after_config() = 0;
+    /// Stop reading input devices that should not wake the system (e.g. touchscreens while the display is off)
+    virtual void suspend_non_wake_devices() = 0;
+    virtual void resume_non_wake_devices() = 0;
 
 protected:
     InputManager() {};
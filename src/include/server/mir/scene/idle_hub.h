@@ -0,0 +1,95 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_SCENE_IDLE_HUB_H_
+#define MIR_SCENE_IDLE_HUB_H_
+
+#include "mir/time/types.h"
+
+#include <memory>
+
+namespace mir
+{
+namespace scene
+{
+class IdleStateObserver
+{
+public:
+    IdleStateObserver() = default;
+    virtual ~IdleStateObserver() = default;
+
+    /// There has been no activity for the timeout the observer registered with
+    virtual void idle() = 0;
+
+    /// There has been activity since idle() was called
+    virtual void active() = 0;
+
+private:
+    IdleStateObserver(IdleStateObserver const&) = delete;
+    IdleStateObserver& operator=(IdleStateObserver const&) = delete;
+};
+
+/**
+ * Tracks user activity so that subsystems can stand down when nobody is using the system.
+ *
+ * Observers are notified without internal locks held, on whichever thread poked the hub or
+ * fired the timeout.
+ */
+class IdleHub
+{
+public:
+    /// The hub does not go idle while any WakeLock exists
+    class WakeLock
+    {
+    public:
+        WakeLock() = default;
+        virtual ~WakeLock() = default;
+
+    private:
+        WakeLock(WakeLock const&) = delete;
+        WakeLock& operator=(WakeLock const&) = delete;
+    };
+
+    IdleHub() = default;
+    virtual ~IdleHub() = default;
+
+    /// Notify the hub of activity, waking any idle observers and restarting the timeouts
+    virtual void poke() = 0;
+
+    /**
+     * Register an observer to be told when there has been no activity for \p timeout
+     *
+     * If the system has already been inactive for longer than \p timeout, idle() is called
+     * straight away. The hub does not take ownership of \p observer.
+     */
+    virtual void register_interest(std::weak_ptr<IdleStateObserver> const& observer, time::Duration timeout) = 0;
+    virtual void unregister_interest(IdleStateObserver const& observer) = 0;
+
+    /**
+     * Prevent the hub going idle until the returned WakeLock is released
+     *
+     * This does not wake a hub that is already idle (that needs a poke()).
+     */
+    virtual auto inhibit_idle() -> std::shared_ptr<WakeLock> = 0;
+
+private:
+    IdleHub(IdleHub const&) = delete;
+    IdleHub& operator=(IdleHub const&) = delete;
+};
+}
+}
+
+#endif // MIR_SCENE_IDLE_HUB_H_
@@ -23,6 +23,7 @@
 
 namespace mir
 {
+namespace geometry { struct Rectangle; }
 namespace scene
 {
 class Surface;
@@ -41,6 +42,11 @@ public:
     /// and will require full recomposition.
     virtual void scene_changed() = 0;
 
+    /// Used to indicate that something outside of any surface (e.g. an input
+    /// visualization) has changed within the damage area (in scene coordinates).
+    /// Only outputs overlapping the damage need to be recomposited.
+    virtual void scene_damaged(geometry::Rectangle const& damage) = 0;
+
     /// Called at observer registration to notify of already existing surfaces.
     virtual void surface_exists(std::shared_ptr<Surface> const& surface) = 0;
 
@@ -116,6 +116,14 @@ public:
 
     virtual void set_confine_pointer_state(MirPointerConfinementState state) = 0;
     virtual MirPointerConfinementState confine_pointer_state() const = 0;
+    /**
+     * Sets the region the pointer is confined to while confine_pointer_state() is
+     * mir_pointer_confined_to_window, relative to the top left of the content.
+     *
+     * An empty region (the default) confines the pointer to the whole surface.
+     */
+    virtual void set_confinement_region(std::vector<geometry::Rectangle> const& region) = 0;
+    virtual auto confinement_region() const -> std::vector<geometry::Rectangle> = 0;
 
     virtual void placed_relative(geometry::Rectangle const& placement) = 0;
     virtual void start_drag_and_drop(std::vector<uint8_t> const& handle) = 0;
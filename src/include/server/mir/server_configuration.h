@@ -42,6 +42,7 @@ namespace shell
 {
 class SessionContainer;
 class Shell;
+class IdleHandler;
 }
 namespace graphics
 {
@@ -88,6 +89,7 @@ public:
     virtual std::shared_ptr<cookie::Authority> the_cookie_authority() = 0;
     virtual auto the_fatal_error_strategy() -> void (*)(char const* reason, ...) = 0;
     virtual std::shared_ptr<scene::ApplicationNotRespondingDetector> the_application_not_responding_detector() = 0;
+    virtual std::shared_ptr<shell::IdleHandler> the_idle_handler() = 0;
     virtual std::function<void()> the_stop_callback() = 0;
     virtual void add_wayland_extension(
         std::string const& name,
@@ -103,6 +103,8 @@ struct SurfaceSpecification
     // Maybe SurfaceCreationParameters /HasA/ SurfaceSpecification?
     optional_value<MirShellChrome> shell_chrome;
     optional_value<MirPointerConfinementState> confine_pointer;
+    /// Relative to the content, an empty region is the whole surface (see scene::Surface::set_confinement_region())
+    optional_value<std::vector<geometry::Rectangle>> confinement_region;
     optional_value<std::shared_ptr<graphics::CursorImage>> cursor_image;
     /// \deprecated can be removed along with mirclient
     optional_value<StreamCursor> stream_cursor;
@@ -21,6 +21,7 @@
 
 #include "miral/window_manager_tools.h"
 
+#include <mir/heap_accounting.h>
 #include <mir/log.h>
 #include <mir/scene/session.h>
 #include <mir/scene/surface.h>
@@ -45,11 +46,13 @@ struct miral::BasicWindowManager::Locker
         policy->advise_end();
     }
 
+    mir::heap_accounting::Scope const heap_scope;
     std::lock_guard<std::mutex> const lock;
     WindowManagementPolicy* const policy;
 };
 
 miral::BasicWindowManager::Locker::Locker(BasicWindowManager* self) :
+    heap_scope{mir::heap_accounting::Subsystem::window_management},
     lock{self->mutex},
     policy{self->policy.get()}
 {
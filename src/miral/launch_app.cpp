@@ -19,202 +19,193 @@
 #include "launch_app.h"
 #include <mir/log.h>
 
+#include <signal.h>
+#include <spawn.h>
 #include <unistd.h>
 
-#include <stdexcept>
 #include <cstring>
+#include <map>
+#include <stdexcept>
 #include <vector>
 
 namespace
 {
-void strip_mir_env_variables()
+/// The complete environment for a launched app: ours, without MIR_* variables, with changes applied
+auto app_environment(miral::AppEnvironment const& changes) -> std::vector<std::string>
 {
     static char const mir_prefix[] = "MIR_";
 
-    std::vector<std::string> vars_to_remove;
+    std::map<std::string, std::string> env;
 
     for (auto var = environ; *var; ++var)
     {
-        auto const var_begin = *var;
-        if (strncmp(var_begin, mir_prefix, sizeof(mir_prefix) - 1) == 0)
+        if (strncmp(*var, mir_prefix, sizeof(mir_prefix) - 1) == 0)
+            continue;
+
+        if (auto const equals = strchr(*var, '='))
         {
-            if (auto var_end = strchr(var_begin, '='))
-            {
-                vars_to_remove.emplace_back(var_begin, var_end);
-            }
-            else
-            {
-                vars_to_remove.emplace_back(var_begin);
-            }
+            env[std::string(*var, equals)] = equals + 1;
         }
     }
 
-    for (auto const& var : vars_to_remove)
+    for (auto const& change : changes)
     {
-        unsetenv(var.c_str());
+        if (change.second)
+        {
+            env[change.first] = change.second.value();
+        }
+        else
+        {
+            env.erase(change.first);
+        }
     }
-}
-}
 
-auto miral::launch_app(
-    std::vector<std::string> const& app,
-    mir::optional_value<std::string> const& wayland_display,
-    mir::optional_value<std::string> const& mir_socket,
-    mir::optional_value<std::string> const& x11_display) -> pid_t
-{
-    pid_t pid = fork();
-
-    if (pid < 0)
+    std::vector<std::string> result;
+    for (auto const& var : env)
     {
-        throw std::runtime_error("Failed to fork process");
+        result.push_back(var.first + "=" + var.second);
     }
+    return result;
+}
 
-    if (pid == 0)
-    {
-        strip_mir_env_variables();
+auto c_strings(std::vector<std::string> const& strings) -> std::vector<char*>
+{
+    std::vector<char*> result;
+    for (auto const& string : strings)
+        result.push_back(const_cast<char*>(string.c_str()));
+    result.push_back(nullptr);
+    return result;
+}
 
-        std::string gdk_backend;
-        std::string qt_qpa_platform;
-        std::string sdl_videodriver;
+/// Starts the app as a child of this process, so that its pid can be waited for.
+/// \return the pid of the app, or -errno if it could not be started
+auto spawn(std::vector<std::string> const& app, std::vector<std::string> const& env) -> pid_t
+{
+    // Undo anything the launching process has done to signal handling
+    posix_spawnattr_t attr;
+    posix_spawnattr_init(&attr);
 
-        if (x11_display)
-        {
-            setenv("DISPLAY", x11_display.value().c_str(),  true);   // configure X11 socket
-            gdk_backend = "x11";
-            qt_qpa_platform = "xcb";
-            sdl_videodriver = "x11";
-        }
-        else
-        {
-            unsetenv("DISPLAY");
-        }
+    sigset_t signals;
+    sigemptyset(&signals);
+    posix_spawnattr_setsigmask(&attr, &signals);
+    sigfillset(&signals);
+    posix_spawnattr_setsigdefault(&attr, &signals);
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF);
 
-        if (mir_socket)
-        {
-            setenv("MIR_SOCKET", mir_socket.value().c_str(),  true);   // configure Mir socket
-            if (gdk_backend.empty())
-            {
-                gdk_backend = "mir";
-            }
-            else
-            {
-                gdk_backend = "mir," + gdk_backend;
-            }
-
-            qt_qpa_platform = "mir";
-        }
-        else
-        {
-            unsetenv("MIR_SOCKET");
-        }
+    auto const argv = c_strings(app);
+    auto const envp = c_strings(env);
 
-        if (wayland_display)
-        {
-            setenv("WAYLAND_DISPLAY", wayland_display.value().c_str(),  true);   // configure Wayland socket
-            if (gdk_backend.empty())
-            {
-                gdk_backend = "wayland";
-            }
-            else
-            {
-                gdk_backend = "wayland," + gdk_backend;
-            }
-            qt_qpa_platform = "wayland";
-            sdl_videodriver = "wayland";
-        }
-        else
-        {
-            unsetenv("WAYLAND_DISPLAY");
-        }
+    // posix_spawn() neither copies our address space nor runs our code (e.g. malloc()) in the child,
+    // so it is safe to use from a large, multithreaded server
+    pid_t pid;
+    auto const error = posix_spawnp(&pid, argv[0], nullptr, &attr, argv.data(), envp.data());
 
-        setenv("GDK_BACKEND", gdk_backend.c_str(), true);
-        setenv("QT_QPA_PLATFORM", qt_qpa_platform.c_str(), true);
-        setenv("SDL_VIDEODRIVER", sdl_videodriver.c_str(), true);
-        setenv("_JAVA_AWT_WM_NONREPARENTING", "1", true);
+    posix_spawnattr_destroy(&attr);
 
-        std::vector<char const*> exec_args;
+    return error ? -error : pid;
+}
 
-        for (auto const& arg : app)
-            exec_args.push_back(arg.c_str());
+auto launch(std::vector<std::string> const& app, miral::AppEnvironment const& changes) -> pid_t
+{
+    if (app.empty())
+        throw std::logic_error("No app to launch");
 
-        exec_args.push_back(nullptr);
+    auto const env = app_environment(changes);
 
-        execvp(exec_args[0], const_cast<char*const*>(exec_args.data()));
+    auto const pid = spawn(app, env);
 
-        mir::log_warning("Failed to execute client (\"%s\") error: %s", exec_args[0], strerror(errno));
-        exit(EXIT_FAILURE);
+    if (pid < 0)
+    {
+        // As when the app failed to exec in a forked child: callers (e.g. a key binding) needn't handle this
+        mir::log_warning("Failed to execute client (\"%s\"): %s", app[0].c_str(), strerror(-pid));
+        return -1;
     }
 
     return pid;
 }
 
-auto miral::launch_app_env(
-    std::vector<std::string> const& app, mir::optional_value<std::string> const& wayland_display,
-    mir::optional_value<std::string> const& mir_socket, mir::optional_value<std::string> const& x11_display,
-    miral::AppEnvironment const& app_env) -> pid_t
+void set_displays(
+    miral::AppEnvironment& env,
+    mir::optional_value<std::string> const& wayland_display,
+    mir::optional_value<std::string> const& mir_socket,
+    mir::optional_value<std::string> const& x11_display)
 {
-    pid_t pid = fork();
+    using std::experimental::nullopt;
 
-    if (pid < 0)
+    env["DISPLAY"] = x11_display ? x11_display.value() : miral::AppEnvironment::mapped_type{nullopt};
+    env["MIR_SOCKET"] = mir_socket ? mir_socket.value() : miral::AppEnvironment::mapped_type{nullopt};
+    env["WAYLAND_DISPLAY"] = wayland_display ? wayland_display.value() : miral::AppEnvironment::mapped_type{nullopt};
+}
+}
+
+auto miral::launch_app(
+    std::vector<std::string> const& app,
+    mir::optional_value<std::string> const& wayland_display,
+    mir::optional_value<std::string> const& mir_socket,
+    mir::optional_value<std::string> const& x11_display) -> pid_t
+{
+    AppEnvironment env;
+    set_displays(env, wayland_display, mir_socket, x11_display);
+
+    std::string gdk_backend;
+    std::string qt_qpa_platform;
+    std::string sdl_videodriver;
+
+    if (x11_display)
     {
-        throw std::runtime_error("Failed to fork process");
+        gdk_backend = "x11";
+        qt_qpa_platform = "xcb";
+        sdl_videodriver = "x11";
     }
 
-    if (pid == 0)
+    if (mir_socket)
     {
-        strip_mir_env_variables();
-
-        if (x11_display)
+        if (gdk_backend.empty())
         {
-            setenv("DISPLAY", x11_display.value().c_str(),  true);   // configure X11 socket
+            gdk_backend = "mir";
         }
         else
         {
-            unsetenv("DISPLAY");
+            gdk_backend = "mir," + gdk_backend;
         }
 
-        if (mir_socket)
-        {
-            setenv("MIR_SOCKET", mir_socket.value().c_str(),  true);   // configure Mir socket
-        }
-        else
-        {
-            unsetenv("MIR_SOCKET");
-        }
+        qt_qpa_platform = "mir";
+    }
 
-        if (wayland_display)
+    if (wayland_display)
+    {
+        if (gdk_backend.empty())
         {
-            setenv("WAYLAND_DISPLAY", wayland_display.value().c_str(),  true);   // configure Wayland socket
+            gdk_backend = "wayland";
         }
         else
         {
-            unsetenv("WAYLAND_DISPLAY");
-        }
-
-        for (auto const& env : app_env)
-        {
-            if (env.second)
-            {
-                setenv(env.first.c_str(), env.second.value().c_str(), true);
-            }
-            else
-            {
-                unsetenv(env.first.c_str());
-            }
+            gdk_backend = "wayland," + gdk_backend;
         }
+        qt_qpa_platform = "wayland";
+        sdl_videodriver = "wayland";
+    }
 
-        std::vector<char const*> exec_args;
-
-        for (auto const& arg : app)
-            exec_args.push_back(arg.c_str());
+    env["GDK_BACKEND"] = gdk_backend;
+    env["QT_QPA_PLATFORM"] = qt_qpa_platform;
+    env["SDL_VIDEODRIVER"] = sdl_videodriver;
+    env["_JAVA_AWT_WM_NONREPARENTING"] = std::string{"1"};
 
-        exec_args.push_back(nullptr);
+    return launch(app, env);
+}
 
-        execvp(exec_args[0], const_cast<char*const*>(exec_args.data()));
+auto miral::launch_app_env(
+    std::vector<std::string> const& app, mir::optional_value<std::string> const& wayland_display,
+    mir::optional_value<std::string> const& mir_socket, mir::optional_value<std::string> const& x11_display,
+    miral::AppEnvironment const& app_env) -> pid_t
+{
+    AppEnvironment env;
+    set_displays(env, wayland_display, mir_socket, x11_display);
 
-        mir::log_warning("Failed to execute client (\"%s\") error: %s", exec_args[0], strerror(errno));
-        exit(EXIT_FAILURE);
+    for (auto const& change : app_env)
+    {
+        env[change.first] = change.second;
     }
 
-    return pid;
+    return launch(app, env);
 }
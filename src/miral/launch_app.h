@@ -31,6 +31,7 @@
 
 namespace miral
 {
+/// \return the pid of the app, or -1 (after logging why) if it could not be started
 auto launch_app(std::vector<std::string> const& app,
                 mir::optional_value<std::string> const& wayland_display,
                 mir::optional_value<std::string> const& mir_socket,
@@ -20,6 +20,7 @@
 #include "join_client_threads.h"
 #include "launch_app.h"
 
+#include <mir/log.h>
 #include <mir/server.h>
 #include <mir/main_loop.h>
 #include <mir/report_exception.h>
@@ -149,7 +150,14 @@ void miral::MirRunner::Self::launch_startup_applications(::mir::Server& server)
 
                     mir::optional_value<std::string> x11_display = server.x11_display();
 
-                    launch_app(app, wayland_display, mir_socket, x11_display);
+                    try
+                    {
+                        launch_app(app, wayland_display, mir_socket, x11_display);
+                    }
+                    catch (std::exception const& error)
+                    {
+                        mir::log_warning("%s", error.what());
+                    }
 
                     if ((i = j) != end(value)) ++i;
                 }
@@ -36,6 +36,10 @@ namespace mo = mir::options;
 
 char const* const miral::WaylandExtensions::zwlr_layer_shell_v1{"zwlr_layer_shell_v1"};
 char const* const miral::WaylandExtensions::zxdg_output_manager_v1{"zxdg_output_manager_v1"};
+char const* const miral::WaylandExtensions::zwp_relative_pointer_manager_v1{"zwp_relative_pointer_manager_v1"};
+char const* const miral::WaylandExtensions::zwp_pointer_constraints_v1{"zwp_pointer_constraints_v1"};
+char const* const miral::WaylandExtensions::zwp_pointer_gestures_v1{"zwp_pointer_gestures_v1"};
+char const* const miral::WaylandExtensions::zwp_idle_inhibit_manager_v1{"zwp_idle_inhibit_manager_v1"};
 
 namespace
 {
@@ -31,18 +31,48 @@
 #include "mir/executor.h"
 #include "mir/graphics/program_factory.h"
 #include "mir/graphics/program.h"
+#include "mir/graphics/yuv_to_rgba.h"
 
 #include MIR_SERVER_GL_H
+#include MIR_SERVER_GLEXT_H
+
+#include <array>
+#include <string>
+
+#ifndef GL_TEXTURE_EXTERNAL_OES
+// From GL_OES_EGL_image_external, which desktop GL headers lack
+#define GL_TEXTURE_EXTERNAL_OES 0x8D65
+#endif
 
 namespace mg = mir::graphics;
 namespace geom = mir::geometry;
 
 namespace
 {
-GLuint get_tex_id()
+/// The number of planes (each imported as an EGLImage and texture) of an EGL_TEXTURE_FORMAT
+auto plane_count(EGLint egl_format) -> size_t
+{
+    switch (egl_format)
+    {
+    case EGL_TEXTURE_Y_UV_WL:
+    case EGL_TEXTURE_Y_XUXV_WL:
+        return 2;
+    case EGL_TEXTURE_Y_U_V_WL:
+        return 3;
+    default:
+        return 1;
+    }
+}
+
+auto texture_target(EGLint egl_format) -> GLenum
 {
-    GLuint tex;
-    glGenTextures(1, &tex);
+    return egl_format == EGL_TEXTURE_EXTERNAL_WL ? GL_TEXTURE_EXTERNAL_OES : GL_TEXTURE_2D;
+}
+
+auto get_tex_ids(size_t count) -> std::array<GLuint, 3>
+{
+    std::array<GLuint, 3> tex{};
+    glGenTextures(count, tex.data());
     return tex;
 }
 
@@ -115,57 +145,59 @@ public:
         std::function<void()>&& on_release,
         std::shared_ptr<mir::Executor> wayland_executor)
         : ctx{std::move(ctx)},
-          tex{get_tex_id()},
           on_consumed{std::move(on_consumed)},
           on_release{std::move(on_release)},
           size_{get_wl_buffer_size(buffer, *extensions.wayland)},
           layout_{get_texture_layout(buffer, *extensions.wayland)},
           egl_format{get_wl_egl_format(buffer, *extensions.wayland)},
+          planes{plane_count(egl_format)},
+          target{texture_target(egl_format)},
+          tex{get_tex_ids(planes)},
           wayland_executor{std::move(wayland_executor)}
     {
-        if (egl_format != EGL_TEXTURE_RGB && egl_format != EGL_TEXTURE_RGBA)
-        {
-            BOOST_THROW_EXCEPTION((std::runtime_error{"YUV textures unimplemented"}));
-        }
         eglBindAPI(MIR_SERVER_EGL_OPENGL_API);
 
-        const EGLint image_attrs[] =
-            {
-                EGL_IMAGE_PRESERVED_KHR, EGL_TRUE,
-                EGL_WAYLAND_PLANE_WL, 0,
-                EGL_NONE
-            };
-
-        auto egl_image = extensions.eglCreateImageKHR(
-            eglGetCurrentDisplay(),
-            EGL_NO_CONTEXT,
-            EGL_WAYLAND_BUFFER_WL,
-            buffer,
-            image_attrs);
-
-        if (egl_image == EGL_NO_IMAGE_KHR)
-            BOOST_THROW_EXCEPTION(mg::egl_error("Failed to create EGLImage"));
-
-        glBindTexture(GL_TEXTURE_2D, tex);
-        extensions.glEGLImageTargetTexture2DOES(GL_TEXTURE_2D, egl_image);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-        // tex is now an EGLImage sibling, so we can free the EGLImage without
-        // freeing the backing data.
-        extensions.eglDestroyImageKHR(eglGetCurrentDisplay(), egl_image);
+        // YUV buffers are imported a plane at a time, and converted to RGB by shader()
+        for (auto plane = 0u; plane != planes; ++plane)
+        {
+            const EGLint image_attrs[] =
+                {
+                    EGL_IMAGE_PRESERVED_KHR, EGL_TRUE,
+                    EGL_WAYLAND_PLANE_WL, static_cast<EGLint>(plane),
+                    EGL_NONE
+                };
+
+            auto egl_image = extensions.eglCreateImageKHR(
+                eglGetCurrentDisplay(),
+                EGL_NO_CONTEXT,
+                EGL_WAYLAND_BUFFER_WL,
+                buffer,
+                image_attrs);
+
+            if (egl_image == EGL_NO_IMAGE_KHR)
+                BOOST_THROW_EXCEPTION(mg::egl_error("Failed to create EGLImage"));
+
+            glBindTexture(target, tex[plane]);
+            extensions.glEGLImageTargetTexture2DOES(target, egl_image);
+            glTexParameteri(target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+            // tex is now an EGLImage sibling, so we can free the EGLImage without
+            // freeing the backing data.
+            extensions.eglDestroyImageKHR(eglGetCurrentDisplay(), egl_image);
+        }
     }
 
     ~WaylandTexBuffer()
     {
         wayland_executor->spawn(
-            [context = ctx, tex = tex]()
+            [context = ctx, tex = tex, planes = planes]()
             {
               context->make_current();
 
-              glDeleteTextures(1, &tex);
+              glDeleteTextures(planes, tex.data());
 
               context->release_current();
             });
@@ -198,13 +230,12 @@ public:
             // Unspecified whether it has an alpha channel; say it does.
             return mir_pixel_format_argb_8888;
         case EGL_TEXTURE_Y_U_V_WL:
+            return mir_pixel_format_i420;
         case EGL_TEXTURE_Y_UV_WL:
-            // These are just absolutely not RGB at all!
-            // But they're defined to not have an alpha channel, so xrgb it is!
-            return mir_pixel_format_xrgb_8888;
+            return mir_pixel_format_nv12;
         case EGL_TEXTURE_Y_XUXV_WL:
-            // This is a planar format, but *does* have alpha.
-            return mir_pixel_format_argb_8888;
+            // The X is padding: shader() converts this to opaque RGB
+            return mir_pixel_format_yuyv;
         default:
             // We've covered all possibilities above
             BOOST_THROW_EXCEPTION((std::logic_error{"Unexpected texture format!"}));
@@ -218,18 +249,80 @@ public:
 
     mir::graphics::gl::Program const& shader(mir::graphics::gl::ProgramFactory& cache) const override
     {
-        static std::unique_ptr<mg::gl::Program> shader;
-        if (!shader)
+        switch (egl_format)
         {
-            shader = cache.compile_fragment_shader(
+        case EGL_TEXTURE_EXTERNAL_WL:
+        {
+            static auto const shader = cache.compile_fragment_shader(
+                "#ifdef GL_ES\n"
+                "#extension GL_OES_EGL_image_external : require\n"
+                "#endif\n",
+                "uniform samplerExternalOES tex;\n"
+                "vec4 sample_to_rgba(in vec2 texcoord)\n"
+                "{\n"
+                "    return texture2D(tex, texcoord);\n"
+                "}\n");
+            return *shader;
+        }
+
+        case EGL_TEXTURE_Y_UV_WL:
+        {
+            // Y is an R8 plane, UV a GR88 plane
+            static auto const shader = cache.compile_fragment_shader(
+                "",
+                (std::string{mg::gl::yuv_to_rgba_fragment} +
+                "uniform sampler2D tex[2];\n"
+                "vec4 sample_to_rgba(in vec2 texcoord)\n"
+                "{\n"
+                "    vec4 uv = texture2D(tex[1], texcoord);\n"
+                "    return yuv_to_rgba(texture2D(tex[0], texcoord).r, uv.r, uv.g);\n"
+                "}\n").c_str());
+            return *shader;
+        }
+
+        case EGL_TEXTURE_Y_U_V_WL:
+        {
+            static auto const shader = cache.compile_fragment_shader(
+                "",
+                (std::string{mg::gl::yuv_to_rgba_fragment} +
+                "uniform sampler2D tex[3];\n"
+                "vec4 sample_to_rgba(in vec2 texcoord)\n"
+                "{\n"
+                "    return yuv_to_rgba(\n"
+                "        texture2D(tex[0], texcoord).r,\n"
+                "        texture2D(tex[1], texcoord).r,\n"
+                "        texture2D(tex[2], texcoord).r);\n"
+                "}\n").c_str());
+            return *shader;
+        }
+
+        case EGL_TEXTURE_Y_XUXV_WL:
+        {
+            // Y is a GR88 plane, and the same YUYV bytes as an ARGB8888 plane give U in .g and V in .a
+            static auto const shader = cache.compile_fragment_shader(
+                "",
+                (std::string{mg::gl::yuv_to_rgba_fragment} +
+                "uniform sampler2D tex[2];\n"
+                "vec4 sample_to_rgba(in vec2 texcoord)\n"
+                "{\n"
+                "    vec4 xuxv = texture2D(tex[1], texcoord);\n"
+                "    return yuv_to_rgba(texture2D(tex[0], texcoord).r, xuxv.g, xuxv.a);\n"
+                "}\n").c_str());
+            return *shader;
+        }
+
+        default:
+        {
+            static auto const shader = cache.compile_fragment_shader(
                 "",
                 "uniform sampler2D tex;\n"
                 "vec4 sample_to_rgba(in vec2 texcoord)\n"
                 "{\n"
                 "    return texture2D(tex, texcoord);\n"
                 "}\n");
+            return *shader;
+        }
         }
-        return *shader;
     }
 
     Layout layout() const override
@@ -239,7 +332,12 @@ public:
 
     void bind() override
     {
-        glBindTexture(GL_TEXTURE_2D, tex);
+        // Planes go to consecutive texture units, to be sampled as tex[0], tex[1], …
+        for (auto plane = planes; plane-- != 0;)
+        {
+            glActiveTexture(GL_TEXTURE0 + plane);
+            glBindTexture(target, tex[plane]);
+        }
         on_consumed();
         on_consumed = [](){};
     }
@@ -249,7 +347,6 @@ public:
     }
 private:
     std::shared_ptr<mir::renderer::gl::Context> const ctx;
-    GLuint const tex;
 
     std::function<void()> on_consumed;
     std::function<void()> const on_release;
@@ -257,6 +354,9 @@ private:
     geom::Size const size_;
     Layout const layout_;
     EGLint const egl_format;
+    size_t const planes;
+    GLenum const target;
+    std::array<GLuint, 3> const tex;
 
     std::shared_ptr<mir::Executor> const wayland_executor;
 };
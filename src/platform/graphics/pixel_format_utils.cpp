@@ -24,18 +24,23 @@ const struct
 {
     MirPixelFormat mir_format;
     int red_bits, green_bits, blue_bits, alpha_bits;
+    bool yuv;
 } detail[mir_pixel_formats] =
 {
-    {mir_pixel_format_invalid,   0,0,0,0},
-    {mir_pixel_format_abgr_8888, 8,8,8,8},
-    {mir_pixel_format_xbgr_8888, 8,8,8,0},
-    {mir_pixel_format_argb_8888, 8,8,8,8},
-    {mir_pixel_format_xrgb_8888, 8,8,8,0},
-    {mir_pixel_format_bgr_888,   8,8,8,0},
-    {mir_pixel_format_rgb_888,   8,8,8,0},
-    {mir_pixel_format_rgb_565,   5,6,5,0},
-    {mir_pixel_format_rgba_5551, 5,5,5,1},
-    {mir_pixel_format_rgba_4444, 4,4,4,4},
+    {mir_pixel_format_invalid,   0,0,0,0, false},
+    {mir_pixel_format_abgr_8888, 8,8,8,8, false},
+    {mir_pixel_format_xbgr_8888, 8,8,8,0, false},
+    {mir_pixel_format_argb_8888, 8,8,8,8, false},
+    {mir_pixel_format_xrgb_8888, 8,8,8,0, false},
+    {mir_pixel_format_bgr_888,   8,8,8,0, false},
+    {mir_pixel_format_rgb_888,   8,8,8,0, false},
+    {mir_pixel_format_rgb_565,   5,6,5,0, false},
+    {mir_pixel_format_rgba_5551, 5,5,5,1, false},
+    {mir_pixel_format_rgba_4444, 4,4,4,4, false},
+    // YUV formats are converted to 8-bit-per-channel RGB
+    {mir_pixel_format_nv12,      8,8,8,0, true},
+    {mir_pixel_format_yuyv,      8,8,8,0, true},
+    {mir_pixel_format_i420,      8,8,8,0, true},
 };
 
 } // anonymous namespace
@@ -74,4 +79,9 @@ bool contains_alpha(MirPixelFormat format)
     return alpha_channel_depth(format);
 }
 
+bool is_yuv(MirPixelFormat f)
+{
+    return valid_pixel_format(f) && detail[f].yuv;
+}
+
 } } // namespace mir::graphics
@@ -53,6 +53,9 @@ char const* const mo::enable_key_repeat_opt       = "enable-key-repeat";
 char const* const mo::x11_display_opt             = "enable-x11";
 char const* const mo::wayland_extensions_opt      = "wayland-extensions";
 char const* const mo::enable_mirclient_opt        = "enable-mirclient";
+char const* const mo::idle_timeout_opt            = "idle-timeout";
+char const* const mo::kinetic_scroll_opt          = "kinetic-scroll";
+char const* const mo::heap_accounting_period_opt  = "heap-accounting-period";
 
 char const* const mo::off_opt_value = "off";
 char const* const mo::log_opt_value = "log";
@@ -198,6 +201,14 @@ mo::DefaultConfiguration::DefaultConfiguration(
             "Cursor (mouse pointer) to use [{auto,null,software}]")
         (enable_key_repeat_opt, po::value<bool>()->default_value(true),
              "Enable server generated key repeat")
+        (kinetic_scroll_opt, po::value<bool>()->default_value(false),
+             "Continue touchpad scrolling after the fingers lift, slowing down smoothly")
+        (idle_timeout_opt, po::value<int>()->default_value(0),
+            "Seconds without input before outputs are dimmed and then turned off. "
+            "Default: 0 means never.")
+        (heap_accounting_period_opt, po::value<int>()->default_value(0),
+            "Seconds between logging the heap use of each subsystem "
+            "(needs libmirheapaccounting.so in LD_PRELOAD). Default: 0 means never.")
         (fatal_except_opt, "On \"fatal error\" conditions [e.g. drivers behaving "
             "in unexpected ways] throw an exception (instead of a core dump)")
         (debug_opt, "Enable extra development debugging. "
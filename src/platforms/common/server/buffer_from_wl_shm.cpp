@@ -71,6 +71,11 @@ MirPixelFormat wl_format_to_mir_format(uint32_t format)
         return mir_pixel_format_xbgr_8888;
     case WL_SHM_FORMAT_ABGR8888:
         return mir_pixel_format_abgr_8888;
+    /* Planar formats (NV12, YUV420) are deliberately absent: libwayland only checks that
+     * stride × height is within the pool, which doesn't cover their chroma planes.
+     */
+    case WL_SHM_FORMAT_YUYV:
+        return mir_pixel_format_yuyv;
     default:
         return mir_pixel_format_invalid;
     }
@@ -21,6 +21,7 @@
 #include "shm_buffer.h"
 #include "mir/graphics/program_factory.h"
 #include "mir/graphics/program.h"
+#include "mir/graphics/yuv_to_rgba.h"
 #include "egl_context_executor.h"
 
 #define MIR_LOG_COMPONENT "gfx-common"
@@ -32,6 +33,8 @@
 #include <boost/throw_exception.hpp>
 
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <string.h>
 #include <endian.h>
@@ -70,6 +73,10 @@ bool mg::get_gl_pixel_format(MirPixelFormat mir_format,
         {mir_pixel_format_rgb_565,   GL_RGB,          GL_UNSIGNED_SHORT_5_6_5},
         {mir_pixel_format_rgba_5551, GL_RGBA,         GL_UNSIGNED_SHORT_5_5_5_1},
         {mir_pixel_format_rgba_4444, GL_RGBA,         GL_UNSIGNED_SHORT_4_4_4_4},
+        // YUYV is uploaded as two textures, see planes_of(). Planar YUV only comes from EGL Wayland buffers.
+        {mir_pixel_format_nv12,      GL_INVALID_ENUM, GL_INVALID_ENUM},
+        {mir_pixel_format_yuyv,      GL_INVALID_ENUM, GL_INVALID_ENUM},
+        {mir_pixel_format_i420,      GL_INVALID_ENUM, GL_INVALID_ENUM},
     };
 
     if (mir_format > mir_pixel_format_invalid &&
@@ -88,10 +95,46 @@ bool mg::get_gl_pixel_format(MirPixelFormat mir_format,
     return gl_format != GL_INVALID_ENUM && gl_type != GL_INVALID_ENUM;
 }
 
+namespace
+{
+/// A view of a YUYV image, uploaded as a texture of unsigned bytes
+struct Plane
+{
+    GLenum gl_format;
+    int bytes_per_texel;
+    geom::Width width;
+    geom::Height height;
+    geom::Stride stride;
+    size_t offset;
+};
+
+/**
+ * The textures a YUYV image is uploaded as, in the texture units its shader samples them from:
+ * the same bytes twice, as Y,U|Y,V pairs for full-resolution Y and as Y,U,Y,V quads for U and V.
+ *
+ * Luminance textures put their sample in .r (and .a for LUMINANCE_ALPHA), so these are
+ * sampleable on GLES2 without the texture_rg extension.
+ *
+ * Planar formats (NV12, I420) are not supported here: the only shm buffers that could carry
+ * them are wl_shm ones, and libwayland doesn't check their chroma planes fit in the pool.
+ */
+auto planes_of(geom::Size size, geom::Stride stride) -> std::vector<Plane>
+{
+    return {
+        {GL_LUMINANCE_ALPHA, 2, size.width, size.height, stride, 0},
+        {GL_RGBA, 4, geom::Width{size.width.as_int() / 2}, size.height, stride, 0}};
+}
+
+auto texture_count(MirPixelFormat format) -> size_t
+{
+    return format == mir_pixel_format_yuyv ? 2 : 1;
+}
+}
+
 bool mgc::ShmBuffer::supports(MirPixelFormat mir_format)
 {
     GLenum gl_format, gl_type;
-    return mg::get_gl_pixel_format(mir_format, gl_format, gl_type);
+    return mg::get_gl_pixel_format(mir_format, gl_format, gl_type) || mir_format == mir_pixel_format_yuyv;
 }
 
 mgc::ShmBuffer::ShmBuffer(
@@ -110,18 +153,19 @@ mgc::MemoryBackedShmBuffer::MemoryBackedShmBuffer(
     std::shared_ptr<EGLContextExecutor> egl_delegate)
     : ShmBuffer(size, pixel_format, std::move(egl_delegate)),
       stride_{MIR_BYTES_PER_PIXEL(pixel_format) * size.width.as_uint32_t()},
-      pixels{new unsigned char[stride_.as_int() * size.height.as_int()]}
+      pixels_size{stride_.as_uint32_t() * size.height.as_uint32_t()},
+      pixels{new unsigned char[pixels_size]}
 {
 }
 
 mgc::ShmBuffer::~ShmBuffer() noexcept
 {
-    if (tex_id != 0)
+    if (tex_ids[0] != 0)
     {
         egl_delegate->spawn(
-            [id = tex_id]()
+            [ids = tex_ids, count = texture_count(pixel_format_)]()
             {
-                glDeleteTextures(1, &id);
+                glDeleteTextures(count, ids.data());
             });
     }
 }
@@ -175,6 +219,10 @@ void mgc::ShmBuffer::upload_to_texture(void const* pixels, geom::Stride const& s
         glPixelStorei(GL_UNPACK_ROW_LENGTH_EXT, 0);     // 0 is default, meaning “use width”
         glPixelStorei(GL_UNPACK_ALIGNMENT, 4);          // 4 is default; word alignment.
     }
+    else if (pixel_format_ == mir_pixel_format_yuyv)
+    {
+        upload_planes(static_cast<unsigned char const*>(pixels), stride);
+    }
     else
     {
         mir::log_error(
@@ -184,9 +232,38 @@ void mgc::ShmBuffer::upload_to_texture(void const* pixels, geom::Stride const& s
     }
 }
 
+void mgc::ShmBuffer::upload_planes(unsigned char const* pixels, geom::Stride const& stride)
+{
+    auto const planes = planes_of(size(), stride);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    for (auto i = 0u; i != planes.size(); ++i)
+    {
+        auto const& plane = planes[i];
+
+        glActiveTexture(GL_TEXTURE0 + i);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH_EXT, plane.stride.as_int() / plane.bytes_per_texel);
+        glTexImage2D(
+            GL_TEXTURE_2D,
+            0,
+            plane.gl_format,
+            plane.width.as_int(), plane.height.as_int(),
+            0,
+            plane.gl_format,
+            GL_UNSIGNED_BYTE,
+            pixels + plane.offset);
+    }
+
+    // Be nice to other users of the GL context by reverting our changes to shared state
+    glActiveTexture(GL_TEXTURE0);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH_EXT, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
 void mgc::MemoryBackedShmBuffer::write(unsigned char const* data, size_t data_size)
 {
-    if (data_size != stride_.as_uint32_t()*size().height.as_uint32_t())
+    if (data_size != pixels_size)
         BOOST_THROW_EXCEPTION(std::logic_error("Size is not equal to number of pixels in buffer"));
     memcpy(pixels.get(), data, data_size);
 }
@@ -203,19 +280,26 @@ mg::NativeBufferBase* mgc::ShmBuffer::native_buffer_base()
 
 void mgc::ShmBuffer::bind()
 {
-    bool const needs_initialisation = tex_id == 0;
+    auto const count = texture_count(pixel_format_);
+    bool const needs_initialisation = tex_ids[0] == 0;
     if (needs_initialisation)
     {
-        glGenTextures(1, &tex_id);
+        glGenTextures(count, tex_ids.data());
     }
-    glBindTexture(GL_TEXTURE_2D, tex_id);
-    if (needs_initialisation)
+
+    // YUYV's textures are bound to consecutive texture units, to be sampled as tex[0] and tex[1]
+    for (auto i = count; i-- != 0;)
     {
-        // The ShmBuffer *should* be immutable, so we can just upload once.
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glActiveTexture(GL_TEXTURE0 + i);
+        glBindTexture(GL_TEXTURE_2D, tex_ids[i]);
+        if (needs_initialisation)
+        {
+            // The ShmBuffer *should* be immutable, so we can just upload once.
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        }
     }
 }
 
@@ -232,15 +316,36 @@ auto mgc::MemoryBackedShmBuffer::native_buffer_handle() const -> std::shared_ptr
 
 mg::gl::Program const& mgc::ShmBuffer::shader(mg::gl::ProgramFactory& cache) const
 {
-    static auto const program = cache.compile_fragment_shader(
-        "",
-        "uniform sampler2D tex;\n"
-        "vec4 sample_to_rgba(in vec2 texcoord)\n"
-        "{\n"
-        "    return texture2D(tex, texcoord);\n"
-        "}\n");
+    switch (pixel_format_)
+    {
+    case mir_pixel_format_yuyv:
+    {
+        static auto const program = cache.compile_fragment_shader(
+            "",
+            (std::string{gl::yuv_to_rgba_fragment} +
+            "uniform sampler2D tex[2];\n"
+            "vec4 sample_to_rgba(in vec2 texcoord)\n"
+            "{\n"
+            "    vec4 yuyv = texture2D(tex[1], texcoord);\n"
+            "    return yuv_to_rgba(texture2D(tex[0], texcoord).r, yuyv.g, yuyv.a);\n"
+            "}\n").c_str());
+
+        return *program;
+    }
 
-    return *program;
+    default:
+    {
+        static auto const program = cache.compile_fragment_shader(
+            "",
+            "uniform sampler2D tex;\n"
+            "vec4 sample_to_rgba(in vec2 texcoord)\n"
+            "{\n"
+            "    return texture2D(tex, texcoord);\n"
+            "}\n");
+
+        return *program;
+    }
+    }
 }
 
 auto mgc::ShmBuffer::layout() const -> Layout
@@ -31,6 +31,8 @@
 
 #include MIR_SERVER_GL_H
 
+#include <array>
+
 namespace mir
 {
 class ShmFile;
@@ -68,10 +70,14 @@ protected:
     /// \note This must be called with a current GL context
     void upload_to_texture(void const* pixels, geometry::Stride const& stride);
 private:
+    /// Uploads each view of a YUYV image to the texture unit its shader samples
+    void upload_planes(unsigned char const* pixels, geometry::Stride const& stride);
+
     geometry::Size const size_;
     MirPixelFormat const pixel_format_;
     std::shared_ptr<EGLContextExecutor> const egl_delegate;
-    GLuint tex_id{0};
+    /// YUYV uses both; RGB formats just the first
+    std::array<GLuint, 2> tex_ids{};
 };
 
 class MemoryBackedShmBuffer :
@@ -96,6 +102,7 @@ public:
     MemoryBackedShmBuffer& operator=(MemoryBackedShmBuffer const&) = delete;
 private:
     geometry::Stride const stride_;
+    size_t const pixels_size;
     std::unique_ptr<unsigned char[]> const pixels;
 };
 
@@ -123,6 +123,34 @@ void mie::LibInputDevice::add_device_of_group(LibInputDevicePtr dev)
     update_device_info();
 }
 
+bool mie::LibInputDevice::is_wake_device() const
+{
+    return contains(info.capabilities, mi::DeviceCapability::keyboard) ||
+           contains(info.capabilities, mi::DeviceCapability::pointer);
+}
+
+void mie::LibInputDevice::suspend_events(bool suspend)
+{
+    if (suspend)
+    {
+        if (!send_events_modes_before_suspend.empty())
+            return;
+
+        for (auto const& dev : devices)
+        {
+            send_events_modes_before_suspend.push_back(libinput_device_config_send_events_get_mode(dev.get()));
+            libinput_device_config_send_events_set_mode(dev.get(), LIBINPUT_CONFIG_SEND_EVENTS_DISABLED);
+        }
+    }
+    else
+    {
+        for (auto i = 0u; i != send_events_modes_before_suspend.size() && i != devices.size(); ++i)
+            libinput_device_config_send_events_set_mode(devices[i].get(), send_events_modes_before_suspend[i]);
+
+        send_events_modes_before_suspend.clear();
+    }
+}
+
 mie::LibInputDevice::~LibInputDevice() = default;
 
 void mie::LibInputDevice::start(InputSink* sink, EventBuilder* builder)
@@ -180,6 +208,30 @@ void mie::LibInputDevice::process_event(libinput_event* event)
                 sink->handle_input(convert_touch_frame(libinput_event_get_touch_event(event)));
             }
             break;
+        case LIBINPUT_EVENT_GESTURE_SWIPE_BEGIN:
+            sink->handle_input(convert_gesture_event(
+                libinput_event_get_gesture_event(event), mir_touchpad_gesture_swipe, mir_touchpad_gesture_action_begin));
+            break;
+        case LIBINPUT_EVENT_GESTURE_SWIPE_UPDATE:
+            sink->handle_input(convert_gesture_event(
+                libinput_event_get_gesture_event(event), mir_touchpad_gesture_swipe, mir_touchpad_gesture_action_update));
+            break;
+        case LIBINPUT_EVENT_GESTURE_SWIPE_END:
+            sink->handle_input(convert_gesture_event(
+                libinput_event_get_gesture_event(event), mir_touchpad_gesture_swipe, mir_touchpad_gesture_action_end));
+            break;
+        case LIBINPUT_EVENT_GESTURE_PINCH_BEGIN:
+            sink->handle_input(convert_gesture_event(
+                libinput_event_get_gesture_event(event), mir_touchpad_gesture_pinch, mir_touchpad_gesture_action_begin));
+            break;
+        case LIBINPUT_EVENT_GESTURE_PINCH_UPDATE:
+            sink->handle_input(convert_gesture_event(
+                libinput_event_get_gesture_event(event), mir_touchpad_gesture_pinch, mir_touchpad_gesture_action_update));
+            break;
+        case LIBINPUT_EVENT_GESTURE_PINCH_END:
+            sink->handle_input(convert_gesture_event(
+                libinput_event_get_gesture_event(event), mir_touchpad_gesture_pinch, mir_touchpad_gesture_action_end));
+            break;
         default:
             break;
         }
@@ -229,16 +281,14 @@ mir::EventUPtr mie::LibInputDevice::convert_button_event(libinput_event_pointer*
 mir::EventUPtr mie::LibInputDevice::convert_motion_event(libinput_event_pointer* pointer)
 {
     std::chrono::nanoseconds const time = std::chrono::microseconds(libinput_event_pointer_get_time_usec(pointer));
-    auto const action = mir_pointer_action_motion;
-    auto const hscroll_value = 0.0f;
-    auto const vscroll_value = 0.0f;
 
     report->received_event_from_kernel(time.count(), EV_REL, 0, 0);
 
-    return builder->pointer_event(time, action, button_state,
-                                  hscroll_value, vscroll_value,
-                                  libinput_event_pointer_get_dx(pointer),
-                                  libinput_event_pointer_get_dy(pointer));
+    return builder->pointer_motion_event(time, button_state,
+                                         libinput_event_pointer_get_dx(pointer),
+                                         libinput_event_pointer_get_dy(pointer),
+                                         libinput_event_pointer_get_dx_unaccelerated(pointer),
+                                         libinput_event_pointer_get_dy_unaccelerated(pointer));
 }
 
 mir::EventUPtr mie::LibInputDevice::convert_absolute_motion_event(libinput_event_pointer* pointer)
@@ -304,6 +354,27 @@ mir::EventUPtr mie::LibInputDevice::convert_axis_event(libinput_event_pointer* p
                                   relative_y_value);
 }
 
+mir::EventUPtr mie::LibInputDevice::convert_gesture_event(
+    libinput_event_gesture* gesture_event,
+    MirTouchpadGesture gesture,
+    MirTouchpadGestureAction action)
+{
+    std::chrono::nanoseconds const time = std::chrono::microseconds(libinput_event_gesture_get_time_usec(gesture_event));
+    auto const finger_count = libinput_event_gesture_get_finger_count(gesture_event);
+    auto const is_pinch = gesture == mir_touchpad_gesture_pinch;
+    // libinput only reports cancellation, motion, scale and rotation for the stages they are defined on
+    auto const cancelled = action == mir_touchpad_gesture_action_end &&
+        libinput_event_gesture_get_cancelled(gesture_event);
+    auto const dx = action == mir_touchpad_gesture_action_end ? 0.0f : libinput_event_gesture_get_dx(gesture_event);
+    auto const dy = action == mir_touchpad_gesture_action_end ? 0.0f : libinput_event_gesture_get_dy(gesture_event);
+    auto const scale = is_pinch ? libinput_event_gesture_get_scale(gesture_event) : 1.0f;
+    auto const rotation = is_pinch ? libinput_event_gesture_get_angle_delta(gesture_event) : 0.0f;
+
+    report->received_event_from_kernel(time.count(), EV_ABS, 0, 0);
+
+    return builder->touchpad_gesture_event(time, gesture, action, finger_count, dx, dy, scale, rotation, cancelled);
+}
+
 mir::EventUPtr mie::LibInputDevice::convert_touch_frame(libinput_event_touch* touch)
 {
     std::chrono::nanoseconds const time = std::chrono::microseconds(libinput_event_touch_get_time_usec(touch));
@@ -35,6 +35,7 @@ struct libinput_event;
 struct libinput_event_keyboard;
 struct libinput_event_touch;
 struct libinput_event_pointer;
+struct libinput_event_gesture;
 struct libinput_device_group;
 
 namespace mir
@@ -67,6 +68,10 @@ public:
     ::libinput_device* device() const;
     ::libinput_device_group* group();
     void add_device_of_group(LibInputDevicePtr ptr);
+    /// Whether activity on this device should wake an idle system (keyboards and pointers)
+    bool is_wake_device() const;
+    /// Have libinput stop (or resume) sending events from the device, without closing it
+    void suspend_events(bool suspend);
 private:
     EventUPtr convert_event(libinput_event_keyboard* keyboard);
     EventUPtr convert_button_event(libinput_event_pointer* pointer);
@@ -74,6 +79,9 @@ private:
     EventUPtr convert_absolute_motion_event(libinput_event_pointer* pointer);
     EventUPtr convert_axis_event(libinput_event_pointer* pointer);
     EventUPtr convert_touch_frame(libinput_event_touch* touch);
+    EventUPtr convert_gesture_event(libinput_event_gesture* gesture_event,
+                                    MirTouchpadGesture gesture,
+                                    MirTouchpadGestureAction action);
     void handle_touch_down(libinput_event_touch* touch);
     void handle_touch_up(libinput_event_touch* touch);
     void handle_touch_motion(libinput_event_touch* touch);
@@ -86,6 +94,7 @@ private:
 
     std::shared_ptr<InputReport> report;
     std::vector<LibInputDevicePtr> devices;
+    std::vector<uint32_t> send_events_modes_before_suspend;
 
     InputSink* sink{nullptr};
     EventBuilder* builder{nullptr};
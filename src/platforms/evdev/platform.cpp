@@ -26,6 +26,7 @@
 #include "mir/dispatch/readable_fd.h"
 #include "mir/dispatch/multiplexing_dispatchable.h"
 #include "mir/dispatch/action_queue.h"
+#include "mir/dispatch/threaded_dispatcher.h"
 #include "mir/module_properties.h"
 #include "mir/assert_module_entry_point.h"
 #include "mir/console_services.h"
@@ -43,6 +44,8 @@
 #include <boost/throw_exception.hpp>
 
 #include <libinput.h>
+#include <poll.h>
+#include <chrono>
 #include <string>
 
 namespace mi = mir::input;
@@ -50,8 +53,18 @@ namespace md = mir::dispatch;
 namespace mu = mir::udev;
 namespace mie = mi::evdev;
 
+/// A udev event, read from sysfs on the hotplug thread so the input thread needn't
+struct mie::HotplugEvent
+{
+    mu::Monitor::EventType type;
+    dev_t devnum;
+    std::string devnode;
+    std::string syspath;
+};
+
 namespace
 {
+using mie::HotplugEvent;
 
 std::string describe(libinput_device* dev)
 {
@@ -69,31 +82,44 @@ std::string describe(libinput_device* dev)
     return desc;
 }
 
+/**
+ * Watches for input devices coming and going on the hotplug thread.
+ *
+ * Events are handed on in batches: everything udev has queued up, plus anything following
+ * shortly after, so the sibling interfaces of a newly plugged USB hub or composite device
+ * arrive together.
+ */
 class DispatchableUDevMonitor : public md::Dispatchable
 {
 public:
     DispatchableUDevMonitor(
-        mu::Context& context,
-        std::function<void(mu::Monitor::EventType, mu::Device const&)> on_event)
-        : monitor(context),
-          on_event{std::move(on_event)}
+        std::shared_ptr<mu::Context> const& context,
+        std::function<void(std::vector<HotplugEvent>&&)> on_events)
+        : context{context},
+          monitor(*context),
+          on_events{std::move(on_events)}
     {
         monitor.filter_by_subsystem("input");
         monitor.enable();
 
-        auto fake_shared_context = std::shared_ptr<mu::Context>{&context, [](auto){}};
-        mu::Enumerator device_enumerator{fake_shared_context};
+        mu::Enumerator device_enumerator{context};
 
         device_enumerator.match_subsystem("input");
         device_enumerator.scan_devices();
 
+        std::vector<HotplugEvent> batch;
         for (auto const& device : device_enumerator)
         {
             if (device.initialised())
             {
-                this->on_event(mu::Monitor::EventType::ADDED, device);
+                note_event(mu::Monitor::EventType::ADDED, device, batch);
             }
         }
+
+        if (!batch.empty())
+        {
+            this->on_events(std::move(batch));
+        }
     }
 
     mir::Fd watch_fd() const override
@@ -110,7 +136,21 @@ public:
             return false;
         }
 
-        monitor.process_events(on_event);
+        std::vector<HotplugEvent> batch;
+        auto const note = [this, &batch](auto type, auto const& device) { note_event(type, device, batch); };
+
+        monitor.process_events(note);
+
+        auto const give_up_at = std::chrono::steady_clock::now() + max_settle_time;
+        while (more_events_within(settle_time) && std::chrono::steady_clock::now() < give_up_at)
+        {
+            monitor.process_events(note);
+        }
+
+        if (!batch.empty())
+        {
+            on_events(std::move(batch));
+        }
         return true;
     }
 
@@ -120,10 +160,64 @@ public:
     }
 
 private:
+    static std::chrono::milliseconds constexpr settle_time{10};
+    static std::chrono::milliseconds constexpr max_settle_time{100};
+
+    auto more_events_within(std::chrono::milliseconds timeout) const -> bool
+    {
+        pollfd waiter{monitor.fd(), POLLIN, 0};
+        return poll(&waiter, 1, timeout.count()) > 0 && (waiter.revents & POLLIN);
+    }
+
+    void note_event(mu::Monitor::EventType type, mu::Device const& device, std::vector<HotplugEvent>& batch)
+    {
+        switch(type)
+        {
+        case mu::Monitor::ADDED:
+        {
+            if (!device.devnode())
+            {
+                return;
+            }
+
+            /*
+             * What if… madness?
+             *
+             * When we get notified from the mu::Monitor (ie: hotplug rather
+             * than on-start enumeration) under (at least) umockdev the
+             * udev_device is missing some properties. *Notably*,
+             * devices.devnum() is always 0.
+             *
+             * Work around this (umockdev?) bug by requesting a new
+             * Device from the syspath of the one we've been notified about.
+             */
+            auto const workaround_device = context->device_from_syspath(device.syspath());
+
+            // Libinput filters out anything without “event” as its name
+            if (strncmp(workaround_device->sysname(), "event", strlen("event")) != 0)
+            {
+                return;
+            }
+
+            batch.push_back({type, workaround_device->devnum(), workaround_device->devnode(), device.syspath()});
+            break;
+        }
+        case mu::Monitor::REMOVED:
+            batch.push_back({type, device.devnum(), {}, device.syspath()});
+            break;
+        default:
+            break;
+        }
+    }
+
+    std::shared_ptr<mu::Context> const context;
     mu::Monitor monitor;
-    std::function<void(mu::Monitor::EventType, mu::Device const&)> const on_event;
+    std::function<void(std::vector<HotplugEvent>&&)> const on_events;
 };
 
+std::chrono::milliseconds constexpr DispatchableUDevMonitor::settle_time;
+std::chrono::milliseconds constexpr DispatchableUDevMonitor::max_settle_time;
+
 } // namespace
 
 mie::Platform::Platform(
@@ -153,16 +247,16 @@ public:
         std::shared_ptr<md::ActionQueue> action_queue,
         mie::FdStore& device_fds,
         std::shared_ptr<::libinput>& lib,
-        mu::Device const& device,
+        HotplugEvent const& device,
         std::vector<std::shared_ptr<mie::LibInputDevice>>& devices,
         std::unordered_map<dev_t, std::future<std::unique_ptr<mir::Device>>>& pending_devices,
         std::unordered_map<dev_t, std::unique_ptr<mir::Device>>& device_watchers)
         : action_queue{std::move(action_queue)},
           device_fds{device_fds},
           lib{lib},
-          devnum{device.devnum()},
-          devnode{device.devnode()},
-          syspath{device.syspath()},
+          devnum{device.devnum},
+          devnode{device.devnode},
+          syspath{device.syspath},
           devices{devices},
           pending_devices{pending_devices},
           device_watchers{device_watchers}
@@ -287,86 +381,91 @@ void mie::Platform::start()
     action_queue = std::make_shared<md::ActionQueue>();
     udev_dispatchable =
         std::make_shared<DispatchableUDevMonitor>(
-            *udev_context,
-            [this](auto type, auto const& device)
+            udev_context,
+            [action_queue = action_queue, this](std::vector<HotplugEvent>&& batch)
             {
-                switch(type)
-                {
-                case mu::Monitor::ADDED:
-                {
-                    if (device.devnode())
+                // The whole batch becomes ready on the input thread at once
+                action_queue->enqueue(
+                    [this, batch = std::move(batch)]()
                     {
-                        /*
-                         * What if… madness?
-                         *
-                         * When we get notified from the mu::Monitor (ie: hotplug rather
-                         * than on-start enumeration) under (at least) umockdev the
-                         * udev_device is missing some properties. *Notably*,
-                         * devices.devnum() is always 0.
-                         *
-                         * Work around this (umockdev?) bug by requesting a new
-                         * Device from the syspath of the one we've been notified about.
-                         */
-                        auto ctx = std::make_shared<mu::Context>();
-                        auto workaround_device = ctx->device_from_syspath(device.syspath());
-
-                        std::string devnode{workaround_device->devnode()};
-                        // Libinput filters out anything without “event” as its name
-                        if (strncmp(workaround_device->sysname(), "event", strlen("event")) != 0)
+                        for (auto const& event : batch)
                         {
-                            return;
+                            hotplug(event);
                         }
-                        if (pending_devices.count(workaround_device->devnum()) > 0 ||
-                            device_watchers.count(workaround_device->devnum()) > 0)
-                        {
-                            // We're already handling this, ignore.
-                            return;
-                        }
-
-                        pending_devices.emplace(
-                            workaround_device->devnum(),
-                            console->acquire_device(
-                                major(workaround_device->devnum()),
-                                minor(workaround_device->devnum()),
-                                std::make_unique<InputDeviceObserver>(
-                                    action_queue,
-                                    device_fds,
-                                    lib,
-                                    *workaround_device,
-                                    devices,
-                                    pending_devices,
-                                    device_watchers)));
-                    }
-                    break;
-                }
-                case mu::Monitor::REMOVED:
-                {
-                    for (auto const& input_device : this->devices)
-                    {
-                        auto device_udev = libinput_device_get_udev_device(input_device->device());
-
-                        if (device_udev)
-                        {
-                            if (strcmp(device.syspath(), udev_device_get_syspath(device_udev)) == 0)
-                            {
-                                libinput_path_remove_device(input_device->device());
-                                device_watchers.erase(device.devnum());
-                            }
-                        }
-                    }
-                    break;
-                }
-                default:
-                    break;
-                }
+                    });
             });
 
-    platform_dispatchable->add_watch(udev_dispatchable);
     platform_dispatchable->add_watch(libinput_dispatchable);
     platform_dispatchable->add_watch(action_queue);
+
+    hotplug_actions = std::make_shared<md::ActionQueue>();
+
+    // Re-reading sysfs and udev's database for new devices is slow; keep it off the input thread
+    hotplug_thread = std::make_unique<md::ThreadedDispatcher>(
+        "Mir/Input Hotplug",
+        std::make_shared<md::MultiplexingDispatchable>(
+            std::initializer_list<std::shared_ptr<md::Dispatchable>>{udev_dispatchable, hotplug_actions}),
+        []()
+        {
+            mir::log(
+                mir::logging::Severity::error,
+                MIR_LOG_COMPONENT,
+                std::current_exception(),
+                "Input device hotplug failed, new devices will not be detected");
+        });
     process_input_events();
 }
 
+void mie::Platform::hotplug(HotplugEvent const& event)
+{
+    switch(event.type)
+    {
+    case mu::Monitor::ADDED:
+    {
+        if (pending_devices.count(event.devnum) > 0 ||
+            device_watchers.count(event.devnum) > 0)
+        {
+            // We're already handling this, ignore.
+            return;
+        }
+
+        pending_devices.emplace(
+            event.devnum,
+            console->acquire_device(
+                major(event.devnum),
+                minor(event.devnum),
+                std::make_unique<InputDeviceObserver>(
+                    action_queue,
+                    device_fds,
+                    lib,
+                    event,
+                    devices,
+                    pending_devices,
+                    device_watchers)));
+        break;
+    }
+    case mu::Monitor::REMOVED:
+    {
+        for (auto const& input_device : devices)
+        {
+            auto device_udev = libinput_device_get_udev_device(input_device->device());
+
+            if (device_udev)
+            {
+                if (event.syspath == udev_device_get_syspath(device_udev))
+                {
+                    libinput_path_remove_device(input_device->device());
+                    device_watchers.erase(event.devnum);
+                }
+            }
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
 void mie::Platform::process_input_events()
 {
     int status = libinput_dispatch(lib.get());
@@ -411,6 +510,25 @@ void mie::Platform::continue_after_config()
 {
 }
 
+void mie::Platform::suspend_non_wake_devices()
+{
+    non_wake_devices_suspended = true;
+
+    for (auto const& device : devices)
+    {
+        if (!device->is_wake_device())
+            device->suspend_events(true);
+    }
+}
+
+void mie::Platform::resume_non_wake_devices()
+{
+    non_wake_devices_suspended = false;
+
+    for (auto const& device : devices)
+        device->suspend_events(false);
+}
+
 void mie::Platform::device_added(libinput_device* dev)
 {
     auto device_ptr = make_libinput_device(lib, dev);
@@ -431,6 +549,9 @@ void mie::Platform::device_added(libinput_device* dev)
 
         input_device_registry->add_device(devices.back());
 
+        if (non_wake_devices_suspended && !devices.back()->is_wake_device())
+            devices.back()->suspend_events(true);
+
         report->opened_input_device(libinput_device_get_sysname(dev), "evdev-input");
     } catch(...)
     {
@@ -467,6 +588,10 @@ auto mie::Platform::find_device(libinput_device_group const* devgroup) -> declty
 
 void mie::Platform::stop()
 {
+    // Stop the hotplug thread first, so it doesn't queue up anything further
+    hotplug_thread.reset();
+    hotplug_actions.reset();
+
     // This must only be called from the dispatch thread, so this doesn't race
     device_watchers.clear();
     pending_devices.clear();
@@ -475,10 +600,6 @@ void mie::Platform::stop()
     {
         platform_dispatchable->remove_watch(action_queue);
     }
-    if (udev_dispatchable)
-    {
-        platform_dispatchable->remove_watch(udev_dispatchable);
-    }
     if (libinput_dispatchable)
     {
         platform_dispatchable->remove_watch(libinput_dispatchable);
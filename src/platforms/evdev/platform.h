@@ -47,6 +47,7 @@ class MultiplexingDispatchable;
 class ReadableFd;
 class Dispatchable;
 class ActionQueue;
+class ThreadedDispatcher;
 }
 namespace input
 {
@@ -55,6 +56,7 @@ namespace evdev
 {
 
 class LibInputDevice;
+struct HotplugEvent;
 
 class Platform : public input::Platform
 {
@@ -69,10 +71,13 @@ public:
     void stop() override;
     void pause_for_config() override;
     void continue_after_config() override;
+    void suspend_non_wake_devices() override;
+    void resume_non_wake_devices() override;
 
 private:
     void device_added(libinput_device* dev);
     void device_removed(libinput_device* dev);
+    void hotplug(HotplugEvent const& event);
     void process_input_events();
 
     FdStore device_fds;
@@ -84,12 +89,21 @@ private:
     std::shared_ptr<dispatch::MultiplexingDispatchable> const platform_dispatchable;
     std::shared_ptr<::libinput> lib;
     std::shared_ptr<dispatch::ReadableFd> libinput_dispatchable;
-    std::shared_ptr<dispatch::Dispatchable> udev_dispatchable;
     std::shared_ptr<dispatch::ActionQueue> action_queue;
     std::unordered_map<dev_t, std::future<std::unique_ptr<mir::Device>>> pending_devices;
     std::unordered_map<dev_t, std::unique_ptr<mir::Device>> device_watchers;
 
+protected:
+    /// Both dispatched on hotplug_thread; null until start(). Work queued on hotplug_actions runs
+    /// between udev batches, which lets tests synchronise with the thread.
+    std::shared_ptr<dispatch::Dispatchable> udev_dispatchable;
+    std::shared_ptr<dispatch::ActionQueue> hotplug_actions;
+
+private:
+    std::unique_ptr<dispatch::ThreadedDispatcher> hotplug_thread;
+
     std::vector<std::shared_ptr<LibInputDevice>> devices;
+    bool non_wake_devices_suspended{false};
     auto find_device(libinput_device_group const* group) -> decltype(devices)::iterator;
 };
 }
@@ -43,6 +43,8 @@ bool mgm::BypassMatch::operator()(std::shared_ptr<graphics::Renderable> const& r
     auto const is_opaque = !((renderable->alpha() != 1.0f) || renderable->shaped());
     auto const fits = (renderable->screen_position() == view_area);
     auto const is_orthogonal = (renderable->transformation() == identity);
-    bypass_is_feasible = (is_opaque && fits && is_orthogonal);
+    // Scanning out the buffer shows all of it unscaled, so it can't be cropped or scaled by a viewport
+    auto const is_unscaled = (renderable->src_bounds() == geometry::Rectangle{{}, view_area.size});
+    bypass_is_feasible = (is_opaque && fits && is_orthogonal && is_unscaled);
     return bypass_is_feasible;
 }
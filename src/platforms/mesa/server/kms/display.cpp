@@ -443,6 +443,150 @@ void add_to_drm_device_group(
 }
 }
 
+namespace
+{
+auto outputs_of(mg::OverlappingOutputGroup const& group) -> std::vector<mg::DisplayConfigurationOutput>
+{
+    std::vector<mg::DisplayConfigurationOutput> outputs;
+    group.for_each_output([&](mg::DisplayConfigurationOutput const& output) { outputs.push_back(output); });
+    return outputs;
+}
+}
+
+void mgm::Display::configure_incrementally(
+    mg::DisplayConfiguration const& conf,
+    std::function<void(mg::DisplaySyncGroup& group)> const& removing,
+    std::function<void(mg::DisplaySyncGroup& group)> const& added)
+{
+    if (!conf.valid())
+    {
+        BOOST_THROW_EXCEPTION(
+            std::logic_error("Invalid or inconsistent display configuration"));
+    }
+
+    auto const& kms_conf = dynamic_cast<RealKMSDisplayConfiguration const&>(conf);
+    std::vector<mg::DisplaySyncGroup*> new_groups;
+
+    OverlappingOutputGrouping grouping{kms_conf};
+    std::vector<OverlappingOutputGroup> wanted;
+    grouping.for_each_group([&](OverlappingOutputGroup const& group) { wanted.push_back(group); });
+
+    /*
+     * The display buffers of a group whose outputs are all configured exactly as
+     * before are kept, and their outputs left alone.
+     */
+    bool replacing_display_buffers{false};
+    std::vector<mg::DisplaySyncGroup*> replaced_groups;
+
+    {
+        std::lock_guard<decltype(configuration_mutex)> lock{configuration_mutex};
+
+        if (compatible(kms_conf, current_display_configuration))
+        {
+            // No display buffer needs replacing
+            configure_locked(kms_conf, lock);
+        }
+        else
+        {
+            replacing_display_buffers = true;
+
+            for (auto i = 0u; i != display_buffers.size(); ++i)
+            {
+                auto const unchanged = std::any_of(wanted.begin(), wanted.end(),
+                    [&](OverlappingOutputGroup const& group)
+                    {
+                        return outputs_of(group) == display_buffer_outputs[i];
+                    });
+
+                if (!unchanged)
+                    replaced_groups.push_back(display_buffers[i].get());
+            }
+        }
+    }
+
+    // Stopping compositing to a group waits out its current frame, which may need
+    // configuration_mutex (the cursor takes it), so don't hold it here
+    for (auto const group : replaced_groups)
+        removing(*group);
+
+    if (replacing_display_buffers)
+    {
+        std::lock_guard<decltype(configuration_mutex)> lock{configuration_mutex};
+
+        std::vector<std::unique_ptr<DisplayBuffer>> dropped_buffers;
+        std::vector<std::vector<DisplayConfigurationOutput>> dropped_outputs;
+
+        // Display configuration is only changed from one thread, so these are the buffers found above
+        for (auto i = 0u; i != display_buffers.size(); ++i)
+        {
+            auto const replaced =
+                std::find(replaced_groups.begin(), replaced_groups.end(), display_buffers[i].get());
+
+            if (replaced != replaced_groups.end())
+            {
+                dropped_buffers.push_back(std::move(display_buffers[i]));
+                dropped_outputs.push_back(std::move(display_buffer_outputs[i]));
+            }
+        }
+
+        // As in configure_locked(), let pending flips finish before the outputs change hands
+        for (auto& db : dropped_buffers)
+            db->wait_for_page_flip();
+
+        for (auto const& outputs : dropped_outputs)
+        {
+            for (auto const& conf_output : outputs)
+            {
+                auto kms_output = current_display_configuration.get_output_for(conf_output.id);
+                kms_output->clear_cursor();
+                kms_output->reset();
+            }
+        }
+
+        // Keep display_buffers in grouping order, as configure_locked() relies on it
+        std::vector<std::unique_ptr<DisplayBuffer>> display_buffers_new;
+        std::vector<std::vector<DisplayConfigurationOutput>> display_buffer_outputs_new;
+
+        for (auto const& group : wanted)
+        {
+            auto const outputs = outputs_of(group);
+            bool kept{false};
+
+            for (auto i = 0u; i != display_buffers.size(); ++i)
+            {
+                if (display_buffers[i] && display_buffer_outputs[i] == outputs)
+                {
+                    display_buffers_new.push_back(std::move(display_buffers[i]));
+                    display_buffer_outputs_new.push_back(outputs);
+                    kept = true;
+                }
+            }
+
+            if (kept)
+                continue;
+
+            for (auto& db : create_display_buffers_for(group, kms_conf))
+            {
+                new_groups.push_back(db.get());
+                display_buffers_new.push_back(std::move(db));
+                display_buffer_outputs_new.push_back(outputs);
+            }
+        }
+
+        display_buffers = std::move(display_buffers_new);
+        display_buffer_outputs = std::move(display_buffer_outputs_new);
+        dropped_buffers.clear();
+
+        current_display_configuration = kms_conf;
+        clear_connected_unused_outputs();
+    }
+
+    for (auto const group : new_groups)
+        added(*group);
+
+    if (auto c = cursor.lock()) c->resume();
+}
+
 void mgm::Display::configure_locked(
     mgm::RealKMSDisplayConfiguration const& kms_conf,
     std::lock_guard<std::mutex> const&)
@@ -453,6 +597,7 @@ void mgm::Display::configure_locked(
         (&kms_conf != &current_display_configuration) &&
         compatible(kms_conf, current_display_configuration)};
     std::vector<std::unique_ptr<DisplayBuffer>> display_buffers_new;
+    std::vector<std::vector<DisplayConfigurationOutput>> display_buffer_outputs_new;
 
     if (!comp)
     {
@@ -484,9 +629,18 @@ void mgm::Display::configure_locked(
     grouping.for_each_group(
         [&](OverlappingOutputGroup const& group)
         {
+            if (!comp)
+            {
+                auto const outputs = outputs_of(group);
+                for (auto& db : create_display_buffers_for(group, kms_conf))
+                {
+                    display_buffers_new.push_back(std::move(db));
+                    display_buffer_outputs_new.push_back(outputs);
+                }
+                return;
+            }
+
             auto bounding_rect = group.bounding_rectangle();
-            // Each vector<KMSOutput> is a single GPU memory domain
-            std::vector<std::vector<std::shared_ptr<KMSOutput>>> kms_output_groups;
             glm::mat2 transformation;
 
             group.for_each_output(
@@ -497,12 +651,6 @@ void mgm::Display::configure_locked(
                     auto const mode_index = kms_conf.get_kms_mode_index(conf_output.id,
                                                                   conf_output.current_mode_index);
                     kms_output->configure(conf_output.top_left - bounding_rect.top_left, mode_index);
-                    if (!comp)
-                    {
-                        kms_output->set_power_mode(conf_output.power_mode);
-                        kms_output->set_gamma(conf_output.gamma);
-                        add_to_drm_device_group(kms_output_groups, std::move(kms_output));
-                    }
 
                     /*
                      * Presently OverlappingOutputGroup guarantees all grouped
@@ -511,58 +659,16 @@ void mgm::Display::configure_locked(
                     transformation = conf_output.transformation();
                 });
 
-            if (comp)
-            {
-                display_buffers[group_idx++]->set_transformation(transformation,
-                                                                 bounding_rect);
-            }
-            else
-            {
-                glm::vec2 const logical_size{
-                    bounding_rect.size.width.as_uint32_t(),
-                    bounding_rect.size.height.as_uint32_t()};
-
-                auto const physical_size = transformation * logical_size;
-                uint32_t width = abs(int(physical_size.x));
-                uint32_t height = abs(int(physical_size.y));
-
-                for (auto const& group : kms_output_groups)
-                {
-                    /*
-                     * In a hybrid setup a scanout surface needs to be allocated differently if it
-                     * needs to be able to be shared across GPUs. This likely reduces performance.
-                     *
-                     * As a first cut, assume every scanout buffer in a hybrid setup might need
-                     * to be shared.
-                     */
-                    auto surface = gbm->create_scanout_surface(width, height, drm.size() != 1);
-                    auto const raw_surface = surface.get();
-
-                    auto db = std::make_unique<DisplayBuffer>(
-                        bypass_option,
-                        listener,
-                        group,
-                        GBMOutputSurface{
-                            group.front()->drm_fd(),
-                            std::move(surface),
-                            width, height,
-                            helpers::EGLHelper{
-                                *gl_config,
-                                *gbm,
-                                raw_surface,
-                                shared_egl.context()
-                            }
-                        },
-                        bounding_rect,
-                        transformation);
-
-                    display_buffers_new.push_back(std::move(db));
-                }
-            }
+            display_buffer_outputs[group_idx] = outputs_of(group);
+            display_buffers[group_idx++]->set_transformation(transformation,
+                                                             bounding_rect);
         });
 
     if (!comp)
+    {
         display_buffers = std::move(display_buffers_new);
+        display_buffer_outputs = std::move(display_buffer_outputs_new);
+    }
 
     /* Store applied configuration */
     current_display_configuration = kms_conf;
@@ -571,3 +677,74 @@ void mgm::Display::configure_locked(
         /* Clear connected but unused outputs */
         clear_connected_unused_outputs();
 }
+
+auto mgm::Display::create_display_buffers_for(
+    OverlappingOutputGroup const& group,
+    RealKMSDisplayConfiguration const& kms_conf) -> std::vector<std::unique_ptr<DisplayBuffer>>
+{
+    auto bounding_rect = group.bounding_rectangle();
+    // Each vector<KMSOutput> is a single GPU memory domain
+    std::vector<std::vector<std::shared_ptr<KMSOutput>>> kms_output_groups;
+    glm::mat2 transformation;
+
+    group.for_each_output(
+        [&](DisplayConfigurationOutput const& conf_output)
+        {
+            auto kms_output = current_display_configuration.get_output_for(conf_output.id);
+
+            auto const mode_index = kms_conf.get_kms_mode_index(conf_output.id,
+                                                          conf_output.current_mode_index);
+            kms_output->configure(conf_output.top_left - bounding_rect.top_left, mode_index);
+            kms_output->set_power_mode(conf_output.power_mode);
+            kms_output->set_gamma(conf_output.gamma);
+            add_to_drm_device_group(kms_output_groups, std::move(kms_output));
+
+            /*
+             * Presently OverlappingOutputGroup guarantees all grouped
+             * outputs have the same transformation.
+             */
+            transformation = conf_output.transformation();
+        });
+
+    glm::vec2 const logical_size{
+        bounding_rect.size.width.as_uint32_t(),
+        bounding_rect.size.height.as_uint32_t()};
+
+    auto const physical_size = transformation * logical_size;
+    uint32_t width = abs(int(physical_size.x));
+    uint32_t height = abs(int(physical_size.y));
+
+    std::vector<std::unique_ptr<DisplayBuffer>> buffers;
+    for (auto const& kms_output_group : kms_output_groups)
+    {
+        /*
+         * In a hybrid setup a scanout surface needs to be allocated differently if it
+         * needs to be able to be shared across GPUs. This likely reduces performance.
+         *
+         * As a first cut, assume every scanout buffer in a hybrid setup might need
+         * to be shared.
+         */
+        auto surface = gbm->create_scanout_surface(width, height, drm.size() != 1);
+        auto const raw_surface = surface.get();
+
+        buffers.push_back(std::make_unique<DisplayBuffer>(
+            bypass_option,
+            listener,
+            kms_output_group,
+            GBMOutputSurface{
+                kms_output_group.front()->drm_fd(),
+                std::move(surface),
+                width, height,
+                helpers::EGLHelper{
+                    *gl_config,
+                    *gbm,
+                    raw_surface,
+                    shared_egl.context()
+                }
+            },
+            bounding_rect,
+            transformation));
+    }
+
+    return buffers;
+}
@@ -20,6 +20,8 @@
 #define MIR_GRAPHICS_MESA_DISPLAY_H_
 
 #include "mir/graphics/display.h"
+#include "mir/graphics/display_configuration.h"
+#include "mir/graphics/incremental_display.h"
 #include "mir/renderer/gl/context_source.h"
 #include "real_kms_output_container.h"
 #include "real_kms_display_configuration.h"
@@ -46,6 +48,7 @@ class DisplayBuffer;
 class DisplayConfigurationPolicy;
 class EventHandlerRegister;
 class GLConfig;
+class OverlappingOutputGroup;
 
 namespace mesa
 {
@@ -62,6 +65,7 @@ class Cursor;
 
 class Display : public graphics::Display,
                 public graphics::NativeDisplay,
+                public graphics::IncrementalDisplay,
                 public renderer::gl::ContextSource
 {
 public:
@@ -82,6 +86,11 @@ public:
     bool apply_if_configuration_preserves_display_buffers(DisplayConfiguration const& conf) override;
     void configure(DisplayConfiguration const& conf) override;
 
+    void configure_incrementally(
+        DisplayConfiguration const& conf,
+        std::function<void(graphics::DisplaySyncGroup& group)> const& removing,
+        std::function<void(graphics::DisplaySyncGroup& group)> const& added) override;
+
     void register_configuration_change_handler(
         EventHandlerRegister& handlers,
         DisplayConfigurationChangeHandler const& conf_change_handler) override;
@@ -113,6 +122,8 @@ private:
     mir::udev::Monitor monitor;
     helpers::EGLHelper shared_egl;
     std::vector<std::unique_ptr<DisplayBuffer>> display_buffers;
+    /// For each of display_buffers, how the outputs of its overlapping group are configured
+    std::vector<std::vector<DisplayConfigurationOutput>> display_buffer_outputs;
     std::shared_ptr<KMSOutputContainer> const output_container;
     mutable RealKMSDisplayConfiguration current_display_configuration;
     mutable std::atomic<bool> dirty_configuration;
@@ -121,6 +132,11 @@ private:
         RealKMSDisplayConfiguration const& conf,
         std::lock_guard<decltype(configuration_mutex)> const&);
 
+    /// Sets up the outputs of group and creates the display buffers that show it
+    auto create_display_buffers_for(
+        OverlappingOutputGroup const& group,
+        RealKMSDisplayConfiguration const& kms_conf) -> std::vector<std::unique_ptr<DisplayBuffer>>;
+
     BypassOption bypass_option;
     std::weak_ptr<Cursor> cursor;
     std::shared_ptr<GLConfig> const gl_config;
@@ -109,6 +109,14 @@ void mix::XInputPlatform::continue_after_config()
 {
 }
 
+void mix::XInputPlatform::suspend_non_wake_devices()
+{
+}
+
+void mix::XInputPlatform::resume_non_wake_devices()
+{
+}
+
 void mix::XInputPlatform::process_input_event()
 {
     while(XPending(x11_connection.get()))
@@ -63,3 +63,11 @@ void miw::InputPlatform::pause_for_config()
 void miw::InputPlatform::continue_after_config()
 {
 }
+
+void miw::InputPlatform::suspend_non_wake_devices()
+{
+}
+
+void miw::InputPlatform::resume_non_wake_devices()
+{
+}
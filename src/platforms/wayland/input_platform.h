@@ -44,6 +44,8 @@ public:
     void stop() override;
     void pause_for_config() override;
     void continue_after_config() override;
+    void suspend_non_wake_devices() override;
+    void resume_non_wake_devices() override;
 
 private:
     std::shared_ptr<dispatch::ActionQueue> const action_queue;
@@ -23,6 +23,7 @@
 #include "mir/gl/default_program_factory.h"
 #include "mir/graphics/renderable.h"
 #include "mir/graphics/buffer.h"
+#include "mir/graphics/solid_colour_buffer.h"
 #include "mir/graphics/display_buffer.h"
 #include "mir/gl/tessellation_helpers.h"
 #include "mir/gl/texture_cache.h"
@@ -30,6 +31,7 @@
 #include "mir/log.h"
 #include "mir/report_exception.h"
 #include "mir/graphics/egl_error.h"
+#include "mir/heap_accounting.h"
 #include "mir/graphics/texture.h"
 #include "mir/graphics/program_factory.h"
 #include "mir/graphics/program.h"
@@ -111,6 +113,18 @@ const GLchar* const mrg::Renderer::alpha_fshader =
     "}\n"
 };
 
+const GLchar* const mrg::Renderer::solid_colour_fshader =
+{   // Solid colour buffers have no texture to sample
+    "#ifdef GL_ES\n"
+    "precision mediump float;\n"
+    "#endif\n"
+    "uniform vec4 colour;\n"
+    "uniform float alpha;\n"
+    "void main() {\n"
+    "   gl_FragColor = alpha*colour;\n"
+    "}\n"
+};
+
 const GLchar* const mrg::Renderer::default_fshader =
 {   // This is the fastest fragment shader. Use it when you can.
     "#ifdef GL_ES\n"
@@ -332,6 +346,7 @@ mrg::Renderer::Program::Program(GLuint program_id)
     transform_uniform = glGetUniformLocation(id, "transform");
     screen_to_gl_coords_uniform = glGetUniformLocation(id, "screen_to_gl_coords");
     alpha_uniform = glGetUniformLocation(id, "alpha");
+    colour_uniform = glGetUniformLocation(id, "colour");
 }
 
 mrg::Renderer::Renderer(graphics::DisplayBuffer& display_buffer)
@@ -339,6 +354,7 @@ mrg::Renderer::Renderer(graphics::DisplayBuffer& display_buffer)
       clear_color{0.0f, 0.0f, 0.0f, 0.0f},
       default_program(family.add_program(vshader, default_fshader)),
       alpha_program(family.add_program(vshader, alpha_fshader)),
+      solid_colour_program(family.add_program(vshader, solid_colour_fshader)),
       program_factory{std::make_unique<ProgramFactory>()},
       texture_cache(mgl::DefaultProgramFactory().create_texture_cache()),
       display_transform(1)
@@ -409,6 +425,7 @@ void mrg::Renderer::tessellate(std::vector<mgl::Primitive>& primitives,
 
 void mrg::Renderer::render(mg::RenderableList const& renderables) const
 {
+    mir::heap_accounting::Scope const heap_scope{mir::heap_accounting::Subsystem::renderer};
     render_target.bind();
 
     glClearColor(clear_color[0], clear_color[1], clear_color[2], clear_color[3]);
@@ -449,9 +466,10 @@ void mrg::Renderer::draw(mg::Renderable const& renderable) const
         );
     }
 
+    auto const solid_colour = std::dynamic_pointer_cast<mg::SolidColourBuffer>(renderable.buffer());
     auto const texture = std::dynamic_pointer_cast<mg::gl::Texture>(renderable.buffer());
     auto const surface_tex =
-        [this, &renderable, need_fallback = !static_cast<bool>(texture)]() -> std::shared_ptr<mir::gl::Texture>
+        [this, &renderable, need_fallback = !texture && !solid_colour]() -> std::shared_ptr<mir::gl::Texture>
         {
             if (need_fallback)
             {
@@ -468,9 +486,13 @@ void mrg::Renderer::draw(mg::Renderable const& renderable) const
         }();
 
     auto const* maybe_prog =
-        [this, &texture, &surface_tex](bool alpha) -> Program const*
+        [this, &solid_colour, &texture, &surface_tex](bool alpha) -> Program const*
         {
-            if (texture)
+            if (solid_colour)
+            {
+                return &solid_colour_program;
+            }
+            else if (texture)
             {
                 auto const& family = static_cast<::Program const&>(texture->shader(*program_factory));
                 if (alpha)
@@ -544,8 +566,15 @@ void mrg::Renderer::draw(mg::Renderable const& renderable) const
     if (prog.alpha_uniform >= 0)
         glUniform1f(prog.alpha_uniform, renderable.alpha());
 
+    if (solid_colour)
+    {
+        auto const colour = solid_colour->colour();
+        glUniform4f(prog.colour_uniform, colour.r, colour.g, colour.b, colour.a);
+    }
+
     glEnableVertexAttribArray(prog.position_attr);
-    glEnableVertexAttribArray(prog.texcoord_attr);
+    if (prog.texcoord_attr >= 0)
+        glEnableVertexAttribArray(prog.texcoord_attr);
 
     primitives.clear();
     tessellate(primitives, renderable);
@@ -589,7 +618,7 @@ void mrg::Renderer::draw(mg::Renderable const& renderable) const
             {
                 surface_tex->bind();
             }
-            else
+            else if (texture)
             {
                 texture->bind();
             }
@@ -597,9 +626,12 @@ void mrg::Renderer::draw(mg::Renderable const& renderable) const
             glVertexAttribPointer(prog.position_attr, 3, GL_FLOAT,
                                   GL_FALSE, sizeof(mgl::Vertex),
                                   &p.vertices[0].position);
-            glVertexAttribPointer(prog.texcoord_attr, 2, GL_FLOAT,
-                                  GL_FALSE, sizeof(mgl::Vertex),
-                                  &p.vertices[0].texcoord);
+            if (prog.texcoord_attr >= 0)
+            {
+                glVertexAttribPointer(prog.texcoord_attr, 2, GL_FLOAT,
+                                      GL_FALSE, sizeof(mgl::Vertex),
+                                      &p.vertices[0].texcoord);
+            }
 
             if (blend.dst_rgb == GL_ZERO)
             {
@@ -626,7 +658,13 @@ void mrg::Renderer::draw(mg::Renderable const& renderable) const
         report_exception();
     }
 
-    glDisableVertexAttribArray(prog.texcoord_attr);
+    if (solid_colour)
+    {
+        solid_colour->mark_consumed();
+    }
+
+    if (prog.texcoord_attr >= 0)
+        glDisableVertexAttribArray(prog.texcoord_attr);
     glDisableVertexAttribArray(prog.position_attr);
     if (renderable.clip_area())
     {
@@ -85,6 +85,7 @@ public:
         GLint transform_uniform = -1;
         GLint screen_to_gl_coords_uniform = -1;
         GLint alpha_uniform = -1;
+        GLint colour_uniform = -1;
         mutable long long last_used_frameno = 0;
 
         Program(GLuint program_id);
@@ -117,11 +118,12 @@ protected:
     mutable long long frameno = 0;
 
     ProgramFamily family;
-    Program default_program, alpha_program;
+    Program default_program, alpha_program, solid_colour_program;
 
     static const GLchar* const vshader;
     static const GLchar* const default_fshader;
     static const GLchar* const alpha_fshader;
+    static const GLchar* const solid_colour_fshader;
 
     virtual void draw(graphics::Renderable const& renderable) const;
 
@@ -25,6 +25,8 @@
 #include "gl/renderer_factory.h"
 #include "compositing_screencast.h"
 #include "mir/main_loop.h"
+#include "mir/observer_registrar.h"
+#include "mir/graphics/display_configuration_observer.h"
 
 #include "mir/frontend/screencast.h"
 #include "mir/options/configuration.h"
@@ -72,7 +74,7 @@ mir::DefaultServerConfiguration::the_compositor()
             std::chrono::milliseconds const composite_delay(
                 the_options()->get<int>(options::composite_delay_opt));
 
-            return std::make_shared<mc::MultiThreadedCompositor>(
+            auto const result = std::make_shared<mc::MultiThreadedCompositor>(
                 the_display(),
                 the_scene(),
                 the_display_buffer_compositor_factory(),
@@ -80,6 +82,10 @@ mir::DefaultServerConfiguration::the_compositor()
                 the_compositor_report(),
                 composite_delay,
                 true);
+
+            the_display_configuration_observer_registrar()->register_interest(result->display_configuration_observer());
+
+            return result;
         });
 }
 
@@ -19,6 +19,8 @@
 #include "multi_threaded_compositor.h"
 #include "mir/graphics/display.h"
 #include "mir/graphics/display_buffer.h"
+#include "mir/graphics/display_configuration.h"
+#include "mir/graphics/display_configuration_observer.h"
 #include "mir/compositor/display_buffer_compositor.h"
 #include "mir/compositor/display_buffer_compositor_factory.h"
 #include "mir/compositor/display_listener.h"
@@ -28,10 +30,13 @@
 #include "mir/scene/surface_observer.h"
 #include "mir/scene/surface.h"
 #include "mir/terminate_with_current_exception.h"
+#include "mir/heap_accounting.h"
 #include "mir/raii.h"
 #include "mir/unwind_helpers.h"
 #include "mir/thread_name.h"
 
+#include <algorithm>
+#include <iterator>
 #include <thread>
 #include <chrono>
 #include <condition_variable>
@@ -42,6 +47,7 @@ using namespace std::literals::chrono_literals;
 namespace mc = mir::compositor;
 namespace mg = mir::graphics;
 namespace ms = mir::scene;
+namespace geom = mir::geometry;
 
 namespace mir
 {
@@ -74,6 +80,7 @@ public:
     try
     {
         mir::set_thread_name("Mir/Comp");
+        mir::heap_accounting::Scope const heap_scope{mir::heap_accounting::Subsystem::compositor};
 
         std::vector<std::tuple<mg::DisplayBuffer*, std::unique_ptr<mc::DisplayBufferCompositor>>> compositors;
         group.for_each_display_buffer(
@@ -115,8 +122,8 @@ public:
             std::unique_lock<std::mutex> lock{run_mutex};
             while (running)
             {
-                /* Wait until compositing has been scheduled or we are stopped */
-                run_cv.wait(lock, [&]{ return (frames_scheduled > 0) || !running; });
+                /* Wait until compositing has been scheduled (and there's something to show it) or we are stopped */
+                run_cv.wait(lock, [&]{ return (lit && frames_scheduled > 0) || !running; });
 
                 /*
                  * Check if we are running before compositing, since we may have
@@ -193,7 +200,7 @@ public:
     {
         std::lock_guard<std::mutex> lock{run_mutex};
 
-        if (num_frames > frames_scheduled)
+        if (lit && num_frames > frames_scheduled)
         {
             frames_scheduled = num_frames;
             run_cv.notify_one();
@@ -208,13 +215,39 @@ public:
         group.for_each_display_buffer([&](mg::DisplayBuffer& buffer)
             { if (damage.overlaps(buffer.view_area())) took_damage = true; });
 
-        if (took_damage && num_frames > frames_scheduled)
+        if (lit && took_damage && num_frames > frames_scheduled)
         {
             frames_scheduled = num_frames;
             run_cv.notify_one();
         }
     }
 
+    /*
+     * Park the thread while none of its display buffers are within \p lit_area.
+     * The display buffer compositors (and their GL state) are kept while parked.
+     */
+    void set_lit_area(geom::Rectangles const& lit_area)
+    {
+        bool now_lit{false};
+        group.for_each_display_buffer([&](mg::DisplayBuffer& buffer)
+            {
+                for (auto const& area : lit_area)
+                    if (area.overlaps(buffer.view_area())) now_lit = true;
+            });
+
+        std::lock_guard<std::mutex> lock{run_mutex};
+
+        if (now_lit && !lit)
+        {
+            // Whatever the output last showed is stale, so resume with a complete frame
+            not_posted_yet = true;
+            frames_scheduled = std::max(frames_scheduled, 1);
+            run_cv.notify_one();
+        }
+
+        lit = now_lit;
+    }
+
     void stop()
     {
         std::lock_guard<std::mutex> lock{run_mutex};
@@ -244,11 +277,72 @@ private:
     std::promise<void> started;
     std::future<void> started_future;
     bool not_posted_yet = true;
+    bool lit = true;
 };
 
 }
 }
 
+class mc::MultiThreadedCompositor::OutputPowerTracker : public mg::DisplayConfigurationObserver
+{
+public:
+    OutputPowerTracker(MultiThreadedCompositor* compositor)
+        : compositor{compositor}
+    {
+    }
+
+    void initial_configuration(std::shared_ptr<mg::DisplayConfiguration const> const& config) override
+    {
+        update(*config);
+    }
+
+    void configuration_applied(std::shared_ptr<mg::DisplayConfiguration const> const& config) override
+    {
+        update(*config);
+    }
+
+    void base_configuration_updated(std::shared_ptr<mg::DisplayConfiguration const> const&) override
+    {}
+
+    void session_configuration_applied(std::shared_ptr<ms::Session> const&,
+        std::shared_ptr<mg::DisplayConfiguration> const&) override
+    {}
+
+    void session_configuration_removed(std::shared_ptr<ms::Session> const&) override
+    {}
+
+    void configuration_failed(
+        std::shared_ptr<mg::DisplayConfiguration const> const&,
+        std::exception const&) override
+    {}
+
+    void catastrophic_configuration_error(
+        std::shared_ptr<mg::DisplayConfiguration const> const&,
+        std::exception const&) override
+    {}
+
+    void configuration_updated_for_session(
+        std::shared_ptr<ms::Session> const&,
+        std::shared_ptr<mg::DisplayConfiguration const> const&) override
+    {}
+
+private:
+    void update(mg::DisplayConfiguration const& conf)
+    {
+        geom::Rectangles lit_area;
+        conf.for_each_output(
+            [&lit_area](mg::DisplayConfigurationOutput const& output)
+            {
+                if (output.used && output.connected && output.power_mode == mir_power_mode_on)
+                    lit_area.add(output.extents());
+            });
+
+        compositor->update_lit_area(lit_area);
+    }
+
+    MultiThreadedCompositor* const compositor;
+};
+
 mc::MultiThreadedCompositor::MultiThreadedCompositor(
     std::shared_ptr<mg::Display> const& display,
     std::shared_ptr<mc::Scene> const& scene,
@@ -265,6 +359,7 @@ mc::MultiThreadedCompositor::MultiThreadedCompositor(
       state{CompositorState::stopped},
       fixed_composite_delay{fixed_composite_delay},
       compose_on_start{compose_on_start},
+      output_power_tracker{std::make_shared<OutputPowerTracker>(this)},
       thread_pool{1}
 {
     observer = std::make_shared<ms::LegacySceneChangeNotification>(
@@ -286,19 +381,37 @@ mc::MultiThreadedCompositor::~MultiThreadedCompositor()
 void mc::MultiThreadedCompositor::schedule_compositing(int num)
 {
     report->scheduled();
-    for (auto& f : thread_functors)
-        f->schedule_compositing(num);
+    std::lock_guard<std::mutex> lock{compositing_mutex};
+    for (auto& c : compositing)
+        c.functor->schedule_compositing(num);
 }
 
 void mc::MultiThreadedCompositor::schedule_compositing(int num, geometry::Rectangle const& damage) const
 {
     report->scheduled();
-    for (auto& f : thread_functors)
-        f->schedule_compositing(num, damage);
+    std::lock_guard<std::mutex> lock{compositing_mutex};
+    for (auto& c : compositing)
+        c.functor->schedule_compositing(num, damage);
+}
+
+auto mc::MultiThreadedCompositor::display_configuration_observer() const
+    -> std::shared_ptr<mg::DisplayConfigurationObserver>
+{
+    return output_power_tracker;
+}
+
+void mc::MultiThreadedCompositor::update_lit_area(geometry::Rectangles const& area)
+{
+    std::lock_guard<std::mutex> lock{compositing_mutex};
+    lit_area = area;
+
+    for (auto& c : compositing)
+        c.functor->set_lit_area(area);
 }
 
 void mc::MultiThreadedCompositor::start()
 {
+    std::lock_guard<std::mutex> lock{state_guard};
     auto stopped = CompositorState::stopped;
 
     if (!state.compare_exchange_strong(stopped, CompositorState::starting))
@@ -331,6 +444,7 @@ void mc::MultiThreadedCompositor::start()
 
 void mc::MultiThreadedCompositor::stop()
 {
+    std::lock_guard<std::mutex> lock{state_guard};
     auto started = CompositorState::started;
 
     if (!state.compare_exchange_strong(started, CompositorState::stopping))
@@ -361,33 +475,103 @@ void mc::MultiThreadedCompositor::stop()
     state = CompositorState::stopped;
 }
 
+void mc::MultiThreadedCompositor::add_display_sync_group(mg::DisplaySyncGroup& group)
+{
+    std::lock_guard<std::mutex> lock{state_guard};
+    if (state != CompositorState::started)
+        return;
+
+    auto& functor = start_compositing_to(group);
+
+    try
+    {
+        functor.wait_until_started();
+    }
+    catch (...)
+    {
+        stop_compositing_to(group);
+        throw;
+    }
+
+    // Whatever the new output shows now is not ours
+    functor.schedule_compositing(1);
+}
+
+void mc::MultiThreadedCompositor::remove_display_sync_group(mg::DisplaySyncGroup& group)
+{
+    std::lock_guard<std::mutex> lock{state_guard};
+    stop_compositing_to(group);
+}
+
+void mc::MultiThreadedCompositor::stop_compositing_to(mg::DisplaySyncGroup& group)
+{
+    std::vector<GroupCompositing> stopping;
+    {
+        std::lock_guard<std::mutex> lock{compositing_mutex};
+
+        auto const removed = std::stable_partition(
+            compositing.begin(), compositing.end(),
+            [&group](GroupCompositing const& c) { return c.group != &group; });
+
+        std::move(removed, compositing.end(), std::back_inserter(stopping));
+        compositing.erase(removed, compositing.end());
+    }
+
+    if (stopping.empty())
+        return;
+
+    stop_compositing(stopping);
+    thread_pool.shrink();
+}
+
 void mc::MultiThreadedCompositor::create_compositing_threads()
 {
     /* Start the display buffer compositing threads */
-    display->for_each_display_sync_group([this](mg::DisplaySyncGroup& group)
+    std::vector<CompositingFunctor*> starting;
+    display->for_each_display_sync_group([this, &starting](mg::DisplaySyncGroup& group)
     {
-        auto thread_functor = std::make_unique<mc::CompositingFunctor>(
-            display_buffer_compositor_factory, group, scene, display_listener,
-            fixed_composite_delay, report);
-
-        futures.push_back(thread_pool.run(std::ref(*thread_functor), &group));
-        thread_functors.push_back(std::move(thread_functor));
+        starting.push_back(&start_compositing_to(group));
     });
 
     thread_pool.shrink();
 
-    for (auto& functor : thread_functors)
+    for (auto functor : starting)
         functor->wait_until_started();
 }
 
-void mc::MultiThreadedCompositor::destroy_compositing_threads()
+auto mc::MultiThreadedCompositor::start_compositing_to(mg::DisplaySyncGroup& group) -> CompositingFunctor&
 {
-    for (auto& f : thread_functors)
-        f->stop();
+    auto thread_functor = std::make_unique<mc::CompositingFunctor>(
+        display_buffer_compositor_factory, group, scene, display_listener,
+        fixed_composite_delay, report);
+    auto& functor = *thread_functor;
+
+    std::lock_guard<std::mutex> lock{compositing_mutex};
+    if (lit_area.is_set())
+        functor.set_lit_area(lit_area.value());
+
+    auto future = thread_pool.run(std::ref(functor), &group);
+    compositing.push_back(GroupCompositing{&group, std::move(thread_functor), std::move(future)});
 
-    for (auto& f : futures)
-        f.wait();
+    return functor;
+}
+
+void mc::MultiThreadedCompositor::stop_compositing(std::vector<GroupCompositing>& stopping)
+{
+    for (auto& c : stopping)
+        c.functor->stop();
+
+    for (auto& c : stopping)
+        c.future.wait();
+}
+
+void mc::MultiThreadedCompositor::destroy_compositing_threads()
+{
+    std::vector<GroupCompositing> stopping;
+    {
+        std::lock_guard<std::mutex> lock{compositing_mutex};
+        stopping.swap(compositing);
+    }
 
-    thread_functors.clear();
-    futures.clear();
+    stop_compositing(stopping);
 }
@@ -20,6 +20,8 @@
 #define MIR_COMPOSITOR_MULTI_THREADED_COMPOSITOR_H_
 
 #include "mir/compositor/compositor.h"
+#include "mir/geometry/rectangles.h"
+#include "mir/optional_value.h"
 #include "mir/thread/basic_thread_pool.h"
 
 #include <mutex>
@@ -35,6 +37,8 @@ namespace geometry { struct Rectangle; }
 namespace graphics
 {
 class Display;
+class DisplaySyncGroup;
+class DisplayConfigurationObserver;
 }
 namespace scene
 {
@@ -74,9 +78,33 @@ public:
     void start();
     void stop();
 
+    /// Compositing to the other sync groups carries on undisturbed
+    void add_display_sync_group(graphics::DisplaySyncGroup& group) override;
+    void remove_display_sync_group(graphics::DisplaySyncGroup& group) override;
+
+    /**
+     * Tracks which outputs are powered on, so that compositing threads for outputs
+     * that cannot show anything can be parked. Register it for display configuration
+     * changes; until it receives a configuration every output is assumed to be lit.
+     */
+    auto display_configuration_observer() const -> std::shared_ptr<graphics::DisplayConfigurationObserver>;
+
 private:
+    class OutputPowerTracker;
+
+    struct GroupCompositing
+    {
+        graphics::DisplaySyncGroup* group;
+        std::unique_ptr<CompositingFunctor> functor;
+        std::future<void> future;
+    };
+
     void create_compositing_threads();
     void destroy_compositing_threads();
+    auto start_compositing_to(graphics::DisplaySyncGroup& group) -> CompositingFunctor&;
+    void stop_compositing_to(graphics::DisplaySyncGroup& group);
+    static void stop_compositing(std::vector<GroupCompositing>& stopping);
+    void update_lit_area(geometry::Rectangles const& lit_area);
 
     std::shared_ptr<graphics::Display> const display;
     std::shared_ptr<Scene> const scene;
@@ -84,9 +112,10 @@ private:
     std::shared_ptr<DisplayListener> const display_listener;
     std::shared_ptr<CompositorReport> const report;
 
-    std::vector<std::unique_ptr<CompositingFunctor>> thread_functors;
-    std::vector<std::future<void>> futures;
 
+    /// Held across start(), stop() and adding or removing a sync group, so that a group can't be
+    /// added while the compositing threads are being torn down (and then be left running)
+    std::mutex state_guard;
     std::atomic<CompositorState> state;
     std::chrono::milliseconds fixed_composite_delay;
     bool compose_on_start;
@@ -95,6 +124,12 @@ private:
     void schedule_compositing(int number_composites, geometry::Rectangle const& damage) const;
 
     std::shared_ptr<mir::scene::Observer> observer;
+    std::shared_ptr<OutputPowerTracker> const output_power_tracker;
+
+    /// Guards compositing and lit_area, as sync groups come and go while the scene schedules compositing
+    std::mutex mutable compositing_mutex;
+    std::vector<GroupCompositing> compositing;
+    optional_value<geometry::Rectangles> lit_area;
     mir::thread::BasicThreadPool thread_pool;
 };
 
@@ -21,6 +21,7 @@
 #include "queueing_schedule.h"
 #include "dropping_schedule.h"
 #include "mir/graphics/buffer.h"
+#include "mir/heap_accounting.h"
 #include <boost/throw_exception.hpp>
 
 namespace mc = mir::compositor;
@@ -53,16 +54,19 @@ void mc::Stream::submit_buffer(std::shared_ptr<mg::Buffer> const& buffer)
     if (!buffer)
         BOOST_THROW_EXCEPTION(std::invalid_argument("cannot submit null buffer"));
 
+    mir::heap_accounting::Scope const heap_scope{mir::heap_accounting::Subsystem::compositor};
+    geom::Size posted_size;
     {
         std::lock_guard<decltype(mutex)> lk(mutex); 
         first_frame_posted = true;
         pf = buffer->pixel_format();
         size = buffer->size();
+        posted_size = stream_size(lk);
         schedule->schedule(buffer);
     }
     {
         std::lock_guard<decltype(callback_mutex)> lock{callback_mutex};
-        frame_callback(buffer->size());
+        frame_callback(posted_size);
     }
 }
 
@@ -93,7 +97,43 @@ std::shared_ptr<mg::Buffer> mc::Stream::lock_compositor_buffer(void const* id)
 geom::Size mc::Stream::stream_size()
 {
     std::lock_guard<decltype(mutex)> lk(mutex);
-    return size;
+    return stream_size(lk);
+}
+
+geom::Rectangle mc::Stream::src_bounds()
+{
+    std::lock_guard<decltype(mutex)> lk(mutex);
+    return src_bounds(lk);
+}
+
+void mc::Stream::set_viewport(
+    std::experimental::optional<geom::Rectangle> const& source,
+    std::experimental::optional<geom::Size> const& destination)
+{
+    std::lock_guard<decltype(mutex)> lk(mutex);
+    viewport_source = source;
+    viewport_destination = destination;
+}
+
+auto mc::Stream::src_bounds(std::lock_guard<std::mutex> const&) const -> geom::Rectangle
+{
+    geom::Rectangle const whole_buffer{{}, size};
+
+    if (viewport_source)
+    {
+        // A source outside the buffer is a client error, but showing what there is does no harm
+        return viewport_source.value().intersection_with(whole_buffer);
+    }
+
+    return whole_buffer;
+}
+
+auto mc::Stream::stream_size(std::lock_guard<std::mutex> const& lock) const -> geom::Size
+{
+    if (viewport_destination)
+        return viewport_destination.value();
+
+    return src_bounds(lock).size;
 }
 
 void mc::Stream::allow_framedropping(bool dropping)
@@ -50,22 +50,30 @@ public:
     std::shared_ptr<graphics::Buffer>
         lock_compositor_buffer(void const* user_id) override;
     geometry::Size stream_size() override;
+    geometry::Rectangle src_bounds() override;
     void allow_framedropping(bool) override;
     bool framedropping() const override;
     int buffers_ready_for_compositor(void const* user_id) const override;
     void drop_old_buffers() override;
     bool has_submitted_buffer() const override;
     void set_scale(float scale) override;
+    void set_viewport(
+        std::experimental::optional<geometry::Rectangle> const& source,
+        std::experimental::optional<geometry::Size> const& destination) override;
 
 private:
     enum class ScheduleMode;
     void transition_schedule(std::shared_ptr<Schedule>&& new_schedule, std::lock_guard<std::mutex> const&);
+    auto src_bounds(std::lock_guard<std::mutex> const&) const -> geometry::Rectangle;
+    auto stream_size(std::lock_guard<std::mutex> const&) const -> geometry::Size;
 
     std::mutex mutable mutex;
     ScheduleMode schedule_mode;
     std::shared_ptr<Schedule> schedule;
     std::shared_ptr<MultiMonitorArbiter> const arbiter;
     geometry::Size size; 
+    std::experimental::optional<geometry::Rectangle> viewport_source;
+    std::experimental::optional<geometry::Size> viewport_destination;
     MirPixelFormat pf;
     bool first_frame_posted;
 
@@ -61,6 +61,7 @@ struct mir::DisplayServer::Private
           main_loop{config.the_main_loop()},
           server_status_listener{config.the_server_status_listener()},
           display_changer{config.the_display_changer()},
+          idle_handler{config.the_idle_handler()},
           stop_callback{config.the_stop_callback()}
     {
         display->register_configuration_change_handler(
@@ -199,6 +200,7 @@ struct mir::DisplayServer::Private
     std::shared_ptr<mir::MainLoop> const main_loop;
     std::shared_ptr<mir::ServerStatusListener> const server_status_listener;
     std::shared_ptr<mir::DisplayChanger> const display_changer;
+    std::shared_ptr<msh::IdleHandler> const idle_handler;
     std::function<void()> const stop_callback;
 
 };
@@ -0,0 +1,76 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "configure_throttle.h"
+
+#include <boost/throw_exception.hpp>
+
+#include <stdexcept>
+#include <string>
+
+namespace mf = mir::frontend;
+
+namespace
+{
+/// Whether serial a was generated before b, allowing for the serials wrapping around
+auto precedes(uint32_t a, uint32_t b) -> bool
+{
+    return static_cast<int32_t>(a - b) < 0;
+}
+}
+
+void mf::ConfigureThrottle::configure_sent(uint32_t serial)
+{
+    if (!inflight_configures.empty() && !precedes(inflight_configures.back(), serial))
+        BOOST_THROW_EXCEPTION(std::runtime_error("Generated invalid configure serial"));
+
+    inflight_configures.push_back(serial);
+    resize_held_back = false;
+}
+
+auto mf::ConfigureThrottle::configure_acked(uint32_t serial) -> bool
+{
+    while (!inflight_configures.empty() && precedes(inflight_configures.front(), serial))
+    {
+        inflight_configures.pop_front();
+    }
+
+    if (inflight_configures.empty() || inflight_configures.front() != serial)
+    {
+        BOOST_THROW_EXCEPTION(std::runtime_error(
+            "Could not find acked configure with serial " + std::to_string(serial)));
+    }
+
+    inflight_configures.pop_front();
+
+    return resize_held_back && inflight_configures.empty();
+}
+
+auto mf::ConfigureThrottle::resize_requested() -> bool
+{
+    if (configure_in_flight())
+    {
+        resize_held_back = true;
+        return false;
+    }
+
+    return true;
+}
+
+auto mf::ConfigureThrottle::configure_in_flight() const -> bool
+{
+    return !inflight_configures.empty();
+}
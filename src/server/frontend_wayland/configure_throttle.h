@@ -0,0 +1,61 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_FRONTEND_CONFIGURE_THROTTLE_H
+#define MIR_FRONTEND_CONFIGURE_THROTTLE_H
+
+#include <cstdint>
+#include <deque>
+
+namespace mir
+{
+namespace frontend
+{
+/// Tracks the configures sent to an xdg_surface, and holds back resizes while the client catches up
+///
+/// During an interactive resize the window manager can request sizes much faster than a client can draw
+/// them. At most one resize is kept in flight: sizes requested until the client acks it collapse into a
+/// single configure of the latest size.
+class ConfigureThrottle
+{
+public:
+    ConfigureThrottle() = default;
+
+    /// Records a configure sent with serial (which carries the latest size, so satisfies any held back resize)
+    void configure_sent(uint32_t serial);
+
+    /// Handles the client acking serial, which implicitly acks every configure sent before it
+    /// \throws std::runtime_error if no configure was sent with serial (or it has already been acked)
+    /// \returns true if a resize was held back and should now be sent
+    auto configure_acked(uint32_t serial) -> bool;
+
+    /// \returns true if the resize can be sent now, false if it is held back until configure_acked()
+    auto resize_requested() -> bool;
+
+    /// If a configure has been sent that the client has not yet acked
+    auto configure_in_flight() const -> bool;
+
+private:
+    ConfigureThrottle(ConfigureThrottle const&) = delete;
+    ConfigureThrottle& operator=(ConfigureThrottle const&) = delete;
+
+    std::deque<uint32_t> inflight_configures;
+    bool resize_held_back{false};
+};
+}
+}
+
+#endif // MIR_FRONTEND_CONFIGURE_THROTTLE_H
@@ -0,0 +1,116 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "idle_inhibit_v1.h"
+
+#include "idle-inhibit-unstable-v1_wrapper.h"
+#include "wl_surface.h"
+#include "mir/scene/idle_hub.h"
+
+#include <boost/throw_exception.hpp>
+
+namespace mf = mir::frontend;
+namespace ms = mir::scene;
+
+namespace mir
+{
+namespace frontend
+{
+class IdleInhibitManagerV1 : public wayland::IdleInhibitManagerV1::Global
+{
+public:
+    IdleInhibitManagerV1(struct wl_display* display, std::shared_ptr<scene::IdleHub> const& idle_hub);
+
+private:
+    class Instance : public wayland::IdleInhibitManagerV1
+    {
+    public:
+        Instance(wl_resource* new_resource, std::shared_ptr<scene::IdleHub> const& idle_hub);
+
+    private:
+        void destroy() override;
+        void create_inhibitor(wl_resource* id, wl_resource* surface) override;
+
+        std::shared_ptr<scene::IdleHub> const idle_hub;
+    };
+
+    void bind(wl_resource* new_resource) override;
+
+    std::shared_ptr<scene::IdleHub> const idle_hub;
+};
+
+/// Keeps the system from going idle for as long as the client holds it
+class IdleInhibitorV1 : public wayland::IdleInhibitorV1
+{
+public:
+    IdleInhibitorV1(wl_resource* new_resource, std::shared_ptr<scene::IdleHub::WakeLock> const& wake_lock);
+
+private:
+    void destroy() override;
+
+    std::shared_ptr<scene::IdleHub::WakeLock> const wake_lock;
+};
+}
+}
+
+auto mf::create_idle_inhibit_manager_v1(struct wl_display* display, std::shared_ptr<ms::IdleHub> const& idle_hub)
+    -> std::shared_ptr<IdleInhibitManagerV1>
+{
+    return std::make_shared<IdleInhibitManagerV1>(display, idle_hub);
+}
+
+mf::IdleInhibitManagerV1::IdleInhibitManagerV1(struct wl_display* display, std::shared_ptr<ms::IdleHub> const& idle_hub)
+    : Global(display, Version<1>()),
+      idle_hub{idle_hub}
+{
+}
+
+void mf::IdleInhibitManagerV1::bind(wl_resource* new_resource)
+{
+    new Instance{new_resource, idle_hub};
+}
+
+mf::IdleInhibitManagerV1::Instance::Instance(wl_resource* new_resource, std::shared_ptr<ms::IdleHub> const& idle_hub)
+    : IdleInhibitManagerV1{new_resource, Version<1>()},
+      idle_hub{idle_hub}
+{
+}
+
+void mf::IdleInhibitManagerV1::Instance::destroy()
+{
+    destroy_wayland_object();
+}
+
+void mf::IdleInhibitManagerV1::Instance::create_inhibitor(wl_resource* id, wl_resource* surface)
+{
+    if (!WlSurface::from(surface))
+    {
+        BOOST_THROW_EXCEPTION(std::runtime_error("zwp_idle_inhibit_manager_v1.create_inhibitor: not a wl_surface"));
+    }
+
+    new IdleInhibitorV1{id, idle_hub->inhibit_idle()};
+}
+
+mf::IdleInhibitorV1::IdleInhibitorV1(wl_resource* new_resource, std::shared_ptr<ms::IdleHub::WakeLock> const& wake_lock)
+    : wayland::IdleInhibitorV1{new_resource, Version<1>()},
+      wake_lock{wake_lock}
+{
+}
+
+void mf::IdleInhibitorV1::destroy()
+{
+    destroy_wayland_object();
+}
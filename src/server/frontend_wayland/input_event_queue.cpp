@@ -0,0 +1,266 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "input_event_queue.h"
+
+#include "mir/events/event_builders.h"
+#include "mir_toolkit/mir_cookie.h"
+
+namespace mf = mir::frontend;
+namespace mev = mir::events;
+
+namespace
+{
+/// Returns the pointer event if this is pointer motion, otherwise null
+auto pointer_motion(MirEvent const& event) -> MirPointerEvent const*
+{
+    if (mir_event_get_type(&event) != mir_event_type_input)
+        return nullptr;
+
+    auto const input_event = mir_event_get_input_event(&event);
+    if (mir_input_event_get_type(input_event) != mir_input_event_type_pointer)
+        return nullptr;
+
+    auto const pointer_event = mir_input_event_get_pointer_event(input_event);
+    if (mir_pointer_event_action(pointer_event) != mir_pointer_action_motion)
+        return nullptr;
+
+    return pointer_event;
+}
+
+/// Returns the touch event if every touch point in it is moving, otherwise null
+auto touch_motion(MirEvent const& event) -> MirTouchEvent const*
+{
+    if (mir_event_get_type(&event) != mir_event_type_input)
+        return nullptr;
+
+    auto const input_event = mir_event_get_input_event(&event);
+    if (mir_input_event_get_type(input_event) != mir_input_event_type_touch)
+        return nullptr;
+
+    auto const touch_event = mir_input_event_get_touch_event(input_event);
+    for (auto i = 0u; i != mir_touch_event_point_count(touch_event); ++i)
+    {
+        if (mir_touch_event_action(touch_event, i) != mir_touch_action_change)
+            return nullptr;
+    }
+
+    return touch_event;
+}
+
+auto is_motion(MirEvent const& event) -> bool
+{
+    return pointer_motion(event) || touch_motion(event);
+}
+
+auto device_of(MirPointerEvent const* event) -> MirInputDeviceId
+{
+    return mir_input_event_get_device_id(mir_pointer_event_input_event(event));
+}
+
+auto device_of(MirTouchEvent const* event) -> MirInputDeviceId
+{
+    return mir_input_event_get_device_id(mir_touch_event_input_event(event));
+}
+
+/// Motion that can be merged without losing anything but intermediate positions
+auto can_merge(MirPointerEvent const* older, MirPointerEvent const* newer) -> bool
+{
+    return device_of(older) == device_of(newer) &&
+           mir_pointer_event_buttons(older) == mir_pointer_event_buttons(newer) &&
+           mir_pointer_event_modifiers(older) == mir_pointer_event_modifiers(newer);
+}
+
+/// Touch positions are absolute, so the newer event supersedes the older if it moves every touch the older did
+auto supersedes(MirTouchEvent const* newer, MirTouchEvent const* older) -> bool
+{
+    if (device_of(older) != device_of(newer))
+        return false;
+
+    for (auto i = 0u; i != mir_touch_event_point_count(older); ++i)
+    {
+        auto const id = mir_touch_event_id(older, i);
+        bool found = false;
+        for (auto j = 0u; j != mir_touch_event_point_count(newer) && !found; ++j)
+        {
+            found = mir_touch_event_id(newer, j) == id;
+        }
+
+        if (!found)
+            return false;
+    }
+
+    return true;
+}
+
+/// The newer event, with the scroll and relative motion of both
+auto merge(MirPointerEvent const* older, MirPointerEvent const* newer) -> std::shared_ptr<MirEvent>
+{
+    auto const input_event = mir_pointer_event_input_event(newer);
+    std::vector<uint8_t> cookie_data;
+    if (mir_input_event_has_cookie(input_event))
+    {
+        auto cookie = mir_input_event_get_cookie(input_event);
+        cookie_data.resize(mir_cookie_buffer_size(cookie));
+        mir_cookie_to_buffer(cookie, cookie_data.data(), mir_cookie_buffer_size(cookie));
+        mir_cookie_release(cookie);
+    }
+
+    auto const sum = [&](MirPointerAxis axis)
+        {
+            return mir_pointer_event_axis_value(older, axis) + mir_pointer_event_axis_value(newer, axis);
+        };
+
+    auto merged = mev::make_event(
+        mir_input_event_get_device_id(input_event),
+        std::chrono::nanoseconds{mir_input_event_get_event_time(input_event)},
+        cookie_data,
+        mir_pointer_event_modifiers(newer),
+        mir_pointer_action_motion,
+        mir_pointer_event_buttons(newer),
+        mir_pointer_event_axis_value(newer, mir_pointer_axis_x),
+        mir_pointer_event_axis_value(newer, mir_pointer_axis_y),
+        sum(mir_pointer_axis_hscroll),
+        sum(mir_pointer_axis_vscroll),
+        sum(mir_pointer_axis_relative_x),
+        sum(mir_pointer_axis_relative_y));
+    mev::set_unaccelerated_motion(
+        *merged,
+        sum(mir_pointer_axis_relative_unaccelerated_x),
+        sum(mir_pointer_axis_relative_unaccelerated_y));
+    return merged;
+}
+}
+
+mf::InputEventQueue::InputEventQueue(size_t capacity, size_t limit)
+    : capacity{capacity},
+      limit{limit}
+{
+}
+
+auto mf::InputEventQueue::push(MirEvent const& event) -> bool
+{
+    std::shared_ptr<MirEvent> owned_event = mev::clone_event(event);
+
+    std::lock_guard<std::mutex> lock{mutex};
+
+    auto const motion = pointer_motion(event);
+    auto const tail_motion = events.empty() ? nullptr : pointer_motion(*events.back());
+    auto const touch = touch_motion(event);
+    auto const tail_touch = events.empty() ? nullptr : touch_motion(*events.back());
+    if (motion && tail_motion && can_merge(tail_motion, motion))
+    {
+        events.back() = merge(tail_motion, motion);
+    }
+    else if (touch && tail_touch && supersedes(touch, tail_touch))
+    {
+        events.back() = std::move(owned_event);
+    }
+    else
+    {
+        events.push_back(std::move(owned_event));
+    }
+
+    if (events.size() > capacity)
+    {
+        compact(lock);
+    }
+
+    if (events.size() > limit)
+    {
+        drop_oldest(lock);
+    }
+
+    if (delivery_scheduled)
+        return false;
+
+    delivery_scheduled = true;
+    return true;
+}
+
+auto mf::InputEventQueue::take() -> std::vector<std::shared_ptr<MirEvent>>
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    delivery_scheduled = false;
+
+    std::vector<std::shared_ptr<MirEvent>> result{
+        std::make_move_iterator(events.begin()),
+        std::make_move_iterator(events.end())};
+    events.clear();
+    return result;
+}
+
+auto mf::InputEventQueue::size() const -> size_t
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    return events.size();
+}
+
+void mf::InputEventQueue::compact(std::lock_guard<std::mutex> const&)
+{
+    // Walk backwards so each motion event is folded into the latest one after it. Key, button and touch
+    // transitions stay where they are; only the intermediate positions are lost.
+    std::deque<std::shared_ptr<MirEvent>> compacted;
+    std::shared_ptr<MirEvent>* later_motion = nullptr;
+    std::shared_ptr<MirEvent>* later_touch = nullptr;
+
+    for (auto i = events.rbegin(); i != events.rend(); ++i)
+    {
+        auto const motion = pointer_motion(**i);
+        if (motion && later_motion)
+        {
+            auto const later = pointer_motion(**later_motion);
+            if (device_of(motion) == device_of(later))
+            {
+                *later_motion = merge(motion, later);
+                continue;
+            }
+        }
+
+        // A touch that ended in between isn't in the later event, so motion before its end is kept
+        auto const touch = touch_motion(**i);
+        if (touch && later_touch && supersedes(touch_motion(**later_touch), touch))
+        {
+            continue;
+        }
+
+        compacted.push_front(std::move(*i));
+        if (motion)
+            later_motion = &compacted.front();
+        if (touch)
+            later_touch = &compacted.front();
+    }
+
+    events = std::move(compacted);
+}
+
+void mf::InputEventQueue::drop_oldest(std::lock_guard<std::mutex> const&)
+{
+    // Compaction has already merged what motion it can, so drop the oldest motion that's left. Only if
+    // that's not enough are transitions lost, oldest first: by then the client has long stopped reading.
+    for (auto i = events.begin(); i != events.end() && events.size() > limit;)
+    {
+        if (is_motion(**i))
+            i = events.erase(i);
+        else
+            ++i;
+    }
+
+    while (events.size() > limit)
+    {
+        events.pop_front();
+    }
+}
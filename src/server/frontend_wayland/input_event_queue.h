@@ -0,0 +1,73 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_FRONTEND_INPUT_EVENT_QUEUE_H
+#define MIR_FRONTEND_INPUT_EVENT_QUEUE_H
+
+#include "mir_toolkit/events/event.h"
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace mir
+{
+namespace frontend
+{
+/// Holds a surface's input events between the input thread and the thread that sends them to the client
+///
+/// Pointer motion (along with its scroll and relative components) and touch motion (per touch id) is
+/// coalesced, so a client that can't keep up gets fewer, larger motion events rather than an ever-growing
+/// backlog. Key, button and touch transitions are only dropped once the queue reaches its limit. Threadsafe.
+class InputEventQueue
+{
+public:
+    /// Once more than capacity events are waiting, motion is also coalesced across other events. No more
+    /// than limit events are kept: beyond it the oldest motion is dropped, then the oldest of any event.
+    InputEventQueue(size_t capacity, size_t limit);
+
+    /// Adds a copy of the event
+    /// \returns true if the caller should schedule a delivery (none is currently scheduled)
+    auto push(MirEvent const& event) -> bool;
+
+    /// Removes and returns all waiting events, completing the scheduled delivery
+    /// A delivery that finds the client not reading should retry later rather than take(): the events keep
+    /// coalescing meanwhile, and push() doesn't schedule another delivery.
+    auto take() -> std::vector<std::shared_ptr<MirEvent>>;
+
+    auto size() const -> size_t;
+
+private:
+    InputEventQueue(InputEventQueue const&) = delete;
+    InputEventQueue& operator=(InputEventQueue const&) = delete;
+
+    /// Folds each motion event into the next motion event from the same device
+    void compact(std::lock_guard<std::mutex> const&);
+    /// Brings the queue down to limit
+    void drop_oldest(std::lock_guard<std::mutex> const&);
+
+    size_t const capacity;
+    size_t const limit;
+
+    std::mutex mutable mutex;
+    std::deque<std::shared_ptr<MirEvent>> events;
+    bool delivery_scheduled{false};
+};
+}
+}
+
+#endif // MIR_FRONTEND_INPUT_EVENT_QUEUE_H
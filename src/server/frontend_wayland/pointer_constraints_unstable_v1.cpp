@@ -0,0 +1,501 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pointer_constraints_unstable_v1.h"
+
+#include "pointer-constraints-unstable-v1_wrapper.h"
+#include "wl_pointer.h"
+#include "wl_region.h"
+#include "wl_surface.h"
+#include "deleted_for_resource.h"
+
+#include "mir/shell/shell.h"
+#include "mir/shell/surface_specification.h"
+
+#include <boost/throw_exception.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace mf = mir::frontend;
+namespace geom = mir::geometry;
+namespace ms = mir::scene;
+namespace msh = mir::shell;
+namespace mw = mir::wayland;
+
+namespace mir
+{
+namespace frontend
+{
+/// The (surface, pointer) pairs that have a constraint, which may only have one at a time
+using ConstrainedPointers = std::set<std::pair<WlSurface const*, WlPointer const*>>;
+
+/// A constraint region in surface coordinates, nullopt being the whole surface
+using ConstraintRegion = std::experimental::optional<std::vector<geom::Rectangle>>;
+
+class PointerConstraintsV1 : public wayland::PointerConstraintsV1::Global
+{
+public:
+    PointerConstraintsV1(struct wl_display* display, std::shared_ptr<msh::Shell> shell);
+
+private:
+    class Instance : public wayland::PointerConstraintsV1
+    {
+    public:
+        Instance(wl_resource* new_resource, frontend::PointerConstraintsV1* constraints);
+
+    private:
+        void destroy() override;
+        void lock_pointer(
+            wl_resource* id,
+            wl_resource* surface,
+            wl_resource* pointer,
+            std::experimental::optional<wl_resource*> const& region,
+            uint32_t lifetime) override;
+        void confine_pointer(
+            wl_resource* id,
+            wl_resource* surface,
+            wl_resource* pointer,
+            std::experimental::optional<wl_resource*> const& region,
+            uint32_t lifetime) override;
+
+        /// Posts already_constrained and returns false if the pair is taken
+        auto can_constrain(WlSurface* surface, WlPointer* pointer) -> bool;
+
+        frontend::PointerConstraintsV1* const constraints;
+    };
+
+    void bind(wl_resource* new_resource) override;
+
+    std::shared_ptr<msh::Shell> const shell;
+    std::shared_ptr<ConstrainedPointers> const constrained;
+};
+
+/// Applies a constraint to the scene surface while the pointer is focused on the constrained surface
+class PointerConstraint
+{
+public:
+    PointerConstraint(
+        std::shared_ptr<msh::Shell> const& shell,
+        std::shared_ptr<ConstrainedPointers> const& constrained,
+        WlSurface* surface,
+        WlPointer* pointer,
+        std::experimental::optional<wl_resource*> const& region,
+        uint32_t lifetime,
+        MirPointerConfinementState state,
+        std::function<void(bool active)> const& notify);
+
+    ~PointerConstraint();
+
+    /// The region takes effect when the surface next commits
+    void set_pending_region(std::experimental::optional<wl_resource*> const& region);
+
+private:
+    PointerConstraint(PointerConstraint const&) = delete;
+    PointerConstraint& operator=(PointerConstraint const&) = delete;
+
+    void focus_changed(std::experimental::optional<WlSurface*> const& focus);
+    void surface_committed();
+    auto pointer_in_region() const -> bool;
+    void activate();
+    void deactivate(bool notify_client);
+
+    std::shared_ptr<msh::Shell> const shell;
+    std::shared_ptr<ConstrainedPointers> const constrained;
+    WlSurface* const surface;
+    WlPointer* const pointer;
+    std::shared_ptr<bool> const surface_destroyed;
+    std::shared_ptr<bool> const pointer_destroyed;
+    uint32_t const lifetime;
+    MirPointerConfinementState const state;
+    std::function<void(bool active)> const notify;
+
+    ConstraintRegion region;
+    std::experimental::optional<ConstraintRegion> pending_region;
+    bool active{false};
+    bool defunct{false};
+    std::shared_ptr<ms::Session> session;
+    std::weak_ptr<ms::Surface> scene_surface;
+};
+
+class LockedPointerV1 : public wayland::LockedPointerV1
+{
+public:
+    LockedPointerV1(
+        wl_resource* new_resource,
+        std::shared_ptr<msh::Shell> const& shell,
+        std::shared_ptr<ConstrainedPointers> const& constrained,
+        WlSurface* surface,
+        WlPointer* pointer,
+        std::experimental::optional<wl_resource*> const& region,
+        uint32_t lifetime);
+
+private:
+    void destroy() override;
+    void set_cursor_position_hint(double surface_x, double surface_y) override;
+    void set_region(std::experimental::optional<wl_resource*> const& region) override;
+
+    PointerConstraint constraint;
+};
+
+class ConfinedPointerV1 : public wayland::ConfinedPointerV1
+{
+public:
+    ConfinedPointerV1(
+        wl_resource* new_resource,
+        std::shared_ptr<msh::Shell> const& shell,
+        std::shared_ptr<ConstrainedPointers> const& constrained,
+        WlSurface* surface,
+        WlPointer* pointer,
+        std::experimental::optional<wl_resource*> const& region,
+        uint32_t lifetime);
+
+private:
+    void destroy() override;
+    void set_region(std::experimental::optional<wl_resource*> const& region) override;
+
+    PointerConstraint constraint;
+};
+}
+}
+
+namespace
+{
+auto region_from(std::experimental::optional<wl_resource*> const& region) -> mf::ConstraintRegion
+{
+    if (region)
+    {
+        return mf::WlRegion::from(region.value())->rectangle_vector();
+    }
+    return std::experimental::nullopt;
+}
+}
+
+auto mf::create_pointer_constraints_unstable_v1(struct wl_display* display, std::shared_ptr<msh::Shell> shell)
+    -> std::shared_ptr<PointerConstraintsV1>
+{
+    return std::make_shared<PointerConstraintsV1>(display, std::move(shell));
+}
+
+mf::PointerConstraintsV1::PointerConstraintsV1(struct wl_display* display, std::shared_ptr<msh::Shell> shell)
+    : Global(display, Version<1>()),
+      shell{std::move(shell)},
+      constrained{std::make_shared<ConstrainedPointers>()}
+{
+}
+
+void mf::PointerConstraintsV1::bind(wl_resource* new_resource)
+{
+    new Instance{new_resource, this};
+}
+
+mf::PointerConstraintsV1::Instance::Instance(wl_resource* new_resource, mf::PointerConstraintsV1* constraints)
+    : PointerConstraintsV1{new_resource, Version<1>()},
+      constraints{constraints}
+{
+}
+
+void mf::PointerConstraintsV1::Instance::destroy()
+{
+    destroy_wayland_object();
+}
+
+void mf::PointerConstraintsV1::Instance::lock_pointer(
+    wl_resource* id,
+    wl_resource* surface,
+    wl_resource* pointer,
+    std::experimental::optional<wl_resource*> const& region,
+    uint32_t lifetime)
+{
+    auto const wl_surface = WlSurface::from(surface);
+    auto const wl_pointer = WlPointer::from(pointer);
+
+    if (can_constrain(wl_surface, wl_pointer))
+    {
+        new LockedPointerV1{id, constraints->shell, constraints->constrained, wl_surface, wl_pointer, region, lifetime};
+    }
+}
+
+void mf::PointerConstraintsV1::Instance::confine_pointer(
+    wl_resource* id,
+    wl_resource* surface,
+    wl_resource* pointer,
+    std::experimental::optional<wl_resource*> const& region,
+    uint32_t lifetime)
+{
+    auto const wl_surface = WlSurface::from(surface);
+    auto const wl_pointer = WlPointer::from(pointer);
+
+    if (can_constrain(wl_surface, wl_pointer))
+    {
+        new ConfinedPointerV1{id, constraints->shell, constraints->constrained, wl_surface, wl_pointer, region, lifetime};
+    }
+}
+
+auto mf::PointerConstraintsV1::Instance::can_constrain(WlSurface* surface, WlPointer* pointer) -> bool
+{
+    if (!pointer)
+    {
+        BOOST_THROW_EXCEPTION(std::runtime_error("zwp_pointer_constraints_v1: not a wl_pointer"));
+    }
+
+    if (constraints->constrained->count({surface, pointer}))
+    {
+        wl_resource_post_error(
+            resource,
+            Error::already_constrained,
+            "A pointer constraint already exists for that surface and pointer");
+        return false;
+    }
+
+    return true;
+}
+
+mf::PointerConstraint::PointerConstraint(
+    std::shared_ptr<msh::Shell> const& shell,
+    std::shared_ptr<ConstrainedPointers> const& constrained,
+    WlSurface* surface,
+    WlPointer* pointer,
+    std::experimental::optional<wl_resource*> const& region,
+    uint32_t lifetime,
+    MirPointerConfinementState state,
+    std::function<void(bool active)> const& notify)
+    : shell{shell},
+      constrained{constrained},
+      surface{surface},
+      pointer{pointer},
+      surface_destroyed{surface->destroyed_flag()},
+      pointer_destroyed{deleted_flag_for_resource(pointer->resource)},
+      lifetime{lifetime},
+      state{state},
+      notify{notify},
+      region{region_from(region)}
+{
+    constrained->insert({surface, pointer});
+
+    surface->add_destroy_listener(this, [this]
+        {
+            deactivate(true);
+            defunct = true;
+        });
+
+    surface->add_commit_listener(this, [this] { surface_committed(); });
+
+    pointer->add_focus_listener(this, [this](auto const& focus) { focus_changed(focus); });
+
+    focus_changed(pointer->focused_surface());
+}
+
+mf::PointerConstraint::~PointerConstraint()
+{
+    deactivate(false);
+
+    if (!*pointer_destroyed)
+    {
+        pointer->remove_focus_listener(this);
+    }
+
+    if (!*surface_destroyed)
+    {
+        surface->remove_destroy_listener(this);
+        surface->remove_commit_listener(this);
+    }
+
+    constrained->erase({surface, pointer});
+}
+
+void mf::PointerConstraint::set_pending_region(std::experimental::optional<wl_resource*> const& region)
+{
+    pending_region = region_from(region);
+}
+
+void mf::PointerConstraint::focus_changed(std::experimental::optional<WlSurface*> const& focus)
+{
+    if (focus && focus.value() == surface)
+    {
+        // The constraint waits for the pointer to move into the region, and then keeps it there
+        if (pointer_in_region())
+            activate();
+    }
+    else
+    {
+        deactivate(true);
+    }
+}
+
+void mf::PointerConstraint::surface_committed()
+{
+    if (!pending_region)
+        return;
+
+    region = std::move(pending_region.value());
+    pending_region = std::experimental::nullopt;
+
+    if (active)
+    {
+        if (state == mir_pointer_confined_to_window)
+        {
+            if (auto const window = scene_surface.lock())
+            {
+                msh::SurfaceSpecification spec;
+                spec.confinement_region = region.value_or(std::vector<geom::Rectangle>{});
+                shell->modify_surface(session, window, spec);
+            }
+        }
+    }
+    else if (!*pointer_destroyed)
+    {
+        focus_changed(pointer->focused_surface());
+    }
+}
+
+auto mf::PointerConstraint::pointer_in_region() const -> bool
+{
+    if (!region)
+        return true;
+
+    auto const position = pointer->position_on_focused_surface();
+    return std::any_of(begin(region.value()), end(region.value()),
+        [&](geom::Rectangle const& rect) { return rect.contains(position); });
+}
+
+void mf::PointerConstraint::activate()
+{
+    if (active || defunct || *surface_destroyed)
+        return;
+
+    auto const window = surface->scene_surface();
+    if (!window)
+        return;
+
+    session = surface->session;
+    scene_surface = window.value();
+
+    msh::SurfaceSpecification spec;
+    spec.confine_pointer = state;
+    if (state == mir_pointer_confined_to_window)
+    {
+        spec.confinement_region = region.value_or(std::vector<geom::Rectangle>{});
+    }
+    shell->modify_surface(session, window.value(), spec);
+
+    if (state == mir_pointer_locked_to_window && !*pointer_destroyed)
+    {
+        pointer->set_locked(true);
+    }
+
+    active = true;
+    notify(true);
+}
+
+void mf::PointerConstraint::deactivate(bool notify_client)
+{
+    if (!active)
+        return;
+
+    active = false;
+
+    if (auto const window = scene_surface.lock())
+    {
+        msh::SurfaceSpecification spec;
+        spec.confine_pointer = mir_pointer_unconfined;
+        spec.confinement_region = std::vector<geom::Rectangle>{};
+        shell->modify_surface(session, window, spec);
+    }
+
+    if (state == mir_pointer_locked_to_window && !*pointer_destroyed)
+    {
+        pointer->set_locked(false);
+    }
+
+    if (lifetime == mw::PointerConstraintsV1::Lifetime::oneshot)
+    {
+        defunct = true;
+    }
+
+    if (notify_client)
+    {
+        notify(false);
+    }
+}
+
+mf::LockedPointerV1::LockedPointerV1(
+    wl_resource* new_resource,
+    std::shared_ptr<msh::Shell> const& shell,
+    std::shared_ptr<ConstrainedPointers> const& constrained,
+    WlSurface* surface,
+    WlPointer* pointer,
+    std::experimental::optional<wl_resource*> const& region,
+    uint32_t lifetime)
+    : mw::LockedPointerV1{new_resource, Version<1>()},
+      constraint{shell, constrained, surface, pointer, region, lifetime, mir_pointer_locked_to_window,
+          [this](bool active)
+          {
+              if (active)
+                  send_locked_event();
+              else
+                  send_unlocked_event();
+          }}
+{
+}
+
+void mf::LockedPointerV1::destroy()
+{
+    destroy_wayland_object();
+}
+
+void mf::LockedPointerV1::set_cursor_position_hint(double /*surface_x*/, double /*surface_y*/)
+{
+    // The cursor is hidden while locked, and shown where it was locked on unlocking
+}
+
+void mf::LockedPointerV1::set_region(std::experimental::optional<wl_resource*> const& region)
+{
+    constraint.set_pending_region(region);
+}
+
+mf::ConfinedPointerV1::ConfinedPointerV1(
+    wl_resource* new_resource,
+    std::shared_ptr<msh::Shell> const& shell,
+    std::shared_ptr<ConstrainedPointers> const& constrained,
+    WlSurface* surface,
+    WlPointer* pointer,
+    std::experimental::optional<wl_resource*> const& region,
+    uint32_t lifetime)
+    : mw::ConfinedPointerV1{new_resource, Version<1>()},
+      constraint{shell, constrained, surface, pointer, region, lifetime, mir_pointer_confined_to_window,
+          [this](bool active)
+          {
+              if (active)
+                  send_confined_event();
+              else
+                  send_unconfined_event();
+          }}
+{
+}
+
+void mf::ConfinedPointerV1::destroy()
+{
+    destroy_wayland_object();
+}
+
+void mf::ConfinedPointerV1::set_region(std::experimental::optional<wl_resource*> const& region)
+{
+    constraint.set_pending_region(region);
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pointer_gestures_unstable_v1.h"
+
+#include "wl_pointer.h"
+#include "wl_surface.h"
+#include "deleted_for_resource.h"
+
+#include <boost/throw_exception.hpp>
+
+namespace mf = mir::frontend;
+namespace mw = mir::wayland;
+
+namespace mir
+{
+namespace frontend
+{
+class PointerGesturesV1 : public wayland::PointerGesturesV1::Global
+{
+public:
+    PointerGesturesV1(struct wl_display* display);
+
+private:
+    class Instance : public wayland::PointerGesturesV1
+    {
+    public:
+        Instance(wl_resource* new_resource);
+
+    private:
+        void get_swipe_gesture(wl_resource* id, wl_resource* pointer) override;
+        void get_pinch_gesture(wl_resource* id, wl_resource* pointer) override;
+    };
+
+    void bind(wl_resource* new_resource) override;
+};
+}
+}
+
+namespace
+{
+auto pointer_from(wl_resource* pointer, char const* request) -> mf::WlPointer*
+{
+    auto const wl_pointer = mf::WlPointer::from(pointer);
+    if (!wl_pointer)
+    {
+        BOOST_THROW_EXCEPTION(std::runtime_error(
+            std::string{"zwp_pointer_gestures_v1."} + request + ": not a wl_pointer"));
+    }
+    return wl_pointer;
+}
+}
+
+auto mf::create_pointer_gestures_v1(struct wl_display* display)
+    -> std::shared_ptr<PointerGesturesV1>
+{
+    return std::make_shared<PointerGesturesV1>(display);
+}
+
+mf::PointerGesturesV1::PointerGesturesV1(struct wl_display* display)
+    : Global(display, Version<1>())
+{
+}
+
+void mf::PointerGesturesV1::bind(wl_resource* new_resource)
+{
+    new Instance{new_resource};
+}
+
+mf::PointerGesturesV1::Instance::Instance(wl_resource* new_resource)
+    : PointerGesturesV1{new_resource, Version<1>()}
+{
+}
+
+void mf::PointerGesturesV1::Instance::get_swipe_gesture(wl_resource* id, wl_resource* pointer)
+{
+    new PointerGestureSwipeV1{id, pointer_from(pointer, "get_swipe_gesture")};
+}
+
+void mf::PointerGesturesV1::Instance::get_pinch_gesture(wl_resource* id, wl_resource* pointer)
+{
+    new PointerGesturePinchV1{id, pointer_from(pointer, "get_pinch_gesture")};
+}
+
+mf::PointerGestureSwipeV1::PointerGestureSwipeV1(wl_resource* new_resource, WlPointer* pointer)
+    : mw::PointerGestureSwipeV1{new_resource, Version<1>()},
+      pointer{pointer},
+      pointer_destroyed{deleted_flag_for_resource(pointer->resource)}
+{
+    pointer->add_swipe_gesture(this);
+}
+
+mf::PointerGestureSwipeV1::~PointerGestureSwipeV1()
+{
+    if (!*pointer_destroyed)
+    {
+        pointer->remove_swipe_gesture(this);
+    }
+}
+
+void mf::PointerGestureSwipeV1::begin(
+    uint32_t serial,
+    std::chrono::milliseconds const& ms,
+    WlSurface* surface,
+    uint32_t fingers)
+{
+    send_begin_event(serial, ms.count(), surface->raw_resource(), fingers);
+    active = true;
+}
+
+void mf::PointerGestureSwipeV1::update(std::chrono::milliseconds const& ms, float dx, float dy)
+{
+    if (active)
+        send_update_event(ms.count(), dx, dy);
+}
+
+void mf::PointerGestureSwipeV1::end(uint32_t serial, std::chrono::milliseconds const& ms, bool cancelled)
+{
+    if (active)
+        send_end_event(serial, ms.count(), cancelled);
+    active = false;
+}
+
+void mf::PointerGestureSwipeV1::destroy()
+{
+    destroy_wayland_object();
+}
+
+mf::PointerGesturePinchV1::PointerGesturePinchV1(wl_resource* new_resource, WlPointer* pointer)
+    : mw::PointerGesturePinchV1{new_resource, Version<1>()},
+      pointer{pointer},
+      pointer_destroyed{deleted_flag_for_resource(pointer->resource)}
+{
+    pointer->add_pinch_gesture(this);
+}
+
+mf::PointerGesturePinchV1::~PointerGesturePinchV1()
+{
+    if (!*pointer_destroyed)
+    {
+        pointer->remove_pinch_gesture(this);
+    }
+}
+
+void mf::PointerGesturePinchV1::begin(
+    uint32_t serial,
+    std::chrono::milliseconds const& ms,
+    WlSurface* surface,
+    uint32_t fingers)
+{
+    send_begin_event(serial, ms.count(), surface->raw_resource(), fingers);
+    active = true;
+}
+
+void mf::PointerGesturePinchV1::update(
+    std::chrono::milliseconds const& ms,
+    float dx,
+    float dy,
+    float scale,
+    float rotation)
+{
+    if (active)
+        send_update_event(ms.count(), dx, dy, scale, rotation);
+}
+
+void mf::PointerGesturePinchV1::end(uint32_t serial, std::chrono::milliseconds const& ms, bool cancelled)
+{
+    if (active)
+        send_end_event(serial, ms.count(), cancelled);
+    active = false;
+}
+
+void mf::PointerGesturePinchV1::destroy()
+{
+    destroy_wayland_object();
+}
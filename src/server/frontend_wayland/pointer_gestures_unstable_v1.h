@@ -0,0 +1,75 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_FRONTEND_POINTER_GESTURES_UNSTABLE_V1_H
+#define MIR_FRONTEND_POINTER_GESTURES_UNSTABLE_V1_H
+
+#include "pointer-gestures-unstable-v1_wrapper.h"
+
+#include <chrono>
+#include <memory>
+
+namespace mir
+{
+namespace frontend
+{
+class PointerGesturesV1;
+class WlPointer;
+class WlSurface;
+
+auto create_pointer_gestures_v1(struct wl_display* display)
+    -> std::shared_ptr<PointerGesturesV1>;
+
+/// A gesture is only updated and ended for clients that saw it begin
+class PointerGestureSwipeV1 : public wayland::PointerGestureSwipeV1
+{
+public:
+    PointerGestureSwipeV1(wl_resource* new_resource, WlPointer* pointer);
+    ~PointerGestureSwipeV1();
+
+    void begin(uint32_t serial, std::chrono::milliseconds const& ms, WlSurface* surface, uint32_t fingers);
+    void update(std::chrono::milliseconds const& ms, float dx, float dy);
+    void end(uint32_t serial, std::chrono::milliseconds const& ms, bool cancelled);
+
+private:
+    void destroy() override;
+
+    WlPointer* const pointer;
+    std::shared_ptr<bool> const pointer_destroyed;
+    bool active{false};
+};
+
+class PointerGesturePinchV1 : public wayland::PointerGesturePinchV1
+{
+public:
+    PointerGesturePinchV1(wl_resource* new_resource, WlPointer* pointer);
+    ~PointerGesturePinchV1();
+
+    void begin(uint32_t serial, std::chrono::milliseconds const& ms, WlSurface* surface, uint32_t fingers);
+    void update(std::chrono::milliseconds const& ms, float dx, float dy, float scale, float rotation);
+    void end(uint32_t serial, std::chrono::milliseconds const& ms, bool cancelled);
+
+private:
+    void destroy() override;
+
+    WlPointer* const pointer;
+    std::shared_ptr<bool> const pointer_destroyed;
+    bool active{false};
+};
+}
+}
+
+#endif // MIR_FRONTEND_POINTER_GESTURES_UNSTABLE_V1_H
@@ -0,0 +1,120 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "relative_pointer_unstable_v1.h"
+
+#include "wl_pointer.h"
+#include "deleted_for_resource.h"
+
+#include <boost/throw_exception.hpp>
+
+namespace mf = mir::frontend;
+namespace mw = mir::wayland;
+
+namespace mir
+{
+namespace frontend
+{
+class RelativePointerManagerV1 : public wayland::RelativePointerManagerV1::Global
+{
+public:
+    RelativePointerManagerV1(struct wl_display* display);
+
+private:
+    class Instance : public wayland::RelativePointerManagerV1
+    {
+    public:
+        Instance(wl_resource* new_resource);
+
+    private:
+        void destroy() override;
+        void get_relative_pointer(wl_resource* id, wl_resource* pointer) override;
+    };
+
+    void bind(wl_resource* new_resource) override;
+};
+}
+}
+
+auto mf::create_relative_pointer_manager_v1(struct wl_display* display)
+    -> std::shared_ptr<RelativePointerManagerV1>
+{
+    return std::make_shared<RelativePointerManagerV1>(display);
+}
+
+mf::RelativePointerManagerV1::RelativePointerManagerV1(struct wl_display* display)
+    : Global(display, Version<1>())
+{
+}
+
+void mf::RelativePointerManagerV1::bind(wl_resource* new_resource)
+{
+    new Instance{new_resource};
+}
+
+mf::RelativePointerManagerV1::Instance::Instance(wl_resource* new_resource)
+    : RelativePointerManagerV1{new_resource, Version<1>()}
+{
+}
+
+void mf::RelativePointerManagerV1::Instance::destroy()
+{
+    destroy_wayland_object();
+}
+
+void mf::RelativePointerManagerV1::Instance::get_relative_pointer(wl_resource* id, wl_resource* pointer)
+{
+    auto const wl_pointer = WlPointer::from(pointer);
+    if (!wl_pointer)
+    {
+        BOOST_THROW_EXCEPTION(std::runtime_error("zwp_relative_pointer_manager_v1.get_relative_pointer: not a wl_pointer"));
+    }
+
+    new RelativePointerV1{id, wl_pointer};
+}
+
+mf::RelativePointerV1::RelativePointerV1(wl_resource* new_resource, WlPointer* pointer)
+    : mw::RelativePointerV1{new_resource, Version<1>()},
+      pointer{pointer},
+      pointer_destroyed{deleted_flag_for_resource(pointer->resource)}
+{
+    pointer->add_relative_pointer(this);
+}
+
+mf::RelativePointerV1::~RelativePointerV1()
+{
+    if (!*pointer_destroyed)
+    {
+        pointer->remove_relative_pointer(this);
+    }
+}
+
+void mf::RelativePointerV1::send_relative_motion(
+    std::chrono::nanoseconds const& ns,
+    float dx,
+    float dy,
+    float dx_unaccelerated,
+    float dy_unaccelerated)
+{
+    auto const us = std::chrono::duration_cast<std::chrono::microseconds>(ns).count();
+
+    send_relative_motion_event(us >> 32, us & 0xffffffff, dx, dy, dx_unaccelerated, dy_unaccelerated);
+}
+
+void mf::RelativePointerV1::destroy()
+{
+    destroy_wayland_object();
+}
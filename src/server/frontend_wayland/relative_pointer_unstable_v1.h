@@ -0,0 +1,57 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_FRONTEND_RELATIVE_POINTER_UNSTABLE_V1_H
+#define MIR_FRONTEND_RELATIVE_POINTER_UNSTABLE_V1_H
+
+#include "relative-pointer-unstable-v1_wrapper.h"
+
+#include <chrono>
+#include <memory>
+
+namespace mir
+{
+namespace frontend
+{
+class RelativePointerManagerV1;
+class WlPointer;
+
+auto create_relative_pointer_manager_v1(struct wl_display* display)
+    -> std::shared_ptr<RelativePointerManagerV1>;
+
+class RelativePointerV1 : public wayland::RelativePointerV1
+{
+public:
+    RelativePointerV1(wl_resource* new_resource, WlPointer* pointer);
+    ~RelativePointerV1();
+
+    void send_relative_motion(
+        std::chrono::nanoseconds const& ns,
+        float dx,
+        float dy,
+        float dx_unaccelerated,
+        float dy_unaccelerated);
+
+private:
+    void destroy() override;
+
+    WlPointer* const pointer;
+    std::shared_ptr<bool> const pointer_destroyed;
+};
+}
+}
+
+#endif // MIR_FRONTEND_RELATIVE_POINTER_UNSTABLE_V1_H
@@ -0,0 +1,124 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "single_pixel_buffer_v1.h"
+
+#include "single-pixel-buffer-v1_wrapper.h"
+#include "wayland_wrapper.h"
+
+#include <limits>
+
+namespace mf = mir::frontend;
+namespace mg = mir::graphics;
+namespace mw = mir::wayland;
+
+namespace mir
+{
+namespace frontend
+{
+class SinglePixelBufferManagerV1 : public wayland::SinglePixelBufferManagerV1::Global
+{
+public:
+    SinglePixelBufferManagerV1(struct wl_display* display);
+
+private:
+    class Instance : public wayland::SinglePixelBufferManagerV1
+    {
+    public:
+        Instance(wl_resource* new_resource);
+
+    private:
+        void destroy() override;
+        void create_u32_rgba_buffer(wl_resource* id, uint32_t r, uint32_t g, uint32_t b, uint32_t a) override;
+    };
+
+    void bind(wl_resource* new_resource) override;
+};
+
+class SinglePixelBuffer : public wayland::Buffer
+{
+public:
+    SinglePixelBuffer(wl_resource* new_resource, graphics::SolidColourBuffer::Colour const& colour);
+
+    graphics::SolidColourBuffer::Colour const colour;
+
+private:
+    void destroy() override;
+};
+}
+}
+
+auto mf::create_single_pixel_buffer_manager_v1(struct wl_display* display)
+    -> std::shared_ptr<SinglePixelBufferManagerV1>
+{
+    return std::make_shared<SinglePixelBufferManagerV1>(display);
+}
+
+auto mf::single_pixel_buffer_colour(wl_resource* buffer)
+    -> std::experimental::optional<mg::SolidColourBuffer::Colour>
+{
+    if (mw::Buffer::is_instance(buffer))
+    {
+        if (auto const single_pixel_buffer = dynamic_cast<SinglePixelBuffer*>(mw::Buffer::from(buffer)))
+        {
+            return single_pixel_buffer->colour;
+        }
+    }
+
+    return std::experimental::nullopt;
+}
+
+mf::SinglePixelBufferManagerV1::SinglePixelBufferManagerV1(struct wl_display* display)
+    : Global(display, Version<1>())
+{
+}
+
+void mf::SinglePixelBufferManagerV1::bind(wl_resource* new_resource)
+{
+    new Instance{new_resource};
+}
+
+mf::SinglePixelBufferManagerV1::Instance::Instance(wl_resource* new_resource)
+    : SinglePixelBufferManagerV1{new_resource, Version<1>()}
+{
+}
+
+void mf::SinglePixelBufferManagerV1::Instance::destroy()
+{
+    destroy_wayland_object();
+}
+
+void mf::SinglePixelBufferManagerV1::Instance::create_u32_rgba_buffer(
+    wl_resource* id, uint32_t r, uint32_t g, uint32_t b, uint32_t a)
+{
+    auto const to_float = [](uint32_t value)
+        {
+            return static_cast<float>(static_cast<double>(value) / std::numeric_limits<uint32_t>::max());
+        };
+
+    new SinglePixelBuffer{id, {to_float(r), to_float(g), to_float(b), to_float(a)}};
+}
+
+mf::SinglePixelBuffer::SinglePixelBuffer(wl_resource* new_resource, mg::SolidColourBuffer::Colour const& colour)
+    : Buffer{new_resource, Version<1>()},
+      colour(colour)
+{
+}
+
+void mf::SinglePixelBuffer::destroy()
+{
+    destroy_wayland_object();
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_FRONTEND_SINGLE_PIXEL_BUFFER_V1_H
+#define MIR_FRONTEND_SINGLE_PIXEL_BUFFER_V1_H
+
+#include "mir/graphics/solid_colour_buffer.h"
+
+#include <experimental/optional>
+#include <memory>
+
+struct wl_display;
+struct wl_resource;
+
+namespace mir
+{
+namespace frontend
+{
+class SinglePixelBufferManagerV1;
+
+auto create_single_pixel_buffer_manager_v1(struct wl_display* display)
+    -> std::shared_ptr<SinglePixelBufferManagerV1>;
+
+/// The colour of a wl_buffer if it was created by wp_single_pixel_buffer_manager_v1
+auto single_pixel_buffer_colour(wl_resource* buffer)
+    -> std::experimental::optional<graphics::SolidColourBuffer::Colour>;
+}
+}
+
+#endif // MIR_FRONTEND_SINGLE_PIXEL_BUFFER_V1_H
@@ -0,0 +1,192 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "viewporter.h"
+
+#include "viewporter_wrapper.h"
+#include "wl_surface.h"
+
+#include <cmath>
+
+namespace mf = mir::frontend;
+namespace mw = mir::wayland;
+namespace geom = mir::geometry;
+
+namespace mir
+{
+namespace frontend
+{
+class Viewporter : public wayland::Viewporter::Global
+{
+public:
+    Viewporter(struct wl_display* display);
+
+private:
+    class Instance : public wayland::Viewporter
+    {
+    public:
+        Instance(wl_resource* new_resource);
+
+    private:
+        void destroy() override;
+        void get_viewport(wl_resource* id, wl_resource* surface) override;
+    };
+
+    void bind(wl_resource* new_resource) override;
+};
+
+class Viewport : public wayland::Viewport
+{
+public:
+    Viewport(wl_resource* new_resource, WlSurface* surface);
+    ~Viewport();
+
+private:
+    void destroy() override;
+    void set_source(double x, double y, double width, double height) override;
+    void set_destination(int32_t width, int32_t height) override;
+
+    /// Posts no_surface and returns false if the surface has been destroyed
+    auto surface_exists() -> bool;
+
+    WlSurface* const surface;
+    std::shared_ptr<bool> const surface_destroyed;
+    WlSurfaceState::Viewport viewport;
+};
+}
+}
+
+auto mf::create_viewporter(struct wl_display* display) -> std::shared_ptr<Viewporter>
+{
+    return std::make_shared<Viewporter>(display);
+}
+
+mf::Viewporter::Viewporter(struct wl_display* display)
+    : Global(display, Version<1>())
+{
+}
+
+void mf::Viewporter::bind(wl_resource* new_resource)
+{
+    new Instance{new_resource};
+}
+
+mf::Viewporter::Instance::Instance(wl_resource* new_resource)
+    : Viewporter{new_resource, Version<1>()}
+{
+}
+
+void mf::Viewporter::Instance::destroy()
+{
+    destroy_wayland_object();
+}
+
+void mf::Viewporter::Instance::get_viewport(wl_resource* id, wl_resource* surface)
+{
+    auto const wl_surface = WlSurface::from(surface);
+
+    if (!wl_surface->claim_viewport())
+    {
+        wl_resource_post_error(resource, Error::viewport_exists, "wl_surface already has a wp_viewport");
+        return;
+    }
+
+    new Viewport{id, wl_surface};
+}
+
+mf::Viewport::Viewport(wl_resource* new_resource, WlSurface* surface)
+    : mw::Viewport{new_resource, Version<1>()},
+      surface{surface},
+      surface_destroyed{surface->destroyed_flag()}
+{
+}
+
+mf::Viewport::~Viewport()
+{
+    if (!*surface_destroyed)
+    {
+        surface->release_viewport();
+    }
+}
+
+void mf::Viewport::destroy()
+{
+    destroy_wayland_object();
+}
+
+void mf::Viewport::set_source(double x, double y, double width, double height)
+{
+    if (!surface_exists())
+        return;
+
+    if (x == -1 && y == -1 && width == -1 && height == -1)
+    {
+        viewport.source = std::experimental::nullopt;
+    }
+    else if (x < 0 || y < 0 || width <= 0 || height <= 0)
+    {
+        wl_resource_post_error(
+            resource, Error::bad_value, "Invalid wp_viewport source (%f, %f, %f, %f)", x, y, width, height);
+        return;
+    }
+    else
+    {
+        // Buffers are sampled in whole pixels, so fractional sources are rounded to the nearest pixel
+        geom::Point const top_left{std::lround(x), std::lround(y)};
+        geom::Point const bottom_right{std::lround(x + width), std::lround(y + height)};
+        viewport.source = geom::Rectangle{
+            top_left,
+            geom::Size{
+                std::max(bottom_right.x.as_int() - top_left.x.as_int(), 1),
+                std::max(bottom_right.y.as_int() - top_left.y.as_int(), 1)}};
+    }
+
+    surface->set_pending_viewport(viewport);
+}
+
+void mf::Viewport::set_destination(int32_t width, int32_t height)
+{
+    if (!surface_exists())
+        return;
+
+    if (width == -1 && height == -1)
+    {
+        viewport.destination = std::experimental::nullopt;
+    }
+    else if (width <= 0 || height <= 0)
+    {
+        wl_resource_post_error(
+            resource, Error::bad_value, "Invalid wp_viewport destination %dx%d", width, height);
+        return;
+    }
+    else
+    {
+        viewport.destination = geom::Size{width, height};
+    }
+
+    surface->set_pending_viewport(viewport);
+}
+
+auto mf::Viewport::surface_exists() -> bool
+{
+    if (*surface_destroyed)
+    {
+        wl_resource_post_error(resource, Error::no_surface, "wl_surface of wp_viewport was destroyed");
+        return false;
+    }
+
+    return true;
+}
@@ -44,6 +44,7 @@
 #include "mir/scene/surface_creation_parameters.h"
 #include "mir/shell/shell.h"
 #include "mir/scene/surface.h"
+#include "mir/heap_accounting.h"
 #include <mir/thread_name.h>
 
 #include "mir/graphics/buffer_properties.h"
@@ -721,6 +722,12 @@ mf::WaylandConnector::WaylandConnector(
     extensions->init(display.get(), shell, seat_global.get(), output_manager.get());
 
     wl_display_init_shm(display.get());
+    if (!std::dynamic_pointer_cast<ThrowingAllocator>(this->allocator))
+    {
+        // The platforms' shm buffers convert this to RGB as it is composited. (Planar formats
+        // aren't advertised as libwayland doesn't check their chroma planes fit in the pool.)
+        wl_display_add_shm_format(display.get(), WL_SHM_FORMAT_YUYV);
+    }
 
     char const* wayland_display = nullptr;
 
@@ -772,6 +779,8 @@ void mf::WaylandConnector::start()
         [](wl_display* d)
         {
             mir::set_thread_name("Mir/Wayland");
+            // Work for other subsystems on this thread (e.g. window management) is tagged by them
+            mir::heap_accounting::Scope const heap_scope{mir::heap_accounting::Subsystem::wayland};
             wl_display_run(d);
         },
         display.get()};
@@ -24,10 +24,21 @@
 #include "xdg_shell_stable.h"
 #include "xdg_output_v1.h"
 #include "layer_shell_v1.h"
+#include "relative_pointer_unstable_v1.h"
+#include "pointer_constraints_unstable_v1.h"
+#include "pointer_gestures_unstable_v1.h"
+#include "viewporter.h"
+#include "single_pixel_buffer_v1.h"
+#include "idle_inhibit_v1.h"
 #include "xwayland_wm_shell.h"
 #include "mir_display.h"
 #include "wl_seat.h"
 #include "xdg-output-unstable-v1_wrapper.h"
+#include "pointer-constraints-unstable-v1_wrapper.h"
+#include "pointer-gestures-unstable-v1_wrapper.h"
+#include "viewporter_wrapper.h"
+#include "single-pixel-buffer-v1_wrapper.h"
+#include "idle-inhibit-unstable-v1_wrapper.h"
 
 #include "mir/graphics/platform.h"
 #include "mir/options/default_configuration.h"
@@ -44,7 +55,9 @@ auto mf::get_standard_extensions() -> std::vector<std::string>
     return std::vector<std::string>{
         mw::Shell::interface_name,
         mw::XdgWmBase::interface_name,
-        mw::XdgShellV6::interface_name};
+        mw::XdgShellV6::interface_name,
+        mw::Viewporter::interface_name,
+        mw::SinglePixelBufferManagerV1::interface_name};
 }
 
 auto mf::get_supported_extensions() -> std::vector<std::string>
@@ -58,7 +71,13 @@ auto mf::get_supported_extensions() -> std::vector<std::string>
         mw::XdgWmBase::interface_name,
         mw::XdgShellV6::interface_name,
         mw::LayerShellV1::interface_name,
-        mw::XdgOutputManagerV1::interface_name};
+        mw::XdgOutputManagerV1::interface_name,
+        mw::RelativePointerManagerV1::interface_name,
+        mw::PointerConstraintsV1::interface_name,
+        mw::PointerGesturesV1::interface_name,
+        mw::Viewporter::interface_name,
+        mw::SinglePixelBufferManagerV1::interface_name,
+        mw::IdleInhibitManagerV1::interface_name};
 }
 
 namespace
@@ -67,6 +86,7 @@ namespace
 auto configure_wayland_extensions(
     std::set<std::string> const& extensions,
     bool x11_enabled,
+    std::shared_ptr<ms::IdleHub> const& idle_hub,
     std::vector<mir::WaylandExtensionHook> const& wayland_extension_hooks)
     -> std::unique_ptr<mf::WaylandExtensions>
 {
@@ -75,8 +95,12 @@ auto configure_wayland_extensions(
         WaylandExtensions(
             std::set<std::string> const& extension,
             bool x11_enabled,
+            std::shared_ptr<ms::IdleHub> const& idle_hub,
             std::vector<mir::WaylandExtensionHook> const& wayland_extension_hooks) :
-            extension{extension}, x11_enabled{x11_enabled}, wayland_extension_hooks{wayland_extension_hooks} {}
+            extension{extension},
+            x11_enabled{x11_enabled},
+            idle_hub{idle_hub},
+            wayland_extension_hooks{wayland_extension_hooks} {}
 
     protected:
         void custom_extensions(
@@ -110,6 +134,36 @@ auto configure_wayland_extensions(
                     mw::XdgOutputManagerV1::interface_name,
                     create_xdg_output_manager_v1(display, output_manager));
 
+            if (extension.find(mw::RelativePointerManagerV1::interface_name) != extension.end())
+                add_extension(
+                    mw::RelativePointerManagerV1::interface_name,
+                    mf::create_relative_pointer_manager_v1(display));
+
+            if (extension.find(mw::PointerConstraintsV1::interface_name) != extension.end())
+                add_extension(
+                    mw::PointerConstraintsV1::interface_name,
+                    mf::create_pointer_constraints_unstable_v1(display, shell));
+
+            if (extension.find(mw::PointerGesturesV1::interface_name) != extension.end())
+                add_extension(
+                    mw::PointerGesturesV1::interface_name,
+                    mf::create_pointer_gestures_v1(display));
+
+            if (extension.find(mw::Viewporter::interface_name) != extension.end())
+                add_extension(
+                    mw::Viewporter::interface_name,
+                    mf::create_viewporter(display));
+
+            if (extension.find(mw::SinglePixelBufferManagerV1::interface_name) != extension.end())
+                add_extension(
+                    mw::SinglePixelBufferManagerV1::interface_name,
+                    mf::create_single_pixel_buffer_manager_v1(display));
+
+            if (extension.find(mw::IdleInhibitManagerV1::interface_name) != extension.end())
+                add_extension(
+                    mw::IdleInhibitManagerV1::interface_name,
+                    mf::create_idle_inhibit_manager_v1(display, idle_hub));
+
             if (x11_enabled)
                 add_extension("x11-support", std::make_shared<mf::XWaylandWMShell>(shell, *seat, output_manager));
         }
@@ -127,10 +181,11 @@ auto configure_wayland_extensions(
 
         std::set<std::string> const extension;
         const bool x11_enabled;
+        std::shared_ptr<ms::IdleHub> const idle_hub;
         std::vector<mir::WaylandExtensionHook> const wayland_extension_hooks;
     };
 
-    return std::make_unique<WaylandExtensions>(extensions, x11_enabled, wayland_extension_hooks);
+    return std::make_unique<WaylandExtensions>(extensions, x11_enabled, idle_hub, wayland_extension_hooks);
 }
 }
 
@@ -159,7 +214,11 @@ std::shared_ptr<mf::Connector>
                 the_buffer_allocator(),
                 the_session_authorizer(),
                 arw_socket,
-                configure_wayland_extensions(wayland_extensions, options->is_set(mo::x11_display_opt), wayland_extension_hooks),
+                configure_wayland_extensions(
+                    wayland_extensions,
+                    options->is_set(mo::x11_display_opt),
+                    the_idle_hub(),
+                    wayland_extension_hooks),
                 wayland_extension_filter);
         });
 }
@@ -28,6 +28,9 @@
 #include <mir/log.h>
 
 #include <linux/input-event-codes.h>
+#include <linux/sockios.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
 #include <boost/throw_exception.hpp>
 
 namespace mf = mir::frontend;
@@ -35,6 +38,46 @@ namespace ms = mir::scene;
 namespace geom = mir::geometry;
 namespace mi = mir::input;
 
+namespace
+{
+/// How long a backed up client is given to read before input delivery is tried again
+int const retry_delay_ms{8};
+
+/// A timer on the Wayland event loop that fires once, then removes and frees itself
+class OneShotTimer
+{
+public:
+    static void start(wl_event_loop* loop, int delay_ms, std::function<void()>&& work)
+    {
+        auto const timer = new OneShotTimer{std::move(work)};
+        timer->source = wl_event_loop_add_timer(loop, &OneShotTimer::fire, timer);
+        if (!timer->source)
+        {
+            delete timer;
+            BOOST_THROW_EXCEPTION(std::runtime_error("Failed to create input retry timer"));
+        }
+        wl_event_source_timer_update(timer->source, delay_ms);
+    }
+
+private:
+    OneShotTimer(std::function<void()>&& work)
+        : work{std::move(work)}
+    {
+    }
+
+    static int fire(void* data)
+    {
+        std::unique_ptr<OneShotTimer> const timer{static_cast<OneShotTimer*>(data)};
+        wl_event_source_remove(timer->source);
+        timer->work();
+        return 0;
+    }
+
+    std::function<void()> const work;
+    wl_event_source* source{nullptr};
+};
+}
+
 mf::WaylandInputDispatcher::WaylandInputDispatcher(
     WlSeat* seat,
     WlSurface* wl_surface)
@@ -87,6 +130,41 @@ void mf::WaylandInputDispatcher::handle_event(MirEvent const* event)
     handle_input_event(input_ev);
 }
 
+auto mf::WaylandInputDispatcher::client_is_backed_up() const -> bool
+{
+    // Unsent data in the socket means the client isn't keeping up. Once the kernel's buffer is half full
+    // anything more will just pile up in libwayland's buffer instead.
+    int const fd = wl_client_get_fd(client);
+
+    int unsent{0};
+    if (ioctl(fd, SIOCOUTQ, &unsent) < 0)
+        return false;
+
+    int buffer_size{0};
+    socklen_t option_size{sizeof(buffer_size)};
+    if (getsockopt(fd, SOL_SOCKET, SO_SNDBUF, &buffer_size, &option_size) < 0)
+        return false;
+
+    return unsent > buffer_size / 2;
+}
+
+void mf::WaylandInputDispatcher::retry_later(std::function<void()>&& work)
+{
+    if (*wl_surface_destroyed)
+        return;
+
+    OneShotTimer::start(
+        wl_display_get_event_loop(wl_client_get_display(client)),
+        retry_delay_ms,
+        [pending_retries = pending_retries, work = std::move(work)]()
+        {
+            // Still pending while the work runs, so it can tell it is a retry
+            work();
+            --*pending_retries;
+        });
+    ++*pending_retries;
+}
+
 void mf::WaylandInputDispatcher::handle_input_event(MirInputEvent const* event)
 {
     auto const ns = std::chrono::nanoseconds{mir_input_event_get_event_time(event)};
@@ -107,6 +185,15 @@ void mf::WaylandInputDispatcher::handle_input_event(MirInputEvent const* event)
     case mir_input_event_type_touch:
         handle_touch_event(ms, mir_input_event_get_touch_event(event));
         break;
+    case mir_input_event_type_touchpad_gesture:
+    {
+        auto const gesture_event = mir_input_event_get_touchpad_gesture_event(event);
+        seat->for_each_listener(client, [&ms, wl_surface = wl_surface, gesture_event](WlPointer* pointer)
+            {
+                pointer->touchpad_gesture(ms, wl_surface, gesture_event);
+            });
+        break;
+    }
     default:
         break;
     }
@@ -215,21 +302,32 @@ void mf::WaylandInputDispatcher::handle_pointer_motion_event(
     geom::Displacement const axis_motion{
         mir_pointer_event_axis_value(event, mir_pointer_axis_hscroll) * 10,
         mir_pointer_event_axis_value(event, mir_pointer_axis_vscroll) * 10};
+    auto const relative_x = mir_pointer_event_axis_value(event, mir_pointer_axis_relative_x);
+    auto const relative_y = mir_pointer_event_axis_value(event, mir_pointer_axis_relative_y);
+    auto const unaccelerated_x = mir_pointer_event_axis_value(event, mir_pointer_axis_relative_unaccelerated_x);
+    auto const unaccelerated_y = mir_pointer_event_axis_value(event, mir_pointer_axis_relative_unaccelerated_y);
     bool const send_motion = (!last_pointer_position || position != last_pointer_position.value());
     bool const send_axis = (axis_motion != geom::Displacement{});
+    // Relative motion is still reported when the position doesn't change (e.g. the pointer is locked)
+    bool const send_relative = (relative_x != 0 || relative_y != 0);
 
     last_pointer_position = position;
 
-    if (send_motion || send_axis)
+    if (send_motion || send_axis || send_relative)
     {
+        auto const ns = std::chrono::nanoseconds{
+            mir_input_event_get_event_time(mir_pointer_event_input_event(event))};
+
         seat->for_each_listener(
             client,
-            [&ms, wl_surface = wl_surface, &send_motion, &position, &send_axis, &axis_motion](WlPointer* pointer)
+            [&](WlPointer* pointer)
             {
                 if (send_motion)
                     pointer->motion(ms, wl_surface, position);
                 if (send_axis)
                     pointer->axis(ms, axis_motion);
+                if (send_relative)
+                    pointer->relative_motion(ns, relative_x, relative_y, unaccelerated_x, unaccelerated_y);
                 pointer->frame();
             });
     }
@@ -25,6 +25,7 @@
 
 #include <memory>
 #include <chrono>
+#include <functional>
 #include <experimental/optional>
 
 struct wl_client;
@@ -56,6 +57,16 @@ public:
 
     auto latest_timestamp() const -> std::chrono::nanoseconds { return timestamp; }
 
+    /// If the client has stopped reading, so that sending more events would only grow the buffers
+    auto client_is_backed_up() const -> bool;
+
+    /// Runs work on the Wayland thread after giving a backed up client time to read
+    /// Does nothing if the surface has been destroyed
+    void retry_later(std::function<void()>&& work);
+
+    /// If work passed to retry_later() is waiting or running
+    auto retry_pending() const -> bool { return *pending_retries > 0; }
+
 private:
     WaylandInputDispatcher(WaylandInputDispatcher const&) = delete;
     WaylandInputDispatcher& operator=(WaylandInputDispatcher const&) = delete;
@@ -64,6 +75,8 @@ private:
     wl_client* const client;
     WlSurface* const wl_surface;
     std::shared_ptr<bool> const wl_surface_destroyed;
+    /// Shared with the retry timers, which may outlive this
+    std::shared_ptr<int> const pending_retries{std::make_shared<int>(0)};
 
     std::chrono::nanoseconds timestamp{0};
     MirPointerButtons last_pointer_buttons{0};
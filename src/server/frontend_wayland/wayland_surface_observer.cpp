@@ -22,8 +22,7 @@
 #include "wayland_utils.h"
 #include "window_wl_surface_role.h"
 #include "wayland_input_dispatcher.h"
-
-#include <mir/events/event_builders.h>
+#include "input_event_queue.h"
 
 #include <mir/input/keymap.h>
 #include <mir/log.h>
@@ -31,9 +30,16 @@
 namespace mf = mir::frontend;
 namespace ms = mir::scene;
 namespace geom = mir::geometry;
-namespace mev = mir::events;
 namespace mi = mir::input;
 
+namespace
+{
+/// Events a surface may have waiting before motion is coalesced across key and button events
+size_t const input_queue_capacity{32};
+/// Events a surface may have waiting at all, for a client that has stopped reading
+size_t const input_queue_limit{256};
+}
+
 mf::WaylandSurfaceObserver::WaylandSurfaceObserver(
     WlSeat* seat,
     WlSurface* surface,
@@ -41,6 +47,7 @@ mf::WaylandSurfaceObserver::WaylandSurfaceObserver(
     : seat{seat},
       window{window},
       input_dispatcher{std::make_unique<WaylandInputDispatcher>(seat, surface)},
+      input_queue{std::make_unique<InputEventQueue>(input_queue_capacity, input_queue_limit)},
       window_size{geometry::Size{0,0}},
       destroyed{std::make_shared<bool>(false)}
 {
@@ -78,15 +85,7 @@ void mf::WaylandSurfaceObserver::attrib_changed(ms::Surface const*, MirWindowAtt
 
 void mf::WaylandSurfaceObserver::content_resized_to(ms::Surface const*, geom::Size const& content_size)
 {
-    run_on_wayland_thread_unless_destroyed(
-        [this, content_size]()
-        {
-            if (content_size != window_size)
-            {
-                requested_size = content_size;
-                window->handle_resize(std::experimental::nullopt, content_size);
-            }
-        });
+    geometry_changed(std::experimental::nullopt, content_size);
 }
 
 void mf::WaylandSurfaceObserver::client_surface_close_requested(ms::Surface const*)
@@ -118,23 +117,15 @@ void mf::WaylandSurfaceObserver::keymap_changed(
 
 void mf::WaylandSurfaceObserver::placed_relative(ms::Surface const*, geometry::Rectangle const& placement)
 {
-    run_on_wayland_thread_unless_destroyed(
-        [this, placement = placement]()
-        {
-            requested_size = placement.size;
-            window->handle_resize(placement.top_left, placement.size);
-        });
+    geometry_changed(placement, std::experimental::nullopt);
 }
 
 void mf::WaylandSurfaceObserver::input_consumed(ms::Surface const*, MirEvent const* event)
 {
-    std::shared_ptr<MirEvent> owned_event = mev::clone_event(*event);
-
-    run_on_wayland_thread_unless_destroyed(
-        [this, owned_event]()
-        {
-            input_dispatcher->handle_event(owned_event.get());
-        });
+    if (input_queue->push(*event))
+    {
+        run_on_wayland_thread_unless_destroyed([this]() { deliver_queued_input(); });
+    }
 }
 
 auto mf::WaylandSurfaceObserver::latest_timestamp() const -> std::chrono::nanoseconds
@@ -142,6 +133,77 @@ auto mf::WaylandSurfaceObserver::latest_timestamp() const -> std::chrono::nanose
     return input_dispatcher->latest_timestamp();
 }
 
+void mf::WaylandSurfaceObserver::geometry_changed(
+    std::experimental::optional<geometry::Rectangle> const& placement,
+    std::experimental::optional<geometry::Size> const& size)
+{
+    {
+        std::lock_guard<std::mutex> lock{pending_geometry_mutex};
+
+        // A placement supersedes everything before it, but a later size-only change is still sent after it
+        if (placement)
+        {
+            pending_placement = placement;
+            pending_size = std::experimental::nullopt;
+        }
+        if (size)
+        {
+            pending_size = size;
+        }
+
+        if (geometry_update_scheduled)
+            return;
+
+        geometry_update_scheduled = true;
+    }
+
+    run_on_wayland_thread_unless_destroyed([this]() { send_pending_geometry(); });
+}
+
+void mf::WaylandSurfaceObserver::send_pending_geometry()
+{
+    std::experimental::optional<geometry::Rectangle> placement;
+    std::experimental::optional<geometry::Size> size;
+
+    {
+        std::lock_guard<std::mutex> lock{pending_geometry_mutex};
+        std::swap(placement, pending_placement);
+        std::swap(size, pending_size);
+        geometry_update_scheduled = false;
+    }
+
+    if (placement)
+    {
+        requested_size = placement.value().size;
+        window->handle_resize(placement.value().top_left, placement.value().size);
+    }
+
+    if (size && size.value() != window_size && (!placement || size.value() != placement.value().size))
+    {
+        requested_size = size;
+        window->handle_resize(std::experimental::nullopt, size.value());
+    }
+}
+
+void mf::WaylandSurfaceObserver::deliver_queued_input()
+{
+    if (input_dispatcher->client_is_backed_up())
+    {
+        // Leave the events queued (where motion keeps coalescing) and try again once the client has had a chance
+        // to read. The delivery stays scheduled meanwhile, so new events don't schedule another.
+        // Only the first hold is logged: later ones are retries
+        if (!input_dispatcher->retry_pending())
+            log_info("Client is not reading input events, holding them back");
+        input_dispatcher->retry_later(run_unless(destroyed, [this]() { deliver_queued_input(); }));
+        return;
+    }
+
+    for (auto const& event : input_queue->take())
+    {
+        input_dispatcher->handle_event(event.get());
+    }
+}
+
 void mf::WaylandSurfaceObserver::run_on_wayland_thread_unless_destroyed(std::function<void()>&& work)
 {
     seat->spawn(run_unless(destroyed, work));
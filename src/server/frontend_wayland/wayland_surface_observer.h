@@ -22,7 +22,10 @@
 
 #include "mir/scene/null_surface_observer.h"
 
+#include "mir/geometry/rectangle.h"
+
 #include <memory>
+#include <mutex>
 #include <experimental/optional>
 #include <chrono>
 #include <functional>
@@ -37,6 +40,7 @@ class WlSurface;
 class WlSeat;
 class WindowWlSurfaceRole;
 class WaylandInputDispatcher;
+class InputEventQueue;
 
 class WaylandSurfaceObserver
     : public scene::NullSurfaceObserver
@@ -84,12 +88,30 @@ private:
     WlSeat* const seat; // only used by run_on_wayland_thread_unless_destroyed()
     WindowWlSurfaceRole* const window;
     std::unique_ptr<WaylandInputDispatcher> const input_dispatcher;
+    /// Input waiting to be delivered, so a client that stops reading can't build up an unbounded backlog
+    std::unique_ptr<InputEventQueue> const input_queue;
 
     geometry::Size window_size;
     std::experimental::optional<geometry::Size> requested_size;
     MirWindowState current_state{mir_window_state_unknown};
     std::shared_ptr<bool> const destroyed;
 
+    /// Geometry changes can arrive far faster than clients can respond (e.g. during a drag), so they
+    /// are accumulated here and only the latest is delivered when the Wayland thread gets to them.
+    ///@{
+    std::mutex pending_geometry_mutex;
+    std::experimental::optional<geometry::Rectangle> pending_placement;
+    /// A size-only change since pending_placement (or since the last update, if there is no placement)
+    std::experimental::optional<geometry::Size> pending_size;
+    bool geometry_update_scheduled{false};
+    ///@}
+
+    void geometry_changed(
+        std::experimental::optional<geometry::Rectangle> const& placement,
+        std::experimental::optional<geometry::Size> const& size);
+    void send_pending_geometry();
+    void deliver_queued_input();
+
     void run_on_wayland_thread_unless_destroyed(std::function<void()>&& work);
 };
 }
@@ -20,6 +20,8 @@
 
 #include "wayland_utils.h"
 #include "wl_surface.h"
+#include "relative_pointer_unstable_v1.h"
+#include "pointer_gestures_unstable_v1.h"
 
 #include "mir/executor.h"
 #include "mir/frontend/wayland.h"
@@ -30,9 +32,11 @@
 #include "mir/graphics/buffer.h"
 #include "mir/renderer/sw/pixel_source.h"
 #include "mir/compositor/buffer_stream.h"
+#include "mir_toolkit/events/input/input_event.h"
 
 #include <linux/input-event-codes.h>
 #include <boost/throw_exception.hpp>
+#include <algorithm>
 #include <string.h> // memcpy
 
 namespace mf = mir::frontend;
@@ -137,7 +141,7 @@ void mf::WlPointer::enter(WlSurface* parent_surface, geom::Point const& position
     auto const serial = wl_display_next_serial(display);
     auto const final = parent_surface->transform_point(position_on_parent);
 
-    cursor->apply_to(final.surface);
+    apply_cursor_to(final.surface);
     send_enter_event(
         serial,
         final.surface->raw_resource(),
@@ -151,6 +155,8 @@ void mf::WlPointer::enter(WlSurface* parent_surface, geom::Point const& position
             leave();
         });
     surface_under_cursor = final.surface;
+    position_on_surface = final.position;
+    notify_focus_listeners();
 }
 
 void mf::WlPointer::leave()
@@ -164,6 +170,7 @@ void mf::WlPointer::leave()
         surface_under_cursor.value()->raw_resource());
     can_send_frame = true;
     surface_under_cursor = std::experimental::nullopt;
+    notify_focus_listeners();
 }
 
 void mf::WlPointer::button(std::chrono::milliseconds const& ms, uint32_t button, bool pressed)
@@ -189,6 +196,8 @@ void mf::WlPointer::motion(
             final.position.x.as_int(),
             final.position.y.as_int());
         can_send_frame = true;
+        position_on_surface = final.position;
+        notify_focus_listeners();
     }
     else
     {
@@ -218,6 +227,88 @@ void mf::WlPointer::axis(std::chrono::milliseconds const& ms, geometry::Displace
     }
 }
 
+void mf::WlPointer::relative_motion(
+    std::chrono::nanoseconds const& ns,
+    float dx,
+    float dy,
+    float dx_unaccelerated,
+    float dy_unaccelerated)
+{
+    if (!surface_under_cursor)
+        return;
+
+    for (auto const relative_pointer : relative_pointers)
+    {
+        relative_pointer->send_relative_motion(ns, dx, dy, dx_unaccelerated, dy_unaccelerated);
+        can_send_frame = true;
+    }
+}
+
+void mf::WlPointer::touchpad_gesture(
+    std::chrono::milliseconds const& ms,
+    WlSurface* parent_surface,
+    MirTouchpadGestureEvent const* event)
+{
+    auto const surface = surface_under_cursor ? surface_under_cursor.value() : parent_surface;
+    auto const fingers = mir_touchpad_gesture_event_finger_count(event);
+    auto const dx = mir_touchpad_gesture_event_dx(event);
+    auto const dy = mir_touchpad_gesture_event_dy(event);
+
+    switch (mir_touchpad_gesture_event_action(event))
+    {
+    case mir_touchpad_gesture_action_begin:
+    {
+        auto const serial = wl_display_next_serial(display);
+        if (mir_touchpad_gesture_event_gesture(event) == mir_touchpad_gesture_swipe)
+        {
+            for (auto const gesture : swipe_gestures)
+                gesture->begin(serial, ms, surface, fingers);
+        }
+        else
+        {
+            for (auto const gesture : pinch_gestures)
+                gesture->begin(serial, ms, surface, fingers);
+        }
+        break;
+    }
+
+    case mir_touchpad_gesture_action_update:
+        if (mir_touchpad_gesture_event_gesture(event) == mir_touchpad_gesture_swipe)
+        {
+            for (auto const gesture : swipe_gestures)
+                gesture->update(ms, dx, dy);
+        }
+        else
+        {
+            auto const scale = mir_touchpad_gesture_event_scale(event);
+            auto const rotation = mir_touchpad_gesture_event_rotation(event);
+            for (auto const gesture : pinch_gestures)
+                gesture->update(ms, dx, dy, scale, rotation);
+        }
+        break;
+
+    case mir_touchpad_gesture_action_end:
+    {
+        auto const serial = wl_display_next_serial(display);
+        auto const cancelled = mir_touchpad_gesture_event_cancelled(event);
+        if (mir_touchpad_gesture_event_gesture(event) == mir_touchpad_gesture_swipe)
+        {
+            for (auto const gesture : swipe_gestures)
+                gesture->end(serial, ms, cancelled);
+        }
+        else
+        {
+            for (auto const gesture : pinch_gestures)
+                gesture->end(serial, ms, cancelled);
+        }
+        break;
+    }
+
+    case mir_touchpad_gesture_actions:
+        break;
+    }
+}
+
 void mf::WlPointer::frame()
 {
     if (can_send_frame && version_supports_frame())
@@ -225,6 +316,69 @@ void mf::WlPointer::frame()
     can_send_frame = false;
 }
 
+auto mf::WlPointer::from(wl_resource* pointer) -> WlPointer*
+{
+    return dynamic_cast<WlPointer*>(wayland::Pointer::from(pointer));
+}
+
+void mf::WlPointer::add_focus_listener(
+    void const* key,
+    std::function<void(std::experimental::optional<WlSurface*>)> listener)
+{
+    focus_listeners[key] = std::move(listener);
+}
+
+void mf::WlPointer::remove_focus_listener(void const* key)
+{
+    focus_listeners.erase(key);
+}
+
+void mf::WlPointer::notify_focus_listeners()
+{
+    // Listeners may remove themselves
+    auto const listeners = focus_listeners;
+    for (auto const& listener : listeners)
+    {
+        listener.second(surface_under_cursor);
+    }
+}
+
+void mf::WlPointer::add_relative_pointer(RelativePointerV1* relative_pointer)
+{
+    relative_pointers.push_back(relative_pointer);
+}
+
+void mf::WlPointer::remove_relative_pointer(RelativePointerV1* relative_pointer)
+{
+    relative_pointers.erase(
+        std::remove(begin(relative_pointers), end(relative_pointers), relative_pointer),
+        end(relative_pointers));
+}
+
+void mf::WlPointer::add_swipe_gesture(PointerGestureSwipeV1* gesture)
+{
+    swipe_gestures.push_back(gesture);
+}
+
+void mf::WlPointer::remove_swipe_gesture(PointerGestureSwipeV1* gesture)
+{
+    swipe_gestures.erase(
+        std::remove(begin(swipe_gestures), end(swipe_gestures), gesture),
+        end(swipe_gestures));
+}
+
+void mf::WlPointer::add_pinch_gesture(PointerGesturePinchV1* gesture)
+{
+    pinch_gestures.push_back(gesture);
+}
+
+void mf::WlPointer::remove_pinch_gesture(PointerGesturePinchV1* gesture)
+{
+    pinch_gestures.erase(
+        std::remove(begin(pinch_gestures), end(pinch_gestures), gesture),
+        end(pinch_gestures));
+}
+
 namespace
 {
 struct WlSurfaceCursor : mf::WlPointer::Cursor
@@ -277,19 +431,39 @@ void mf::WlPointer::set_cursor(
             cursor.reset(); // clean up old cursor before creating new one
             cursor = std::make_unique<WlSurfaceCursor>(wl_surface, cursor_hotspot);
             if (surface_under_cursor)
-                cursor->apply_to(surface_under_cursor.value());
+                apply_cursor_to(surface_under_cursor.value());
         }
     }
     else
     {
         cursor = std::make_unique<WlHiddenCursor>();
         if (surface_under_cursor)
-            cursor->apply_to(surface_under_cursor.value());
+            apply_cursor_to(surface_under_cursor.value());
     }
 
     (void)serial;
 }
 
+void mf::WlPointer::set_locked(bool locked)
+{
+    this->locked = locked;
+
+    if (surface_under_cursor)
+        apply_cursor_to(surface_under_cursor.value());
+}
+
+void mf::WlPointer::apply_cursor_to(WlSurface* surface)
+{
+    if (locked)
+    {
+        WlHiddenCursor{}.apply_to(surface);
+    }
+    else
+    {
+        cursor->apply_to(surface);
+    }
+}
+
 void mf::WlPointer::release()
 {
     destroy_wayland_object();
@@ -27,11 +27,14 @@
 
 #include <functional>
 #include <chrono>
+#include <map>
+#include <vector>
 
 struct MirInputEvent;
 typedef unsigned int MirPointerButtons;
 
 struct MirPointerEvent;
+struct MirTouchpadGestureEvent;
 
 namespace mir
 {
@@ -41,6 +44,9 @@ class Executor;
 namespace frontend
 {
 class WlSurface;
+class RelativePointerV1;
+class PointerGestureSwipeV1;
+class PointerGesturePinchV1;
 
 class WlPointer : public wayland::Pointer
 {
@@ -64,8 +70,42 @@ public:
         WlSurface* parent_surface,
         geometry::Point const& position_on_parent);
     void axis(std::chrono::milliseconds const& ms, geometry::Displacement const& scroll);
+    void relative_motion(
+        std::chrono::nanoseconds const& ns,
+        float dx,
+        float dy,
+        float dx_unaccelerated,
+        float dy_unaccelerated);
+    /// Sent to the focused surface if there is one, otherwise to parent_surface
+    void touchpad_gesture(
+        std::chrono::milliseconds const& ms,
+        WlSurface* parent_surface,
+        MirTouchpadGestureEvent const* event);
     void frame();
 
+    static auto from(wl_resource* pointer) -> WlPointer*;
+
+    auto focused_surface() const -> std::experimental::optional<WlSurface*> { return surface_under_cursor; }
+    /// The position of the pointer on focused_surface(), only meaningful while there is one
+    auto position_on_focused_surface() const -> geometry::Point { return position_on_surface; }
+
+    /// The listener is called with the surface under the pointer when it enters or moves, or nullopt when it leaves
+    void add_focus_listener(void const* key, std::function<void(std::experimental::optional<WlSurface*>)> listener);
+    void remove_focus_listener(void const* key);
+
+    /// zwp_relative_pointer_v1 objects share the focus of their pointer
+    void add_relative_pointer(RelativePointerV1* relative_pointer);
+    void remove_relative_pointer(RelativePointerV1* relative_pointer);
+
+    /// zwp_pointer_gesture_*_v1 objects likewise
+    void add_swipe_gesture(PointerGestureSwipeV1* gesture);
+    void remove_swipe_gesture(PointerGestureSwipeV1* gesture);
+    void add_pinch_gesture(PointerGesturePinchV1* gesture);
+    void remove_pinch_gesture(PointerGesturePinchV1* gesture);
+
+    /// While locked the cursor is hidden, as the client is expected to draw its own
+    void set_locked(bool locked);
+
     struct Cursor;
 
 private:
@@ -73,7 +113,16 @@ private:
     std::function<void(WlPointer*)> on_destroy;
 
     bool can_send_frame{false};
+    bool locked{false};
     std::experimental::optional<WlSurface*> surface_under_cursor;
+    geometry::Point position_on_surface;
+    std::map<void const*, std::function<void(std::experimental::optional<WlSurface*>)>> focus_listeners;
+    std::vector<RelativePointerV1*> relative_pointers;
+    std::vector<PointerGestureSwipeV1*> swipe_gestures;
+    std::vector<PointerGesturePinchV1*> pinch_gestures;
+
+    void notify_focus_listeners();
+    void apply_cursor_to(WlSurface* surface);
 
     /// Wayland request handlers
     ///@{
@@ -31,7 +31,7 @@ namespace mir
 namespace frontend
 {
 
-class WlRegion: wayland::Region
+class WlRegion: public wayland::Region
 {
 public:
     WlRegion(wl_resource* new_resource);
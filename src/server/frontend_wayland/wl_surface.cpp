@@ -23,6 +23,7 @@
 #include "wl_subcompositor.h"
 #include "wl_region.h"
 #include "wlshmbuffer.h"
+#include "single_pixel_buffer_v1.h"
 #include "deleted_for_resource.h"
 
 #include "wayland_wrapper.h"
@@ -30,6 +31,7 @@
 #include "wayland_frontend.tp.h"
 
 #include "mir/graphics/buffer_properties.h"
+#include "mir/graphics/solid_colour_buffer.h"
 #include "mir/scene/session.h"
 #include "mir/frontend/wayland.h"
 #include "mir/compositor/buffer_stream.h"
@@ -63,6 +65,9 @@ void mf::WlSurfaceState::update_from(WlSurfaceState const& source)
     if (source.input_shape)
         input_shape = source.input_shape;
 
+    if (source.viewport)
+        viewport = source.viewport;
+
     frame_callbacks.insert(end(frame_callbacks),
                            begin(source.frame_callbacks),
                            end(source.frame_callbacks));
@@ -75,6 +80,7 @@ bool mf::WlSurfaceState::surface_data_needs_refresh() const
 {
     return offset ||
            input_shape ||
+           viewport ||
            surface_data_invalidated;
 }
 
@@ -157,6 +163,26 @@ void mf::WlSurface::set_pending_offset(std::experimental::optional<geom::Displac
     pending.offset = offset;
 }
 
+auto mf::WlSurface::claim_viewport() -> bool
+{
+    if (viewport_claimed)
+        return false;
+
+    viewport_claimed = true;
+    return true;
+}
+
+void mf::WlSurface::release_viewport()
+{
+    viewport_claimed = false;
+    pending.viewport = WlSurfaceState::Viewport{};
+}
+
+void mf::WlSurface::set_pending_viewport(WlSurfaceState::Viewport const& viewport)
+{
+    pending.viewport = viewport;
+}
+
 std::unique_ptr<mf::WlSurface, std::function<void(mf::WlSurface*)>> mf::WlSurface::add_child(WlSubsurface* child)
 {
     children.push_back(child);
@@ -218,6 +244,16 @@ void mf::WlSurface::remove_destroy_listener(void const* key)
     destroy_listeners.erase(key);
 }
 
+void mf::WlSurface::add_commit_listener(void const* key, std::function<void()> listener)
+{
+    commit_listeners[key] = listener;
+}
+
+void mf::WlSurface::remove_commit_listener(void const* key)
+{
+    commit_listeners.erase(key);
+}
+
 mf::WlSurface* mf::WlSurface::from(wl_resource* resource)
 {
     void* raw_surface = wl_resource_get_user_data(resource);
@@ -276,7 +312,11 @@ void mf::WlSurface::damage_buffer(int32_t x, int32_t y, int32_t width, int32_t h
 
 void mf::WlSurface::frame(wl_resource* new_callback)
 {
-    pending.frame_callbacks.push_back(std::make_shared<WlSurfaceState::Callback>(new_callback));
+    // Clients request a callback every frame, so the shared_ptr control block comes from the slab too
+    pending.frame_callbacks.push_back(
+        std::allocate_shared<WlSurfaceState::Callback>(
+            mw::SlabAllocator::Adapter<WlSurfaceState::Callback>{mw::Callback::slab()},
+            new_callback));
 }
 
 void mf::WlSurface::set_opaque_region(std::experimental::optional<wl_resource*> const& region)
@@ -313,6 +353,23 @@ void mf::WlSurface::commit(WlSurfaceState const& state)
     if (state.input_shape)
         input_shape = state.input_shape.value();
 
+    if (state.viewport)
+    {
+        stream->set_viewport(state.viewport.value().source, state.viewport.value().destination);
+
+        // Without a new buffer the surface size still changes with the viewport: treat it like a buffer of the
+        // new size, so the role resizes the scene surface and the input shape is recalculated
+        if (buffer_size_ && !state.buffer)
+        {
+            auto const surface_size = stream->stream_size();
+            if (surface_size != buffer_size_.value())
+            {
+                state.invalidate_surface_data();
+            }
+            buffer_size_ = surface_size;
+        }
+    }
+
     if (state.buffer)
     {
         wl_resource * buffer = *state.buffer;
@@ -337,7 +394,22 @@ void mf::WlSurface::commit(WlSurfaceState const& state)
 
             std::shared_ptr<graphics::Buffer> mir_buffer;
 
-            if (wl_shm_buffer_get(buffer))
+            auto colour = single_pixel_buffer_colour(buffer);
+            if (!colour)
+                colour = WlShmBuffer::solid_colour_of(buffer);
+
+            if (colour)
+            {
+                // A single colour needs no texture: the renderer fills the surface with it
+                mir_buffer = std::make_shared<graphics::SolidColourBuffer>(
+                    geom::Size{1, 1},
+                    colour.value(),
+                    std::move(executor_send_frame_callbacks));
+
+                // We've taken a copy of the colour, so the client can have its buffer straight back
+                wl_resource_post_event(buffer, wayland::Buffer::Opcode::release);
+            }
+            else if (wl_shm_buffer_get(buffer))
             {
                 mir_buffer = allocator->buffer_from_shm(
                     buffer,
@@ -371,12 +443,14 @@ void mf::WlSurface::commit(WlSurfaceState const& state)
                     mir_buffer->id().as_value());
             }
 
-            if (!input_shape && (!buffer_size_ || mir_buffer->size() != buffer_size_.value()))
+            stream->submit_buffer(mir_buffer);
+            auto const surface_size = stream->stream_size();
+
+            if (!input_shape && (!buffer_size_ || surface_size != buffer_size_.value()))
             {
                 state.invalidate_surface_data(); // input shape needs to be recalculated for the new size
             }
-            buffer_size_ = mir_buffer->size();
-            stream->submit_buffer(mir_buffer);
+            buffer_size_ = surface_size;
         }
     }
     else
@@ -388,6 +462,13 @@ void mf::WlSurface::commit(WlSurfaceState const& state)
     {
         child->parent_has_committed();
     }
+
+    // Listeners may remove themselves
+    auto const listeners = commit_listeners;
+    for (auto const& listener : listeners)
+    {
+        listener.second();
+    }
 }
 
 void mf::WlSurface::commit()
@@ -26,6 +26,7 @@
 #include "mir/geometry/displacement.h"
 #include "mir/geometry/size.h"
 #include "mir/geometry/point.h"
+#include "mir/geometry/rectangle.h"
 
 #include <vector>
 #include <map>
@@ -46,10 +47,6 @@ namespace shell
 {
 struct StreamSpecification;
 }
-namespace geometry
-{
-class Rectangle;
-}
 namespace compositor
 {
 class BufferStream;
@@ -84,6 +81,14 @@ struct WlSurfaceState
     std::experimental::optional<std::experimental::optional<std::vector<geometry::Rectangle>>> input_shape;
     std::vector<std::shared_ptr<Callback>> frame_callbacks;
 
+    /// The crop and scale set by wp_viewport
+    struct Viewport
+    {
+        std::experimental::optional<geometry::Rectangle> source;
+        std::experimental::optional<geometry::Size> destination;
+    };
+    std::experimental::optional<Viewport> viewport;
+
 private:
     // only set to true if invalidate_surface_data() is called
     // surface_data_needs_refresh() returns true if this is true, or if other things are changed which mandate a refresh
@@ -125,6 +130,7 @@ public:
     std::shared_ptr<bool> destroyed_flag() const { return destroyed; }
     geometry::Displacement offset() const { return offset_; }
     geometry::Displacement total_offset() const { return offset_ + role->total_offset(); }
+    /// The size of the surface: the buffer size, unless a viewport crops or scales the buffer
     std::experimental::optional<geometry::Size> buffer_size() const { return buffer_size_; }
     bool synchronized() const;
     Position transform_point(geometry::Point point);
@@ -134,6 +140,10 @@ public:
     void set_role(WlSurfaceRole* role_);
     void clear_role();
     void set_pending_offset(std::experimental::optional<geometry::Displacement> const& offset);
+    /// A surface can have only one wp_viewport, claim_viewport() fails if it already has one
+    auto claim_viewport() -> bool;
+    void release_viewport();
+    void set_pending_viewport(WlSurfaceState::Viewport const& viewport);
     std::unique_ptr<WlSurface, std::function<void(WlSurface*)>> add_child(WlSubsurface* child);
     void refresh_surface_data_now();
     void pending_invalidate_surface_data() { pending.invalidate_surface_data(); }
@@ -143,6 +153,9 @@ public:
     void commit(WlSurfaceState const& state);
     void add_destroy_listener(void const* key, std::function<void()> listener);
     void remove_destroy_listener(void const* key);
+    /// Called after each commit has been applied (for a synchronized subsurface, when its parent applies it)
+    void add_commit_listener(void const* key, std::function<void()> listener);
+    void remove_commit_listener(void const* key);
 
     std::shared_ptr<scene::Session> const session;
     std::shared_ptr<compositor::BufferStream> const stream;
@@ -162,7 +175,9 @@ private:
     std::experimental::optional<geometry::Size> buffer_size_;
     std::vector<std::shared_ptr<WlSurfaceState::Callback>> frame_callbacks;
     std::experimental::optional<std::vector<mir::geometry::Rectangle>> input_shape;
+    bool viewport_claimed{false};
     std::map<void const*, std::function<void()>> destroy_listeners;
+    std::map<void const*, std::function<void()>> commit_listeners;
     std::shared_ptr<bool> const destroyed;
 
     void send_frame_callbacks();
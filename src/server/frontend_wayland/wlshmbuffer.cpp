@@ -129,12 +129,15 @@ using namespace mir::geometry;
 
 mf::WlShmBuffer::~WlShmBuffer()
 {
-    executor->spawn([wayland = wayland]()
+    executor->spawn([wayland = wayland, pool = pool]()
         {
-            std::lock_guard <std::mutex> lock{wayland->mutex};
-            if (wayland->resource) {
-                wl_resource_queue_event(wayland->resource.value(), WL_BUFFER_RELEASE);
+            {
+                std::lock_guard <std::mutex> lock{wayland->mutex};
+                if (wayland->resource) {
+                    wl_resource_queue_event(wayland->resource.value(), WL_BUFFER_RELEASE);
+                }
             }
+            wl_shm_pool_unref(pool);
         });
 }
 
@@ -183,6 +186,38 @@ std::shared_ptr<mg::Buffer> mf::WlShmBuffer::mir_buffer_from_wl_buffer(
     return mir_buffer;
 }
 
+std::experimental::optional<mg::SolidColourBuffer::Colour> mf::WlShmBuffer::solid_colour_of(wl_resource *buffer)
+{
+    auto const shm_buffer = wl_shm_buffer_get(buffer);
+    if (!shm_buffer || wl_shm_buffer_get_width(shm_buffer) != 1 || wl_shm_buffer_get_height(shm_buffer) != 1)
+    {
+        return std::experimental::nullopt;
+    }
+
+    auto const format = wl_shm_buffer_get_format(shm_buffer);
+
+    uint32_t pixel;
+    wl_shm_buffer_begin_access(shm_buffer);
+    memcpy(&pixel, wl_shm_buffer_get_data(shm_buffer), sizeof pixel);
+    wl_shm_buffer_end_access(shm_buffer);
+
+    auto const channel = [pixel](int shift) { return ((pixel >> shift) & 0xff) / 255.0f; };
+
+    switch (format)
+    {
+    case WL_SHM_FORMAT_ARGB8888:
+        return mg::SolidColourBuffer::Colour{channel(16), channel(8), channel(0), channel(24)};
+    case WL_SHM_FORMAT_XRGB8888:
+        return mg::SolidColourBuffer::Colour{channel(16), channel(8), channel(0), 1.0f};
+    case WL_SHM_FORMAT_ABGR8888:
+        return mg::SolidColourBuffer::Colour{channel(0), channel(8), channel(16), channel(24)};
+    case WL_SHM_FORMAT_XBGR8888:
+        return mg::SolidColourBuffer::Colour{channel(0), channel(8), channel(16), 1.0f};
+    default:
+        return std::experimental::nullopt;
+    }
+}
+
 std::shared_ptr <mg::NativeBuffer> mf::WlShmBuffer::native_buffer_handle() const
 {
     return nullptr;
@@ -263,7 +298,21 @@ void mf::WlShmBuffer::read(std::function<void(unsigned char const *)> const &do_
         consumed = true;
     }
 
-    do_with_pixels(static_cast<unsigned char const *>(data.get()));
+    if (wayland->buffer)
+    {
+        // The client may not touch the buffer until we release it, so the pool can be read in place
+        wl_shm_buffer_begin_access(wayland->buffer.value());
+        do_with_pixels(static_cast<unsigned char const *>(wl_shm_buffer_get_data(wayland->buffer.value())));
+        wl_shm_buffer_end_access(wayland->buffer.value());
+    }
+    else if (wayland->snapshot)
+    {
+        do_with_pixels(wayland->snapshot.get());
+    }
+    else
+    {
+        log_warning("Attempt to read from WlShmBuffer after the wl_buffer has been destroyed");
+    }
 }
 
 Stride mf::WlShmBuffer::stride() const
@@ -294,7 +343,7 @@ mf::WlShmBuffer::WlShmBuffer(
         wl_shm_buffer_get_height(wayland->buffer.value())},
     stride_{wl_shm_buffer_get_stride(wayland->buffer.value())},
     format_{wl_format_to_mir_format(wl_shm_buffer_get_format(wayland->buffer.value()))},
-    data{std::make_unique<uint8_t[]>(size_.height.as_int() * stride_.as_int())},
+    pool{wl_shm_buffer_ref_pool(wayland->buffer.value())},
     consumed{false},
     on_consumed{std::move(on_consumed)},
     executor{executor}
@@ -307,13 +356,11 @@ mf::WlShmBuffer::WlShmBuffer(
                 "Did you accidentally specify stride in pixels?",
             stride_.as_int(), size_.width.as_int(), MIR_BYTES_PER_PIXEL(format_));
 
+        wl_shm_pool_unref(pool);
+
         BOOST_THROW_EXCEPTION((
                                   std::runtime_error{"Buffer has invalid stride"}));
     }
-
-    wl_shm_buffer_begin_access(wayland->buffer.value());
-    std::memcpy(data.get(), wl_shm_buffer_get_data(wayland->buffer.value()), size_.height.as_int() * stride_.as_int());
-    wl_shm_buffer_end_access(wayland->buffer.value());
 }
 
 void mf::WlShmBuffer::on_buffer_destroyed(wl_listener *listener, void *)
@@ -329,6 +376,17 @@ void mf::WlShmBuffer::on_buffer_destroyed(wl_listener *listener, void *)
         if (auto resources = shim->resources.lock())
         {
             std::lock_guard <std::mutex> lock{resources->mutex};
+            if (resources->buffer && shim->mir_buffer.lock())
+            {
+                // Destroy listeners run before the buffer lets go of its pool, so the contents are
+                // still there to be kept for the Mir buffer that outlives the wl_buffer
+                auto const buffer = resources->buffer.value();
+                size_t const length = wl_shm_buffer_get_height(buffer) * wl_shm_buffer_get_stride(buffer);
+                resources->snapshot = std::make_unique<uint8_t[]>(length);
+                wl_shm_buffer_begin_access(buffer);
+                std::memcpy(resources->snapshot.get(), wl_shm_buffer_get_data(buffer), length);
+                wl_shm_buffer_end_access(buffer);
+            }
             resources->buffer = std::experimental::nullopt;
             resources->resource = std::experimental::nullopt;
         }
@@ -21,6 +21,7 @@
 #define MIR_FRONTEND_WLSHMBUFFER_H_
 
 #include <mir/graphics/buffer_basic.h>
+#include <mir/graphics/solid_colour_buffer.h>
 #include <mir/renderer/gl/texture_source.h>
 #include <mir/renderer/sw/pixel_source.h>
 
@@ -56,6 +57,9 @@ public:
         std::shared_ptr<Executor> executor,
         std::function<void()> &&on_consumed);
 
+    /// The colour of a 1x1 shm buffer in one of the 32bpp formats, nullopt for anything else
+    static std::experimental::optional<graphics::SolidColourBuffer::Colour> solid_colour_of(wl_resource *buffer);
+
     std::shared_ptr <graphics::NativeBuffer> native_buffer_handle() const override;
 
     geometry::Size size() const override;
@@ -89,6 +93,10 @@ private:
         std::mutex mutex;
         std::experimental::optional<wl_resource* const> resource;
         std::experimental::optional<wl_shm_buffer* const> buffer;
+
+        /// The buffer contents, copied out of the pool only if the client destroys the wl_buffer
+        /// while Mir is still using it. Until then pixels are read straight from the pool.
+        std::unique_ptr<uint8_t[]> snapshot;
     };
 
     struct DestructionShim
@@ -106,7 +114,8 @@ private:
     geometry::Stride const stride_;
     MirPixelFormat const format_;
 
-    std::unique_ptr<uint8_t[]> const data;
+    /// Held so that the client resizing the pool cannot remap it while the compositor is reading it
+    wl_shm_pool* const pool;
 
     bool consumed;
     std::function<void()> on_consumed;
@@ -18,6 +18,7 @@
 
 #include "xdg_shell_stable.h"
 
+#include "configure_throttle.h"
 #include "wl_surface.h"
 #include "wayland_utils.h"
 
@@ -58,6 +59,9 @@ public:
 
     void send_configure();
 
+    /// \returns true if a resize can be configured now, false if it is held back until the client catches up
+    auto resize_requested() -> bool;
+
     std::experimental::optional<WindowWlSurfaceRole*> const& window_role();
 
     using wayland::XdgSurface::client;
@@ -70,6 +74,8 @@ private:
     std::shared_ptr<bool> window_role_destroyed;
     WlSurface* const surface;
 
+    ConfigureThrottle configures;
+
 public:
     XdgShellStable const& xdg_shell;
 };
@@ -104,6 +110,9 @@ public:
                        geometry::Size const& new_size) override;
     void handle_close_request() override;
 
+    /// Sends the configure for a resize that was held back while the client caught up
+    void handle_resize_released();
+
 private:
     static XdgToplevelStable* from(wl_resource* surface);
     void send_toplevel_configure();
@@ -248,16 +257,28 @@ void mf::XdgSurfaceStable::set_window_geometry(int32_t x, int32_t y, int32_t wid
 
 void mf::XdgSurfaceStable::ack_configure(uint32_t serial)
 {
-    (void)serial;
-    // TODO
+    if (configures.configure_acked(serial))
+    {
+        if (auto const role = window_role())
+        {
+            if (auto const toplevel = dynamic_cast<XdgToplevelStable*>(role.value()))
+                toplevel->handle_resize_released();
+        }
+    }
 }
 
 void mf::XdgSurfaceStable::send_configure()
 {
     auto const serial = wl_display_next_serial(wl_client_get_display(wayland::XdgSurface::client));
+    configures.configure_sent(serial);
     send_configure_event(serial);
 }
 
+auto mf::XdgSurfaceStable::resize_requested() -> bool
+{
+    return configures.resize_requested();
+}
+
 std::experimental::optional<mf::WindowWlSurfaceRole*> const& mf::XdgSurfaceStable::window_role()
 {
     if (window_role_ && *window_role_destroyed)
@@ -510,6 +531,12 @@ void mf::XdgToplevelStable::handle_active_change(bool /*is_now_active*/)
 
 void mf::XdgToplevelStable::handle_resize(std::experimental::optional<geometry::Point> const& /*new_top_left*/,
                                           geometry::Size const& /*new_size*/)
+{
+    if (xdg_surface->resize_requested())
+        send_toplevel_configure();
+}
+
+void mf::XdgToplevelStable::handle_resize_released()
 {
     send_toplevel_configure();
 }
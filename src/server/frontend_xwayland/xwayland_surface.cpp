@@ -216,6 +216,7 @@ void mf::XWaylandSurface::map()
     {
         std::lock_guard<std::mutex> lock{mutex};
         state = cached.state;
+        map_requested_at = std::chrono::steady_clock::now();
     }
 
     uint32_t const workspace = 1;
@@ -772,6 +773,24 @@ void mf::XWaylandSurface::wl_surface_destroyed()
     close();
 }
 
+void mf::XWaylandSurface::wl_surface_first_frame()
+{
+    std::experimental::optional<std::chrono::steady_clock::time_point> requested_at;
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        std::swap(requested_at, map_requested_at);
+    }
+
+    if (requested_at && verbose_xwayland_logging_enabled())
+    {
+        auto const latency = std::chrono::steady_clock::now() - requested_at.value();
+        log_debug(
+            "%s showed its first frame %.1fms after its map request",
+            connection->window_debug_string(window).c_str(),
+            std::chrono::duration<double, std::milli>(latency).count());
+    }
+}
+
 auto mf::XWaylandSurface::scene_surface() const -> std::experimental::optional<std::shared_ptr<scene::Surface>>
 {
     std::lock_guard<std::mutex> lock{mutex};
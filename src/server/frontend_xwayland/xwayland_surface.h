@@ -98,6 +98,7 @@ private:
     /// Should only be called on the Wayland thread
     /// @{
     void wl_surface_destroyed() override;
+    void wl_surface_first_frame() override;
     auto scene_surface() const -> std::experimental::optional<std::shared_ptr<scene::Surface>> override;
     /// @}
 
@@ -148,6 +149,9 @@ private:
         std::set<xcb_atom_t> supported_wm_protocols;
     } cached;
 
+    /// When the client last asked for the window to be mapped, used to report how long it took to appear
+    std::experimental::optional<std::chrono::steady_clock::time_point> map_requested_at;
+
     /// Set in set_wl_surface and cleared when a scene surface is created from it
     std::experimental::optional<std::shared_ptr<XWaylandSurfaceObserver>> surface_observer;
     std::weak_ptr<scene::Session> weak_session;
@@ -23,8 +23,7 @@
 #include "wayland_utils.h"
 #include "window_wl_surface_role.h"
 #include "wayland_input_dispatcher.h"
-
-#include <mir/events/event_builders.h>
+#include "input_event_queue.h"
 
 #include <mir/input/keymap.h>
 #include <mir/log.h>
@@ -32,16 +31,22 @@
 namespace mf = mir::frontend;
 namespace ms = mir::scene;
 namespace geom = mir::geometry;
-namespace mev = mir::events;
 namespace mi = mir::input;
 
+namespace
+{
+/// Events a surface may have waiting before pointer motion is coalesced across key and button events
+size_t const input_queue_capacity{32};
+}
+
 mf::XWaylandSurfaceObserver::XWaylandSurfaceObserver(
     WlSeat& seat,
     WlSurface* wl_surface,
     XWaylandSurfaceObserverSurface* wm_surface)
     : wm_surface{wm_surface},
       input_dispatcher{std::make_shared<ThreadsafeInputDispatcher>(
-          std::make_unique<WaylandInputDispatcher>(&seat, wl_surface))}
+          std::make_unique<WaylandInputDispatcher>(&seat, wl_surface))},
+      input_queue{std::make_shared<InputEventQueue>(input_queue_capacity)}
 {
 }
 
@@ -111,12 +116,12 @@ void mf::XWaylandSurfaceObserver::keymap_changed(
 
 void mf::XWaylandSurfaceObserver::input_consumed(ms::Surface const*, MirEvent const* event)
 {
-    std::shared_ptr<MirEvent> owned_event = mev::clone_event(*event);
+    if (!input_queue->push(*event))
+        return;
 
-    aquire_input_dispatcher(
-        [owned_event](auto input_dispatcher)
+    wm_surface->run_on_wayland_thread([input_dispatcher = input_dispatcher, input_queue = input_queue]()
         {
-            input_dispatcher->handle_event(owned_event.get());
+            deliver_queued_input(input_dispatcher, input_queue);
         });
 }
 
@@ -150,3 +155,30 @@ void mf::XWaylandSurfaceObserver::aquire_input_dispatcher(std::function<void(Way
             }
         });
 }
+
+void mf::XWaylandSurfaceObserver::deliver_queued_input(
+    std::shared_ptr<ThreadsafeInputDispatcher> const& input_dispatcher,
+    std::shared_ptr<InputEventQueue> const& input_queue)
+{
+    std::lock_guard<std::mutex> lock{input_dispatcher->mutex};
+    if (!input_dispatcher->dispatcher)
+        return;
+
+    auto const dispatcher = input_dispatcher->dispatcher.value().get();
+
+    if (dispatcher->client_is_backed_up())
+    {
+        // Leave the events queued (where motion keeps coalescing) and try again once the client has had a chance
+        // to read. The delivery stays scheduled meanwhile, so new events don't schedule another.
+        dispatcher->retry_later([input_dispatcher, input_queue]()
+            {
+                deliver_queued_input(input_dispatcher, input_queue);
+            });
+        return;
+    }
+
+    for (auto const& event : input_queue->take())
+    {
+        dispatcher->handle_event(event.get());
+    }
+}
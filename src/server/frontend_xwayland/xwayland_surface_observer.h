@@ -37,6 +37,7 @@ namespace frontend
 class WlSeat;
 class WlSurface;
 class WaylandInputDispatcher;
+class InputEventQueue;
 class XWaylandSurfaceObserverSurface;
 
 /// Must not outlive the XWaylandSurface
@@ -84,10 +85,17 @@ private:
 
     XWaylandSurfaceObserverSurface* const wm_surface;
     std::shared_ptr<ThreadsafeInputDispatcher> const input_dispatcher;
+    /// Input waiting to be delivered, shared with the work queued on the Wayland thread
+    std::shared_ptr<InputEventQueue> const input_queue;
 
     /// Runs work on the Wayland thread if the input dispatcher still exists
     /// Does nothing if the input dispatcher has already been destroyed
     void aquire_input_dispatcher(std::function<void(WaylandInputDispatcher*)>&& work);
+
+    /// Sends the queued input, or retries later if the client is backed up. Must be called on the Wayland thread.
+    static void deliver_queued_input(
+        std::shared_ptr<ThreadsafeInputDispatcher> const& input_dispatcher,
+        std::shared_ptr<InputEventQueue> const& input_queue);
 };
 }
 }
@@ -95,6 +95,15 @@ void mf::XWaylandSurfaceRole::commit(WlSurfaceState const& state)
     {
         refresh_surface_data_now();
     }
+
+    if (!seen_first_frame && state.buffer && state.buffer.value())
+    {
+        seen_first_frame = true;
+        if (auto const wm_surface = weak_wm_surface.lock())
+        {
+            wm_surface->wl_surface_first_frame();
+        }
+    }
 }
 
 void mf::XWaylandSurfaceRole::visiblity(bool /*visible*/)
@@ -53,6 +53,7 @@ private:
     std::shared_ptr<shell::Shell> const shell;
     std::weak_ptr<XWaylandSurfaceRoleSurface> const weak_wm_surface;
     WlSurface* const wl_surface;
+    bool seen_first_frame{false};
 
     /// Overrides from WlSurfaceRole
     /// @{
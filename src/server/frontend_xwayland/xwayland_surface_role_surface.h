@@ -37,6 +37,8 @@ class XWaylandSurfaceRoleSurface
 {
 public:
     virtual void wl_surface_destroyed() = 0;
+    /// Called once, when the client commits the first buffer to the wl_surface
+    virtual void wl_surface_first_frame() = 0;
     virtual auto scene_surface() const -> std::experimental::optional<std::shared_ptr<scene::Surface>> = 0;
 
     virtual ~XWaylandSurfaceRoleSurface() = default;
@@ -27,6 +27,7 @@
 #include "mir/dispatch/multiplexing_dispatchable.h"
 #include "mir/dispatch/readable_fd.h"
 #include "mir/fd.h"
+#include "mir/heap_accounting.h"
 #include "mir/terminate_with_current_exception.h"
 
 #include <cstring>
@@ -346,6 +347,7 @@ void mf::XWaylandWM::run_on_wayland_thread(std::function<void()>&& work)
 /* Events */
 void mf::XWaylandWM::handle_events()
 {
+    mir::heap_accounting::Scope const heap_scope{mir::heap_accounting::Subsystem::xwayland};
     bool got_events = false;
 
     while (xcb_generic_event_t* const event = xcb_poll_for_event(*connection))
@@ -370,6 +372,25 @@ void mf::XWaylandWM::handle_events()
     {
         connection->flush();
     }
+
+    flush_wayland_work();
+}
+
+void mf::XWaylandWM::flush_wayland_work()
+{
+    if (pending_wayland_work.empty())
+        return;
+
+    // One hop to the Wayland thread per burst of X events, rather than one per event
+    wayland_connector->run_on_wayland_display([work = std::move(pending_wayland_work)](auto)
+        {
+            mir::heap_accounting::Scope const heap_scope{mir::heap_accounting::Subsystem::xwayland};
+            for (auto const& item : work)
+            {
+                item();
+            }
+        });
+    pending_wayland_work.clear();
 }
 
 void mf::XWaylandWM::handle_event(xcb_generic_event_t* event)
@@ -684,12 +705,19 @@ void mf::XWaylandWM::handle_surface_id(
 {
     uint32_t id = event->data.data32[0];
 
-    wayland_connector->run_on_wayland_display([
+    // Queued rather than sent, so associations arriving in the same burst share one hop.
+    // If the wl_surface already exists on_surface_created() attaches it straight away,
+    // otherwise the callback is held until the client creates it.
+    //
+    // There is no per-window path that skips the hop: attaching creates the surface's role,
+    // which is a Wayland object, and the WlSurface it attaches to can only be used on the
+    // Wayland thread.
+    pending_wayland_work.push_back([
             wayland_connector = wayland_connector,
             client=wayland_client,
             id,
             weak_surface,
-            weak_shell = std::weak_ptr<shell::Shell>{wm_shell->shell}](auto)
+            weak_shell = std::weak_ptr<shell::Shell>{wm_shell->shell}]()
         {
             wayland_connector->on_surface_created(client, id, [weak_surface, weak_shell](WlSurface* wl_surface)
                 {
@@ -23,10 +23,12 @@
 #include "wayland_connector.h"
 #include "xcb_connection.h"
 
+#include <functional>
 #include <map>
 #include <thread>
 #include <experimental/optional>
 #include <mutex>
+#include <vector>
 
 #include <wayland-server-core.h>
 
@@ -96,6 +98,8 @@ private:
     // Event handeling
     void handle_events();
     void handle_event(xcb_generic_event_t* event);
+    /// Sends work queued while handling events to the Wayland thread in a single batch
+    void flush_wayland_work();
 
     // Events
     void handle_create_notify(xcb_create_notify_event_t *event);
@@ -134,6 +138,8 @@ private:
     xcb_render_pictforminfo_t xcb_format_rgb, xcb_format_rgba;
     const xcb_query_extension_reply_t *xfixes;
     std::unique_ptr<dispatch::ThreadedDispatcher> event_thread;
+    /// Only accessed on the event thread
+    std::vector<std::function<void()>> pending_wayland_work;
     xcb_visualid_t xcb_visual_id;
     xcb_colormap_t xcb_colormap;
 };
@@ -129,6 +129,7 @@ mir::GLibMainLoop::GLibMainLoop(
     std::shared_ptr<time::Clock> const& clock)
     : clock{clock},
       running_{false},
+      server_actions{main_context},
       fd_sources{main_context},
       signal_sources{fd_sources},
       before_iteration_hook{[]{}}
@@ -256,12 +257,7 @@ void mir::GLibMainLoop::enqueue(void const* owner, ServerAction const& action)
             catch (...) { handle_exception(std::current_exception()); }
         };
 
-    detail::add_server_action_gsource(main_context, owner,
-        action_with_exception_handling,
-        [this] (void const* owner)
-        {
-            return should_process_actions_for(owner);
-        });
+    server_actions.enqueue(owner, action_with_exception_handling);
 }
 
 
@@ -309,30 +305,12 @@ void mir::GLibMainLoop::enqueue_with_guaranteed_execution(mir::ServerAction cons
 
 void mir::GLibMainLoop::pause_processing_for(void const* owner)
 {
-    std::lock_guard<std::mutex> lock{do_not_process_mutex};
-
-    auto const iter = std::find(do_not_process.begin(), do_not_process.end(), owner);
-    if (iter == do_not_process.end())
-        do_not_process.push_back(owner);
+    server_actions.pause_processing_for(owner);
 }
 
 void mir::GLibMainLoop::resume_processing_for(void const* owner)
 {
-    std::lock_guard<std::mutex> lock{do_not_process_mutex};
-
-    auto const new_end = std::remove(do_not_process.begin(), do_not_process.end(), owner);
-    do_not_process.erase(new_end, do_not_process.end());
-
-    // Wake up the context to reprocess all sources
-    g_main_context_wakeup(main_context);
-}
-
-bool mir::GLibMainLoop::should_process_actions_for(void const* owner)
-{
-    std::lock_guard<std::mutex> lock{do_not_process_mutex};
-
-    auto const iter = std::find(do_not_process.begin(), do_not_process.end(), owner);
-    return iter == do_not_process.end();
+    server_actions.resume_processing_for(owner);
 }
 
 std::unique_ptr<mir::time::Alarm> mir::GLibMainLoop::create_alarm(
@@ -460,9 +438,5 @@ void mir::GLibMainLoop::spawn(std::function<void()>&& work)
             catch (...) { handle_exception(std::current_exception()); }
         };
 
-    detail::add_server_action_gsource(
-        main_context,
-        nullptr,
-        action_with_exception_handling,
-        [](auto) { return true; });
+    server_actions.enqueue(nullptr, action_with_exception_handling);
 }
@@ -23,12 +23,15 @@
 
 #include <algorithm>
 #include <atomic>
+#include <deque>
+#include <iterator>
 #include <system_error>
 #include <sstream>
 
 #include <csignal>
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/eventfd.h>
 
 #include <boost/throw_exception.hpp>
 #include <glib-unix.h>
@@ -179,80 +182,6 @@ void md::add_idle_gsource(
     g_source_attach(gsource, main_context);
 }
 
-void md::add_server_action_gsource(
-    GMainContext* main_context,
-    void const* owner,
-    std::function<void()> const& action,
-    std::function<bool(void const*)> const& should_dispatch)
-{
-    struct ServerActionContext
-    {
-        void const* const owner;
-        std::function<void(void)> const action;
-        std::function<bool(void const*)> const should_dispatch;
-
-        // If we come to finalize() before dispatch() we have already
-        // torn down most of Mir and even unloaded some shared libraries.
-        // That means the action could refer to  stuff that is no longer
-        // in the address space.
-        // We will just leak any resources instead of crashing.
-        bool mutable dispatched{false};
-    };
-
-    struct ServerActionGSource
-    {
-        GSource gsource;
-        ServerActionContext ctx;
-        bool ctx_constructed;
-
-        static gboolean prepare(GSource* source, gint *timeout)
-        {
-            *timeout = -1;
-            auto const& ctx = reinterpret_cast<ServerActionGSource*>(source)->ctx;
-            return ctx.should_dispatch(ctx.owner);
-        }
-
-        static gboolean check(GSource* source)
-        {
-            auto const& ctx = reinterpret_cast<ServerActionGSource*>(source)->ctx;
-            return ctx.should_dispatch(ctx.owner);
-        }
-
-        static gboolean dispatch(GSource* source, GSourceFunc, gpointer)
-        {
-            auto const& ctx = reinterpret_cast<ServerActionGSource*>(source)->ctx;
-            ctx.action();
-            ctx.dispatched = true;
-            return FALSE;
-        }
-
-        static void finalize(GSource* source)
-        {
-            auto const sa_gsource = reinterpret_cast<ServerActionGSource*>(source);
-            if (sa_gsource->ctx_constructed && sa_gsource->ctx.dispatched)
-                sa_gsource->ctx.~ServerActionContext();
-        }
-    };
-
-    static GSourceFuncs gsource_funcs{
-        ServerActionGSource::prepare,
-        ServerActionGSource::check,
-        ServerActionGSource::dispatch,
-        ServerActionGSource::finalize,
-        nullptr,
-        nullptr
-    };
-
-    GSourceRef gsource{g_source_new(&gsource_funcs, sizeof(ServerActionGSource))};
-    auto const sa_gsource = reinterpret_cast<ServerActionGSource*>(static_cast<GSource*>(gsource));
-
-    sa_gsource->ctx_constructed = false;
-    new (&sa_gsource->ctx) decltype(sa_gsource->ctx){owner, action, should_dispatch};
-    sa_gsource->ctx_constructed = true;
-
-    g_source_attach(gsource, main_context);
-}
-
 md::GSourceHandle md::add_timer_gsource(
     GMainContext* main_context,
     std::shared_ptr<time::Clock> const& clock,
@@ -463,6 +392,195 @@ void md::FdSources::remove_all_owned_by(void const* owner)
     sources.erase(new_end, sources.end());
 }
 
+/***********************
+ * ServerActionSources *
+ ***********************/
+
+struct md::ServerActionSources::ActionQueue
+{
+    struct Action
+    {
+        void const* owner;
+        std::function<void()> action;
+    };
+
+    ActionQueue()
+        : wakeup_fd{eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)}
+    {
+        if (wakeup_fd < 0)
+        {
+            BOOST_THROW_EXCEPTION(
+                std::system_error(errno, std::system_category(), "Failed to create server action eventfd"));
+        }
+    }
+
+    ~ActionQueue()
+    {
+        // If we are destroyed with actions still queued we have already
+        // torn down most of Mir and even unloaded some shared libraries.
+        // That means the actions could refer to stuff that is no longer
+        // in the address space.
+        // We will just leak any resources instead of crashing.
+        if (!actions.empty())
+            new std::deque<Action>{std::move(actions)};
+    }
+
+    void enqueue(void const* owner, std::function<void()> const& action)
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            actions.push_back(Action{owner, action});
+            if (wakeup_pending)
+                return;
+            wakeup_pending = true;
+        }
+
+        wake();
+    }
+
+    void pause(void const* owner)
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+
+        if (std::find(paused.begin(), paused.end(), owner) == paused.end())
+        {
+            paused.push_back(owner);
+            any_paused = true;
+        }
+    }
+
+    void resume(void const* owner)
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+
+            auto const new_end = std::remove(paused.begin(), paused.end(), owner);
+            paused.erase(new_end, paused.end());
+            any_paused = !paused.empty();
+            wakeup_pending = true;
+        }
+
+        // The resumed owner may have actions waiting
+        wake();
+    }
+
+    void disable()
+    {
+        enabled = false;
+    }
+
+    // The GSource holds its own reference, so the queue outlives any in-flight dispatch
+    static gboolean static_call(int fd, GIOCondition, std::shared_ptr<ActionQueue>* queue)
+    {
+        eventfd_t ignored;
+        if (eventfd_read(fd, &ignored)) {}
+
+        (*queue)->dispatch();
+
+        return G_SOURCE_CONTINUE;
+    }
+
+    static void static_destroy(std::shared_ptr<ActionQueue>* queue)
+    {
+        delete queue;
+    }
+
+    mir::Fd const wakeup_fd;
+
+private:
+    void wake()
+    {
+        if (eventfd_write(wakeup_fd, 1)) {}
+    }
+
+    auto is_paused(void const* owner) -> bool
+    {
+        if (!any_paused)
+            return false;
+
+        std::lock_guard<std::mutex> lock{mutex};
+        return std::find(paused.begin(), paused.end(), owner) != paused.end();
+    }
+
+    void dispatch()
+    {
+        std::deque<Action> batch;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            wakeup_pending = false;
+            batch.swap(actions);
+        }
+
+        std::deque<Action> held;
+        for (auto& action : batch)
+        {
+            if (!enabled || is_paused(action.owner))
+            {
+                held.push_back(std::move(action));
+            }
+            else
+            {
+                action.action();
+            }
+        }
+
+        if (!held.empty())
+        {
+            // Anything enqueued while dispatching goes after the held actions
+            std::lock_guard<std::mutex> lock{mutex};
+            std::move(actions.begin(), actions.end(), std::back_inserter(held));
+            actions.swap(held);
+        }
+    }
+
+    std::mutex mutex;
+    std::deque<Action> actions;
+    bool wakeup_pending{false};
+    std::vector<void const*> paused;
+    std::atomic<bool> any_paused{false};
+    std::atomic<bool> enabled{true};
+};
+
+md::ServerActionSources::ServerActionSources(GMainContext* main_context)
+    : queue{std::make_shared<ActionQueue>()}
+{
+    auto const queue = this->queue;
+
+    // As with FdSources, g_source_destroy() doesn't guarantee the callback
+    // won't run again, so disable the queue first.
+    gsource = GSourceHandle{
+        g_unix_fd_source_new(queue->wakeup_fd, G_IO_IN),
+        [queue] (GSource*) { queue->disable(); }};
+
+    g_source_set_callback(
+        gsource,
+        reinterpret_cast<GSourceFunc>(reinterpret_cast<void*>(&ActionQueue::static_call)),
+        new std::shared_ptr<ActionQueue>{queue},
+        reinterpret_cast<GDestroyNotify>(reinterpret_cast<void*>(&ActionQueue::static_destroy)));
+
+    g_source_attach(gsource, main_context);
+}
+
+md::ServerActionSources::~ServerActionSources()
+{
+    gsource.ensure_no_further_dispatch();
+}
+
+void md::ServerActionSources::enqueue(void const* owner, std::function<void()> const& action)
+{
+    queue->enqueue(owner, action);
+}
+
+void md::ServerActionSources::pause_processing_for(void const* owner)
+{
+    queue->pause(owner);
+}
+
+void md::ServerActionSources::resume_processing_for(void const* owner)
+{
+    queue->resume(owner);
+}
+
 /*****************
  * SignalSources *
  *****************/
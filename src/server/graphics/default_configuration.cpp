@@ -31,6 +31,7 @@
 #include "mir/graphics/gl_config.h"
 #include "mir/graphics/platform.h"
 #include "mir/graphics/cursor.h"
+#include "mir/graphics/frame_timing_tracker.h"
 #include "display_configuration_observer_multiplexer.h"
 
 #include "mir/shared_library.h"
@@ -270,6 +271,16 @@ mir::DefaultServerConfiguration::the_display_configuration_observer_registrar()
         });
 }
 
+std::shared_ptr<mg::FrameTimingTracker>
+mir::DefaultServerConfiguration::the_frame_timing_tracker()
+{
+    return frame_timing_tracker(
+        []
+        {
+            return std::make_shared<mg::FrameTimingTracker>();
+        });
+}
+
 std::shared_ptr<mg::DisplayConfigurationObserver>
 mir::DefaultServerConfiguration::the_display_configuration_observer()
 {
@@ -0,0 +1,154 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/graphics/frame_timing_tracker.h"
+
+namespace mg = mir::graphics;
+namespace mt = mir::time;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+/// Outputs that haven't presented a frame for this long may have been switched off or unplugged
+auto const stale_after = 1s;
+}
+
+void mg::FrameTimingTracker::frame_presented(unsigned int output_id, Frame const& frame)
+{
+    std::lock_guard<std::mutex> lock{mutex};
+
+    auto const existing = outputs.find(output_id);
+    if (existing == outputs.end())
+    {
+        outputs[output_id].last_frame = frame;
+        return;
+    }
+
+    auto& output = existing->second;
+    auto const& last = output.last_frame;
+
+    if (frame.ust.clock_id == last.ust.clock_id &&
+        frame.msc > last.msc &&
+        frame.ust.nanoseconds > last.ust.nanoseconds)
+    {
+        output.period = (frame.ust - last.ust) / (frame.msc - last.msc);
+    }
+    else if (frame.msc < last.msc)
+    {
+        // The counter restarted, so the output has probably been reconfigured
+        output.period = 0ns;
+    }
+
+    output.last_frame = frame;
+}
+
+auto mg::FrameTimingTracker::next_frame_after(mt::PosixTimestamp const& t) const -> optional_value<mt::PosixTimestamp>
+{
+    std::lock_guard<std::mutex> lock{mutex};
+
+    OutputTiming const* fastest{nullptr};
+    for (auto const& output : outputs)
+    {
+        auto const& timing = output.second;
+        if (timing.period <= 0ns ||
+            timing.last_frame.ust.clock_id != t.clock_id ||
+            t.nanoseconds - timing.last_frame.ust.nanoseconds > stale_after)
+        {
+            continue;
+        }
+
+        if (!fastest || timing.period < fastest->period)
+            fastest = &timing;
+    }
+
+    if (!fastest)
+        return {};
+
+    auto const& last = fastest->last_frame.ust;
+    auto const period = fastest->period;
+
+    // Refreshes carry on at the same phase whether or not there is anything new to present
+    auto const since_last = t.nanoseconds - last.nanoseconds;
+    auto frames = since_last / period;
+    if (since_last >= 0ns)
+        ++frames;
+
+    mt::PosixTimestamp next{t.clock_id, last.nanoseconds + frames * period};
+    if (next.nanoseconds <= t.nanoseconds)
+        next.nanoseconds += period;
+
+    return next;
+}
+
+mg::FrameTimingDisplayReport::FrameTimingDisplayReport(
+    std::shared_ptr<DisplayReport> const& wrapped,
+    std::shared_ptr<FrameTimingTracker> const& tracker)
+    : wrapped{wrapped},
+      tracker{tracker}
+{
+}
+
+void mg::FrameTimingDisplayReport::report_successful_setup_of_native_resources()
+{
+    wrapped->report_successful_setup_of_native_resources();
+}
+
+void mg::FrameTimingDisplayReport::report_successful_egl_make_current_on_construction()
+{
+    wrapped->report_successful_egl_make_current_on_construction();
+}
+
+void mg::FrameTimingDisplayReport::report_successful_egl_buffer_swap_on_construction()
+{
+    wrapped->report_successful_egl_buffer_swap_on_construction();
+}
+
+void mg::FrameTimingDisplayReport::report_successful_display_construction()
+{
+    wrapped->report_successful_display_construction();
+}
+
+void mg::FrameTimingDisplayReport::report_egl_configuration(EGLDisplay disp, EGLConfig cfg)
+{
+    wrapped->report_egl_configuration(disp, cfg);
+}
+
+void mg::FrameTimingDisplayReport::report_vsync(unsigned int output_id, Frame const& f)
+{
+    tracker->frame_presented(output_id, f);
+    wrapped->report_vsync(output_id, f);
+}
+
+void mg::FrameTimingDisplayReport::report_successful_drm_mode_set_crtc_on_construction()
+{
+    wrapped->report_successful_drm_mode_set_crtc_on_construction();
+}
+
+void mg::FrameTimingDisplayReport::report_drm_master_failure(int error)
+{
+    wrapped->report_drm_master_failure(error);
+}
+
+void mg::FrameTimingDisplayReport::report_vt_switch_away_failure()
+{
+    wrapped->report_vt_switch_away_failure();
+}
+
+void mg::FrameTimingDisplayReport::report_vt_switch_back_failure()
+{
+    wrapped->report_vt_switch_back_failure();
+}
@@ -24,6 +24,7 @@
 #include "mir/geometry/size.h"
 
 #include <boost/throw_exception.hpp>
+#include <algorithm>
 #include <stdexcept>
 
 namespace mg = mir::graphics;
@@ -33,6 +34,18 @@ namespace geom = mir::geometry;
 namespace
 {
 
+auto composited_extents(mg::DisplayConfiguration const& conf) -> std::vector<geom::Rectangle>
+{
+    std::vector<geom::Rectangle> extents;
+    conf.for_each_output(
+        [&extents] (mg::DisplayConfigurationOutput const& output)
+        {
+            if (output.connected && output.preferred_mode_index < output.modes.size())
+                extents.push_back(output.extents());
+        });
+    return extents;
+}
+
 mgo::detail::EGLDisplayHandle
 create_and_initialize_display(EGLNativeDisplayType egl_native_display)
 {
@@ -94,6 +107,11 @@ mgo::detail::DisplaySyncGroup::recommended_sleep() const
     return std::chrono::milliseconds::zero();
 }
 
+auto mgo::detail::DisplaySyncGroup::view_area() const -> geom::Rectangle
+{
+    return output->view_area();
+}
+
 mgo::Display::Display(
     EGLNativeDisplayType egl_native_display,
     std::shared_ptr<DisplayConfigurationPolicy> const& initial_conf_policy,
@@ -145,20 +163,65 @@ void mgo::Display::configure(mg::DisplayConfiguration const& conf)
 
     display_sync_groups.clear();
 
-    conf.for_each_output(
-        [this] (DisplayConfigurationOutput const& output)
+    for (auto const& extents : composited_extents(conf))
+        display_sync_groups.push_back(create_sync_group_for(extents));
+}
+
+void mgo::Display::configure_incrementally(
+    mg::DisplayConfiguration const& conf,
+    std::function<void(mg::DisplaySyncGroup& group)> const& removing,
+    std::function<void(mg::DisplaySyncGroup& group)> const& added)
+{
+    if (!conf.valid())
+    {
+        BOOST_THROW_EXCEPTION(
+            std::logic_error("Invalid or inconsistent display configuration"));
+    }
+
+    std::vector<mg::DisplaySyncGroup*> new_groups;
+    {
+        std::lock_guard<std::mutex> lock{configuration_mutex};
+
+        auto wanted = composited_extents(conf);
+        std::vector<std::unique_ptr<detail::DisplaySyncGroup>> groups;
+
+        // A group whose output keeps its extents is untouched
+        for (auto& group : display_sync_groups)
         {
-            if (output.connected && output.preferred_mode_index < output.modes.size())
+            auto const match = std::find(wanted.begin(), wanted.end(), group->view_area());
+            if (match != wanted.end())
             {
-                eglBindAPI(MIR_SERVER_EGL_OPENGL_API);
-                auto raw_db = new mgo::DisplayBuffer{
-                    SurfacelessEGLContext{egl_display, egl_context_shared},
-                    output.extents()};
-
-                display_sync_groups.emplace_back(
-                    new mgo::detail::DisplaySyncGroup(std::unique_ptr<mg::DisplayBuffer>(raw_db)));
+                wanted.erase(match);
+                groups.push_back(std::move(group));
             }
-        });
+            else
+            {
+                removing(*group);
+            }
+        }
+
+        for (auto const& extents : wanted)
+        {
+            groups.push_back(create_sync_group_for(extents));
+            new_groups.push_back(groups.back().get());
+        }
+
+        display_sync_groups = std::move(groups);
+    }
+
+    for (auto const group : new_groups)
+        added(*group);
+}
+
+auto mgo::Display::create_sync_group_for(geom::Rectangle const& extents) const
+    -> std::unique_ptr<detail::DisplaySyncGroup>
+{
+    eglBindAPI(MIR_SERVER_EGL_OPENGL_API);
+    auto raw_db = new mgo::DisplayBuffer{
+        SurfacelessEGLContext{egl_display, egl_context_shared},
+        extents};
+
+    return std::make_unique<mgo::detail::DisplaySyncGroup>(std::unique_ptr<mg::DisplayBuffer>(raw_db));
 }
 
 void mgo::Display::register_configuration_change_handler(
@@ -20,6 +20,7 @@
 #define MIR_GRAPHICS_OFFSCREEN_DISPLAY_H_
 
 #include "mir/graphics/display.h"
+#include "mir/graphics/incremental_display.h"
 #include "display_configuration.h"
 #include "mir/graphics/surfaceless_egl_context.h"
 #include "mir/renderer/gl/context_source.h"
@@ -66,6 +67,8 @@ public:
     void for_each_display_buffer(std::function<void(DisplayBuffer&)> const&) override;
     void post() override;
     std::chrono::milliseconds recommended_sleep() const override;
+
+    auto view_area() const -> geometry::Rectangle;
 private:
     std::unique_ptr<DisplayBuffer> const output;
 };
@@ -74,6 +77,7 @@ private:
 
 class Display : public graphics::Display,
                 public graphics::NativeDisplay,
+                public graphics::IncrementalDisplay,
                 public renderer::gl::ContextSource
 {
 public:
@@ -107,12 +111,19 @@ public:
 
     std::unique_ptr<renderer::gl::Context> create_gl_context() const override;
     bool apply_if_configuration_preserves_display_buffers(graphics::DisplayConfiguration const& conf) override;
+
+    void configure_incrementally(
+        graphics::DisplayConfiguration const& conf,
+        std::function<void(graphics::DisplaySyncGroup& group)> const& removing,
+        std::function<void(graphics::DisplaySyncGroup& group)> const& added) override;
 private:
+    auto create_sync_group_for(geometry::Rectangle const& extents) const -> std::unique_ptr<detail::DisplaySyncGroup>;
+
     detail::EGLDisplayHandle const egl_display;
     SurfacelessEGLContext const egl_context_shared;
     mutable std::mutex configuration_mutex;
     DisplayConfiguration current_display_configuration;
-    std::vector<std::unique_ptr<DisplaySyncGroup>> display_sync_groups;
+    std::vector<std::unique_ptr<detail::DisplaySyncGroup>> display_sync_groups;
 };
 
 }
@@ -86,6 +86,11 @@ public:
         return {position, buffer_->size()};
     }
 
+    geom::Rectangle src_bounds() const override
+    {
+        return {{0, 0}, buffer_->size()};
+    }
+
     std::experimental::optional<geometry::Rectangle> clip_area() const override
     {
         return std::experimental::optional<geometry::Rectangle>();
@@ -222,14 +227,26 @@ void mg::SoftwareCursor::hide()
 
 void mg::SoftwareCursor::move_to(geometry::Point position)
 {
+    geom::Rectangle old_area;
+    geom::Rectangle new_area;
     {
         std::lock_guard<std::mutex> lg{guard};
 
         if (!renderable)
             return;
 
+        old_area = renderable->screen_position();
         renderable->move_to(position - hotspot);
+        new_area = renderable->screen_position();
+
+        // A hidden cursor isn't in the scene, so there's nothing to redraw
+        if (!visible || old_area == new_area)
+            return;
     }
 
-    scene->emit_scene_changed();
+    // Only the outputs the cursor is leaving or entering need recompositing.
+    // Several motions between frames are coalesced by the compositor into a
+    // single frame on each affected output.
+    scene->emit_scene_damaged(old_area);
+    scene->emit_scene_damaged(new_area);
 }
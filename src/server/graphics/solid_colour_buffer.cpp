@@ -0,0 +1,68 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/graphics/solid_colour_buffer.h"
+
+namespace mg = mir::graphics;
+namespace geom = mir::geometry;
+
+mg::SolidColourBuffer::SolidColourBuffer(
+    geom::Size size,
+    Colour const& colour,
+    std::function<void()>&& on_consumed)
+    : size_{size},
+      colour_(colour),
+      on_consumed{std::move(on_consumed)}
+{
+}
+
+std::shared_ptr<mg::NativeBuffer> mg::SolidColourBuffer::native_buffer_handle() const
+{
+    return nullptr;
+}
+
+geom::Size mg::SolidColourBuffer::size() const
+{
+    return size_;
+}
+
+MirPixelFormat mg::SolidColourBuffer::pixel_format() const
+{
+    // An opaque colour is reported without alpha so that it occludes what lies beneath
+    return colour_.a < 1.0f ? mir_pixel_format_abgr_8888 : mir_pixel_format_xbgr_8888;
+}
+
+mg::NativeBufferBase* mg::SolidColourBuffer::native_buffer_base()
+{
+    return this;
+}
+
+auto mg::SolidColourBuffer::colour() const -> Colour
+{
+    return colour_;
+}
+
+void mg::SolidColourBuffer::mark_consumed()
+{
+    std::function<void()> notify;
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        std::swap(notify, on_consumed);
+    }
+
+    if (notify)
+        notify();
+}
@@ -152,6 +152,10 @@ struct UpdateCursorOnSceneChanges : ms::Observer
         cursor_controller->update_cursor_image();
     }
 
+    void scene_damaged(geom::Rectangle const&) override
+    {
+    }
+
     void surface_exists(std::shared_ptr<ms::Surface> const& surface) override
     {
         add_surface_observer(surface.get());
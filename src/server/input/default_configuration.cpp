@@ -19,6 +19,7 @@
 #include "mir/default_server_configuration.h"
 
 #include "key_repeat_dispatcher.h"
+#include "kinetic_scroll_dispatcher.h"
 #include "event_filter_chain_dispatcher.h"
 #include "config_changer.h"
 #include "cursor_controller.h"
@@ -33,6 +34,7 @@
 #include "basic_seat.h"
 #include "seat_observer_multiplexer.h"
 
+#include "mir/graphics/frame_timing_tracker.h"
 #include "mir/input/touch_visualizer.h"
 #include "mir/input/input_probe.h"
 #include "mir/input/platform.h"
@@ -140,8 +142,18 @@ mir::DefaultServerConfiguration::the_input_dispatcher()
             // lp:1675357: Disable generation of key repeat events on nested servers
             auto enable_repeat = options->get<bool>(options::enable_key_repeat_opt);
 
+            std::shared_ptr<mi::InputDispatcher> next_dispatcher = the_event_filter_chain_dispatcher();
+            if (options->get<bool>(options::kinetic_scroll_opt))
+            {
+                // Only used until an output has reported its refresh timing
+                std::chrono::milliseconds const kinetic_scroll_fallback_tick{16};
+                next_dispatcher = std::make_shared<mi::KineticScrollDispatcher>(
+                    next_dispatcher, the_main_loop(), the_clock(), the_frame_timing_tracker(),
+                    kinetic_scroll_fallback_tick);
+            }
+
             return std::make_shared<mi::KeyRepeatDispatcher>(
-                the_event_filter_chain_dispatcher(), the_main_loop(), the_cookie_authority(),
+                next_dispatcher, the_main_loop(), the_cookie_authority(),
                 enable_repeat, key_repeat_timeout, key_repeat_delay, false);
         });
 }
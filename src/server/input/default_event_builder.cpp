@@ -85,6 +85,33 @@ mir::EventUPtr mi::DefaultEventBuilder::pointer_event(Timestamp timestamp,
                           hscroll_value, vscroll_value, relative_x_value, relative_y_value);
 }
 
+mir::EventUPtr mi::DefaultEventBuilder::pointer_motion_event(Timestamp timestamp,
+                                                             MirPointerButtons buttons_pressed,
+                                                             float relative_x_value,
+                                                             float relative_y_value,
+                                                             float unaccelerated_x_value,
+                                                             float unaccelerated_y_value)
+{
+    auto event = pointer_event(timestamp, mir_pointer_action_motion, buttons_pressed, 0.0f, 0.0f,
+                               relative_x_value, relative_y_value);
+    me::set_unaccelerated_motion(*event, unaccelerated_x_value, unaccelerated_y_value);
+    return event;
+}
+
+mir::EventUPtr mi::DefaultEventBuilder::touchpad_gesture_event(Timestamp timestamp,
+                                                               MirTouchpadGesture gesture,
+                                                               MirTouchpadGestureAction action,
+                                                               unsigned int finger_count,
+                                                               float dx,
+                                                               float dy,
+                                                               float scale,
+                                                               float rotation,
+                                                               bool cancelled)
+{
+    return me::make_touchpad_gesture_event(device_id, timestamp, mir_input_event_modifier_none, gesture, action,
+                                           finger_count, dx, dy, scale, rotation, cancelled);
+}
+
 mir::EventUPtr mi::DefaultEventBuilder::touch_event(Timestamp timestamp, std::vector<events::ContactState> const& contacts)
 {
     std::vector<uint8_t> vec_cookie{};
@@ -54,6 +54,13 @@ public:
                             float x, float y, float hscroll_value, float vscroll_value, float relative_x_value,
                             float relative_y_value) override;
 
+    EventUPtr pointer_motion_event(Timestamp timestamp, MirPointerButtons buttons_pressed,
+                                   float relative_x_value, float relative_y_value,
+                                   float unaccelerated_x_value, float unaccelerated_y_value) override;
+
+    EventUPtr touchpad_gesture_event(Timestamp timestamp, MirTouchpadGesture gesture,
+                                     MirTouchpadGestureAction action, unsigned int finger_count,
+                                     float dx, float dy, float scale, float rotation, bool cancelled) override;
 
 private:
     MirInputDeviceId const device_id;
@@ -30,6 +30,7 @@
 #include "mir/dispatch/action_queue.h"
 #include "mir/server_action_queue.h"
 #include "mir/cookie/authority.h"
+#include "mir/heap_accounting.h"
 #define MIR_LOG_COMPONENT "Input"
 #include "mir/log.h"
 
@@ -279,6 +280,7 @@ MirInputDeviceId mi::DefaultInputDeviceHub::RegisteredDevice::id()
 
 void mi::DefaultInputDeviceHub::RegisteredDevice::handle_input(std::shared_ptr<MirEvent> const& event)
 {
+    mir::heap_accounting::Scope const heap_scope{mir::heap_accounting::Subsystem::input};
     auto type = mir_event_get_type(event.get());
 
     if (type != mir_event_type_input &&
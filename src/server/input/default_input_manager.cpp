@@ -174,3 +174,13 @@ void mi::DefaultInputManager::continue_after_config()
 {
     queue->enqueue([this](){platform->continue_after_config();});
 }
+
+void mi::DefaultInputManager::suspend_non_wake_devices()
+{
+    queue->enqueue([this](){platform->suspend_non_wake_devices();});
+}
+
+void mi::DefaultInputManager::resume_non_wake_devices()
+{
+    queue->enqueue([this](){platform->resume_non_wake_devices();});
+}
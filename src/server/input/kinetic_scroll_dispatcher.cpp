@@ -0,0 +1,265 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "kinetic_scroll_dispatcher.h"
+
+#include "mir/time/alarm_factory.h"
+#include "mir/time/alarm.h"
+#include "mir/time/clock.h"
+#include "mir/graphics/frame_timing.h"
+#include "mir/events/event_builders.h"
+
+#include <cmath>
+
+namespace mi = mir::input;
+namespace mev = mir::events;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+/// Only scrolling this recent is used to work out how fast the fingers were moving when they lifted
+auto const velocity_window = 100ms;
+/// If the fingers rested for longer than this before lifting, there is no fling
+auto const max_pause_before_stop = 50ms;
+/// Time for the velocity to decay to 1/e of its value
+float const decay_time_constant_s{0.325f};
+/// Scroll units per second
+float const min_fling_velocity{10.0f};
+float const min_velocity{1.0f};
+
+auto speed(float h, float v) -> float
+{
+    return std::hypot(h, v);
+}
+}
+
+mi::KineticScrollDispatcher::KineticScrollDispatcher(
+    std::shared_ptr<InputDispatcher> const& next_dispatcher,
+    std::shared_ptr<time::AlarmFactory> const& factory,
+    std::shared_ptr<time::Clock> const& clock,
+    std::shared_ptr<graphics::FrameTiming> const& frame_timing,
+    std::chrono::milliseconds fallback_tick)
+    : next_dispatcher{next_dispatcher},
+      clock{clock},
+      frame_timing{frame_timing},
+      fallback_tick{fallback_tick},
+      fling_alarm{factory->create_alarm([this]() { fling_tick(); })}
+{
+}
+
+bool mi::KineticScrollDispatcher::dispatch(std::shared_ptr<MirEvent const> const& event)
+{
+    if (mir_event_get_type(event.get()) == mir_event_type_input)
+    {
+        auto const iev = mir_event_get_input_event(event.get());
+        switch (mir_input_event_get_type(iev))
+        {
+        case mir_input_event_type_pointer:
+            handle_pointer_event(mir_input_event_get_pointer_event(iev));
+            break;
+
+        case mir_input_event_type_touch:
+        case mir_input_event_type_touchpad_gesture:
+            stop_fling();
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return next_dispatcher->dispatch(event);
+}
+
+void mi::KineticScrollDispatcher::start()
+{
+    next_dispatcher->start();
+}
+
+void mi::KineticScrollDispatcher::stop()
+{
+    stop_fling();
+    next_dispatcher->stop();
+}
+
+void mi::KineticScrollDispatcher::handle_pointer_event(MirPointerEvent const* event)
+{
+    auto const iev = mir_pointer_event_input_event(event);
+    auto const device = mir_input_event_get_device_id(iev);
+    std::chrono::nanoseconds const time{mir_input_event_get_event_time(iev)};
+    auto const hscroll = mir_pointer_event_axis_value(event, mir_pointer_axis_hscroll);
+    auto const vscroll = mir_pointer_event_axis_value(event, mir_pointer_axis_vscroll);
+    bool const scrolled = hscroll != 0 || vscroll != 0;
+    bool const moved =
+        mir_pointer_event_action(event) != mir_pointer_action_motion ||
+        mir_pointer_event_axis_value(event, mir_pointer_axis_relative_x) != 0 ||
+        mir_pointer_event_axis_value(event, mir_pointer_axis_relative_y) != 0;
+
+    bool cancel_alarm{false};
+    optional_value<std::chrono::nanoseconds> start_alarm;
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+
+        if (fling)
+        {
+            fling.consume();
+            cancel_alarm = true;
+        }
+
+        if (scrolled)
+        {
+            if (!scrolling_device || scrolling_device.value() != device)
+            {
+                recent_scroll.clear();
+                scrolling_device = device;
+            }
+
+            recent_scroll.push_back({time, hscroll, vscroll});
+            while (time - recent_scroll.front().time > velocity_window)
+                recent_scroll.pop_front();
+        }
+        else if (!moved && scrolling_device && scrolling_device.value() == device && !recent_scroll.empty())
+        {
+            // A scroll event without any scroll in it is the end of continuous (finger) scrolling
+            if (time - recent_scroll.back().time <= max_pause_before_stop)
+            {
+                start_fling(lock, event);
+                if (fling)
+                    start_alarm = fling.value().interval;
+            }
+            recent_scroll.clear();
+        }
+        else
+        {
+            recent_scroll.clear();
+        }
+    }
+
+    if (start_alarm)
+        schedule_tick(start_alarm.value());
+    else if (cancel_alarm)
+        fling_alarm->cancel();
+}
+
+void mi::KineticScrollDispatcher::start_fling(std::lock_guard<std::mutex> const&, MirPointerEvent const* event)
+{
+    if (recent_scroll.size() < 2)
+        return;
+
+    auto const duration = std::chrono::duration<float>(recent_scroll.back().time - recent_scroll.front().time);
+    if (duration.count() <= 0)
+        return;
+
+    // The first sample's scroll happened before the window started
+    float hscroll{0}, vscroll{0};
+    for (auto sample = std::next(recent_scroll.begin()); sample != recent_scroll.end(); ++sample)
+    {
+        hscroll += sample->hscroll;
+        vscroll += sample->vscroll;
+    }
+
+    auto const hvelocity = hscroll / duration.count();
+    auto const vvelocity = vscroll / duration.count();
+    if (speed(hvelocity, vvelocity) < min_fling_velocity)
+        return;
+
+    auto const iev = mir_pointer_event_input_event(event);
+    fling = Fling{
+        mir_input_event_get_device_id(iev),
+        mir_pointer_event_modifiers(event),
+        mir_pointer_event_buttons(event),
+        mir_pointer_event_axis_value(event, mir_pointer_axis_x),
+        mir_pointer_event_axis_value(event, mir_pointer_axis_y),
+        hvelocity,
+        vvelocity,
+        until_next_tick()};
+}
+
+void mi::KineticScrollDispatcher::stop_fling()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        recent_scroll.clear();
+        if (!fling)
+            return;
+        fling.consume();
+    }
+
+    fling_alarm->cancel();
+}
+
+void mi::KineticScrollDispatcher::fling_tick()
+{
+    mir::EventUPtr event{nullptr, [](MirEvent*){}};
+    optional_value<std::chrono::nanoseconds> more;
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        if (!fling)
+            return;
+
+        auto& state = fling.value();
+        // Scroll by as much as the fling moved since the last tick
+        auto const dt = std::chrono::duration<float>(state.interval).count();
+
+        event = mev::make_event(
+            state.device,
+            std::chrono::steady_clock::now().time_since_epoch(),
+            std::vector<uint8_t>{},
+            state.modifiers,
+            mir_pointer_action_motion,
+            state.buttons,
+            state.x,
+            state.y,
+            state.hvelocity * dt,
+            state.vvelocity * dt,
+            0.0f,
+            0.0f);
+
+        auto const decay = std::exp(-dt / decay_time_constant_s);
+        state.hvelocity *= decay;
+        state.vvelocity *= decay;
+
+        if (speed(state.hvelocity, state.vvelocity) >= min_velocity)
+        {
+            state.interval = until_next_tick();
+            more = state.interval;
+        }
+        else
+        {
+            fling.consume();
+        }
+    }
+
+    next_dispatcher->dispatch(std::move(event));
+
+    if (more)
+        schedule_tick(more.value());
+}
+
+auto mi::KineticScrollDispatcher::until_next_tick() const -> std::chrono::nanoseconds
+{
+    auto const now = time::PosixTimestamp::now(CLOCK_MONOTONIC);
+    if (auto const next_frame = frame_timing->next_frame_after(now))
+        return next_frame.value() - now;
+
+    return fallback_tick;
+}
+
+void mi::KineticScrollDispatcher::schedule_tick(std::chrono::nanoseconds interval)
+{
+    fling_alarm->reschedule_for(clock->now() + std::chrono::duration_cast<time::Duration>(interval));
+}
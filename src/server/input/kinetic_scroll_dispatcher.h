@@ -0,0 +1,108 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_INPUT_KINETIC_SCROLL_DISPATCHER_H_
+#define MIR_INPUT_KINETIC_SCROLL_DISPATCHER_H_
+
+#include "mir/input/input_dispatcher.h"
+#include "mir/optional_value.h"
+
+#include "mir_toolkit/event.h"
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace mir
+{
+namespace time
+{
+class AlarmFactory;
+class Alarm;
+class Clock;
+}
+namespace graphics
+{
+class FrameTiming;
+}
+namespace input
+{
+/// Continues finger (touchpad) scrolling after the fingers lift, decelerating smoothly
+///
+/// Continuous scroll sources finish with an axis event that has no scroll in it (libinput's "axis stop").
+/// When that arrives while scrolling quickly, synthetic scroll events are sent once per tick until the
+/// velocity decays away. Any other pointer activity stops the fling. Wheel scrolling never sends a stop,
+/// so is unaffected.
+///
+/// Ticks fall on the refreshes of the fastest output, so each frame scrolls by the same amount as it would
+/// at the fling's speed. Until an output's refresh timing is known, a fixed tick is used instead.
+class KineticScrollDispatcher : public InputDispatcher
+{
+public:
+    KineticScrollDispatcher(
+        std::shared_ptr<InputDispatcher> const& next_dispatcher,
+        std::shared_ptr<time::AlarmFactory> const& factory,
+        std::shared_ptr<time::Clock> const& clock,
+        std::shared_ptr<graphics::FrameTiming> const& frame_timing,
+        std::chrono::milliseconds fallback_tick);
+
+    // InputDispatcher
+    bool dispatch(std::shared_ptr<MirEvent const> const& event) override;
+    void start() override;
+    void stop() override;
+
+private:
+    struct Sample
+    {
+        std::chrono::nanoseconds time;
+        float hscroll;
+        float vscroll;
+    };
+
+    struct Fling
+    {
+        MirInputDeviceId device;
+        MirInputEventModifiers modifiers;
+        MirPointerButtons buttons;
+        float x, y;
+        float hvelocity, vvelocity; ///< Scroll units per second
+        std::chrono::nanoseconds interval; ///< Until the next tick
+    };
+
+    std::shared_ptr<InputDispatcher> const next_dispatcher;
+    std::shared_ptr<time::Clock> const clock;
+    std::shared_ptr<graphics::FrameTiming> const frame_timing;
+    std::chrono::milliseconds const fallback_tick;
+
+    std::mutex mutex;
+    std::deque<Sample> recent_scroll; ///< From the device currently scrolling
+    optional_value<MirInputDeviceId> scrolling_device;
+    optional_value<Fling> fling;
+
+    std::unique_ptr<time::Alarm> const fling_alarm;
+
+    void handle_pointer_event(MirPointerEvent const* event);
+    void start_fling(std::lock_guard<std::mutex> const&, MirPointerEvent const* event);
+    void stop_fling();
+    void fling_tick();
+    auto until_next_tick() const -> std::chrono::nanoseconds;
+    void schedule_tick(std::chrono::nanoseconds interval);
+};
+}
+}
+
+#endif // MIR_INPUT_KINETIC_SCROLL_DISPATCHER_H_
@@ -39,6 +39,12 @@ class NullInputManager : public input::InputManager
     void continue_after_config() override
     {
     }
+    void suspend_non_wake_devices() override
+    {
+    }
+    void resume_non_wake_devices() override
+    {
+    }
 };
 
 }
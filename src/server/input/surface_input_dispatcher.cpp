@@ -207,6 +207,13 @@ void mi::SurfaceInputDispatcher::surface_removed(std::shared_ptr<ms::Surface> su
         if (compare_surfaces(state.gesture_owner, surface.get()))
             state.gesture_owner.reset();
     }
+
+    for (auto& kv : touchpad_gesture_state_by_id)
+    {
+        auto& state = kv.second;
+        if (compare_surfaces(state.gesture_owner, surface.get()))
+            state.gesture_owner.reset();
+    }
 }
 
 namespace
@@ -399,6 +406,8 @@ void mi::SurfaceInputDispatcher::device_reset(MirInputDeviceId reset_device_id,
     auto touch_it = touch_state_by_id.find(reset_device_id);
     if (touch_it != touch_state_by_id.end())
         touch_state_by_id.erase(touch_it);
+
+    touchpad_gesture_state_by_id.erase(reset_device_id);
 }
 
 bool mi::SurfaceInputDispatcher::dispatch_key(MirEvent const* kev)
@@ -632,6 +641,53 @@ bool mi::SurfaceInputDispatcher::dispatch_touch(MirInputDeviceId id, MirEvent co
     return false;
 }
 
+bool mi::SurfaceInputDispatcher::dispatch_touchpad_gesture(MirInputDeviceId id, MirEvent const* ev)
+{
+    std::lock_guard<std::mutex> lg(dispatcher_mutex);
+    auto const* input_ev = mir_event_get_input_event(ev);
+    auto const* gev = mir_input_event_get_touchpad_gesture_event(input_ev);
+
+    auto& gesture_owner = touchpad_gesture_state_by_id[id].gesture_owner;
+
+    // Like touches, a gesture stays with the surface it began on. That is the
+    // surface with the pointer focus: the one holding a pointer grab, otherwise
+    // the one under the cursor.
+    if (mir_touchpad_gesture_event_action(gev) == mir_touchpad_gesture_action_begin)
+    {
+        auto const pointer_state = pointer_state_by_id.find(id);
+
+        if (pointer_state != end(pointer_state_by_id) && pointer_state->second.gesture_owner)
+        {
+            gesture_owner = pointer_state->second.gesture_owner;
+        }
+        else if (last_pointer_event)
+        {
+            auto const* pev = mir_input_event_get_pointer_event(mir_event_get_input_event(last_pointer_event.get()));
+            geom::Point const cursor{
+                mir_pointer_event_axis_value(pev, mir_pointer_axis_x),
+                mir_pointer_event_axis_value(pev, mir_pointer_axis_y)};
+
+            gesture_owner = find_target_surface(cursor);
+        }
+        else
+        {
+            gesture_owner.reset();
+        }
+    }
+
+    if (gesture_owner)
+    {
+        deliver(gesture_owner, ev, drag_and_drop_handle);
+
+        if (mir_touchpad_gesture_event_action(gev) == mir_touchpad_gesture_action_end)
+            gesture_owner.reset();
+
+        return true;
+    }
+
+    return false;
+}
+
 bool mi::SurfaceInputDispatcher::dispatch(std::shared_ptr<MirEvent const> const& event)
 {
     if (mir_event_get_type(event.get()) != mir_event_type_input)
@@ -647,6 +703,8 @@ bool mi::SurfaceInputDispatcher::dispatch(std::shared_ptr<MirEvent const> const&
         return dispatch_touch(id, event.get());
     case mir_input_event_type_pointer:
         return dispatch_pointer(id, event);
+    case mir_input_event_type_touchpad_gesture:
+        return dispatch_touchpad_gesture(id, event.get());
     default:
         BOOST_THROW_EXCEPTION(std::logic_error("InputDispatcher got an input event of unknown type"));
     }
@@ -63,6 +63,7 @@ private:
     bool dispatch_key(MirEvent const* kev);
     bool dispatch_pointer(MirInputDeviceId id, std::shared_ptr<MirEvent const> const& ev);
     bool dispatch_touch(MirInputDeviceId id, MirEvent const* tev);
+    bool dispatch_touchpad_gesture(MirInputDeviceId id, MirEvent const* gev);
 
     void send_enter_exit_event(std::shared_ptr<input::Surface> const& surface,
         MirPointerEvent const* triggering_ev, MirPointerAction action);
@@ -91,6 +92,12 @@ private:
     };
     std::unordered_map<MirInputDeviceId, TouchInputState> touch_state_by_id;
     TouchInputState& ensure_touch_state(MirInputDeviceId id);
+
+    struct TouchpadGestureInputState
+    {
+        std::shared_ptr<input::Surface> gesture_owner;
+    };
+    std::unordered_map<MirInputDeviceId, TouchpadGestureInputState> touchpad_gesture_state_by_id;
     
     std::shared_ptr<input::Scene> const scene;
 
@@ -73,6 +73,11 @@ public:
         return {position, buffer_->size()};
     }
 
+    geom::Rectangle src_bounds() const override
+    {
+        return {{0, 0}, buffer_->size()};
+    }
+
     std::experimental::optional<geometry::Rectangle> clip_area() const override
     {
         return std::experimental::optional<geometry::Rectangle>();
@@ -25,6 +25,7 @@
 #include "null_report_factory.h"
 
 #include "mir/abnormal_exit.h"
+#include "mir/graphics/frame_timing_tracker.h"
 
 namespace mg = mir::graphics;
 namespace mf = mir::frontend;
@@ -93,7 +94,9 @@ auto mir::DefaultServerConfiguration::the_display_report() -> std::shared_ptr<mg
     return display_report(
         [this]()->std::shared_ptr<mg::DisplayReport>
         {
-            return report_factory(options::display_report_opt)->create_display_report();
+            return std::make_shared<mg::FrameTimingDisplayReport>(
+                report_factory(options::display_report_opt)->create_display_report(),
+                the_frame_timing_tracker());
         });
 }
 
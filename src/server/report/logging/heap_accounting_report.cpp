@@ -0,0 +1,84 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "heap_accounting_report.h"
+#include "mir/logging/logger.h"
+#include "mir/time/alarm.h"
+#include "mir/time/alarm_factory.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+namespace ml = mir::logging;
+namespace mrl = mir::report::logging;
+namespace mha = mir::heap_accounting;
+
+namespace
+{
+char const* const component = "heap";
+}
+
+mrl::HeapAccountingReport::HeapAccountingReport(
+    std::shared_ptr<ml::Logger> const& logger,
+    std::shared_ptr<time::AlarmFactory> const& alarm_factory,
+    std::chrono::seconds period)
+    : logger{logger},
+      alarm_factory{alarm_factory},
+      period{period},
+      alarm{alarm_factory->create_alarm([this] { report(); })}
+{
+    if (!mha::enabled())
+    {
+        logger->log(
+            ml::Severity::warning,
+            "Heap accounting is not enabled: preload libmirheapaccounting.so to count heap use",
+            component);
+        return;
+    }
+
+    for (auto i = 0u; i != subsystem_count; ++i)
+        last_usage[i] = mha::usage_of(static_cast<mha::Subsystem>(i));
+
+    alarm->reschedule_in(period);
+}
+
+mrl::HeapAccountingReport::~HeapAccountingReport() = default;
+
+void mrl::HeapAccountingReport::report()
+{
+    auto const seconds = period.count();
+
+    for (auto i = 0u; i != subsystem_count; ++i)
+    {
+        auto const subsystem = static_cast<mha::Subsystem>(i);
+        auto const usage = mha::usage_of(subsystem);
+        auto& last = last_usage[i];
+
+        char msg[192];
+        snprintf(msg, sizeof msg,
+                 "%s: %zu bytes in %zu blocks, allocating %" PRIu64 " bytes/s in %" PRIu64 " allocations/s",
+                 mha::name_of(subsystem),
+                 usage.bytes_in_use,
+                 usage.blocks_in_use,
+                 (usage.bytes_allocated - last.bytes_allocated) / seconds,
+                 (usage.allocations - last.allocations) / seconds);
+
+        logger->log(ml::Severity::informational, msg, component);
+        last = usage;
+    }
+
+    alarm->reschedule_in(period);
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_REPORT_LOGGING_HEAP_ACCOUNTING_REPORT_H_
+#define MIR_REPORT_LOGGING_HEAP_ACCOUNTING_REPORT_H_
+
+#include "mir/heap_accounting.h"
+
+#include <array>
+#include <chrono>
+#include <memory>
+
+namespace mir
+{
+namespace logging
+{
+class Logger;
+}
+namespace time
+{
+class Alarm;
+class AlarmFactory;
+}
+namespace report
+{
+namespace logging
+{
+/// Periodically logs the heap use of each subsystem (see mir/heap_accounting.h)
+class HeapAccountingReport
+{
+public:
+    HeapAccountingReport(
+        std::shared_ptr<mir::logging::Logger> const& logger,
+        std::shared_ptr<time::AlarmFactory> const& alarm_factory,
+        std::chrono::seconds period);
+    ~HeapAccountingReport();
+
+private:
+    void report();
+
+    std::shared_ptr<mir::logging::Logger> const logger;
+    std::shared_ptr<time::AlarmFactory> const alarm_factory;
+    std::chrono::seconds const period;
+
+    static auto constexpr subsystem_count = static_cast<size_t>(heap_accounting::Subsystem::count);
+    std::array<heap_accounting::Usage, subsystem_count> last_usage{};
+
+    std::unique_ptr<time::Alarm> const alarm;
+};
+}
+}
+}
+
+#endif // MIR_REPORT_LOGGING_HEAP_ACCOUNTING_REPORT_H_
@@ -21,6 +21,7 @@
 #include "mir/default_server_configuration.h"
 #include "mir/options/option.h"
 #include "logging/display_configuration_report.h"
+#include "logging/heap_accounting_report.h"
 #include "mir/observer_multiplexer.h"
 #include "mir/options/configuration.h"
 #include "mir/abnormal_exit.h"
@@ -122,6 +123,19 @@ std::shared_ptr<mir::frontend::SessionMediatorObserver> create_session_mediator_
         std::throw_with_nested(mir::AbnormalExit("Failed to create report for "s + mo::session_mediator_report_opt));
     }
 }
+
+std::unique_ptr<mr::logging::HeapAccountingReport> create_heap_accounting_report(
+    mir::DefaultServerConfiguration& config,
+    int period)
+{
+    if (period <= 0)
+        return nullptr;
+
+    return std::make_unique<mr::logging::HeapAccountingReport>(
+        config.the_logger(),
+        config.the_main_loop(),
+        std::chrono::seconds{period});
+}
 }
 
 mir::report::Reports::Reports(
@@ -135,9 +149,12 @@ mir::report::Reports::Reports(
           create_session_mediator_reports(
               server,
               options.get<std::string>(mo::session_mediator_report_opt))},
-      session_mediator_observer_multiplexer{server.the_session_mediator_observer_registrar()}
+      session_mediator_observer_multiplexer{server.the_session_mediator_observer_registrar()},
+      heap_accounting_report{create_heap_accounting_report(server, options.get<int>(mo::heap_accounting_period_opt))}
 {
     display_configuration_multiplexer->register_interest(display_configuration_report);
     seat_observer_multiplexer->register_interest(seat_report);
     session_mediator_observer_multiplexer->register_interest(session_mediator_report);
 }
+
+mir::report::Reports::~Reports() = default;
@@ -51,6 +51,7 @@ namespace report
 namespace logging
 {
 class DisplayConfigurationReport;
+class HeapAccountingReport;
 }
 
 class ReportFactory;
@@ -59,6 +60,7 @@ class Reports
 {
 public:
     Reports(DefaultServerConfiguration& server, options::Option const& options);
+    ~Reports();
 
 private:
     std::shared_ptr<logging::DisplayConfigurationReport> const display_configuration_report;
@@ -68,6 +70,7 @@ private:
     std::shared_ptr<frontend::SessionMediatorObserver> const session_mediator_report;
     std::shared_ptr<ObserverRegistrar<frontend::SessionMediatorObserver>> const
         session_mediator_observer_multiplexer;
+    std::unique_ptr<logging::HeapAccountingReport> const heap_accounting_report;
 };
 }
 }
@@ -0,0 +1,203 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "basic_idle_hub.h"
+
+#include "mir/time/alarm.h"
+#include "mir/time/alarm_factory.h"
+#include "mir/time/clock.h"
+
+#include <algorithm>
+
+namespace ms = mir::scene;
+
+class ms::BasicIdleHub::InhibitingWakeLock : public WakeLock
+{
+public:
+    InhibitingWakeLock(std::weak_ptr<BasicIdleHub> const& hub)
+        : hub{hub}
+    {
+    }
+
+    ~InhibitingWakeLock()
+    {
+        if (auto const live_hub = hub.lock())
+        {
+            live_hub->release_wake_lock();
+        }
+    }
+
+private:
+    std::weak_ptr<BasicIdleHub> const hub;
+};
+
+ms::BasicIdleHub::BasicIdleHub(std::shared_ptr<time::Clock> const& clock, time::AlarmFactory& alarm_factory)
+    : clock{clock},
+      last_activity{clock->now()},
+      alarm{alarm_factory.create_alarm([this]{ alarm_fired(); })}
+{
+}
+
+ms::BasicIdleHub::~BasicIdleHub() = default;
+
+void ms::BasicIdleHub::poke()
+{
+    std::vector<std::shared_ptr<IdleStateObserver>> woken;
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        last_activity = clock->now();
+
+        for (auto& interest : interests)
+        {
+            if (interest.idle)
+            {
+                interest.idle = false;
+                if (auto const observer = interest.observer.lock())
+                {
+                    woken.push_back(observer);
+                }
+            }
+        }
+
+        // There's no need to reschedule on every input event: the alarm catches up when it fires
+        if (!woken.empty())
+        {
+            schedule_alarm(lock);
+        }
+    }
+
+    for (auto const& observer : woken)
+    {
+        observer->active();
+    }
+}
+
+void ms::BasicIdleHub::register_interest(std::weak_ptr<IdleStateObserver> const& observer, time::Duration timeout)
+{
+    std::vector<std::shared_ptr<IdleStateObserver>> idled;
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        interests.push_back(Interest{observer, timeout, false});
+        idled = newly_idle(lock);
+        schedule_alarm(lock);
+    }
+
+    for (auto const& observer : idled)
+    {
+        observer->idle();
+    }
+}
+
+void ms::BasicIdleHub::unregister_interest(IdleStateObserver const& observer)
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    interests.erase(
+        std::remove_if(
+            begin(interests),
+            end(interests),
+            [&observer](Interest const& interest)
+            {
+                auto const live = interest.observer.lock();
+                return !live || live.get() == &observer;
+            }),
+        end(interests));
+}
+
+auto ms::BasicIdleHub::inhibit_idle() -> std::shared_ptr<WakeLock>
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    ++wake_locks;
+    return std::make_shared<InhibitingWakeLock>(shared_from_this());
+}
+
+void ms::BasicIdleHub::release_wake_lock()
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    if (--wake_locks == 0)
+    {
+        // The timeouts run from when the last inhibitor went away
+        last_activity = clock->now();
+        schedule_alarm(lock);
+    }
+}
+
+void ms::BasicIdleHub::alarm_fired()
+{
+    std::vector<std::shared_ptr<IdleStateObserver>> idled;
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        idled = newly_idle(lock);
+        schedule_alarm(lock);
+    }
+
+    for (auto const& observer : idled)
+    {
+        observer->idle();
+    }
+}
+
+auto ms::BasicIdleHub::newly_idle(std::lock_guard<std::mutex> const&) -> std::vector<std::shared_ptr<IdleStateObserver>>
+{
+    std::vector<std::shared_ptr<IdleStateObserver>> result;
+
+    if (wake_locks > 0)
+        return result;
+
+    auto const inactive_for = clock->now() - last_activity;
+
+    for (auto& interest : interests)
+    {
+        if (!interest.idle && inactive_for >= interest.timeout)
+        {
+            interest.idle = true;
+            if (auto const observer = interest.observer.lock())
+            {
+                result.push_back(observer);
+            }
+        }
+    }
+
+    return result;
+}
+
+void ms::BasicIdleHub::schedule_alarm(std::lock_guard<std::mutex> const&)
+{
+    // A pending alarm is left to fire even when it is no longer needed: cancel() waits for an
+    // in-flight callback, which would deadlock against the callback waiting for our mutex.
+    if (wake_locks > 0)
+        return;
+
+    bool pending{false};
+    time::Timestamp next;
+
+    for (auto const& interest : interests)
+    {
+        if (!interest.idle && !interest.observer.expired())
+        {
+            auto const due = last_activity + interest.timeout;
+            if (!pending || due < next)
+            {
+                next = due;
+                pending = true;
+            }
+        }
+    }
+
+    if (pending)
+    {
+        alarm->reschedule_for(next);
+    }
+}
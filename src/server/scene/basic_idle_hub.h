@@ -0,0 +1,78 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_SCENE_BASIC_IDLE_HUB_H_
+#define MIR_SCENE_BASIC_IDLE_HUB_H_
+
+#include "mir/scene/idle_hub.h"
+
+#include <mutex>
+#include <vector>
+
+namespace mir
+{
+namespace time
+{
+class Alarm;
+class AlarmFactory;
+class Clock;
+}
+
+namespace scene
+{
+class BasicIdleHub : public IdleHub, public std::enable_shared_from_this<BasicIdleHub>
+{
+public:
+    BasicIdleHub(std::shared_ptr<time::Clock> const& clock, time::AlarmFactory& alarm_factory);
+    ~BasicIdleHub() override;
+
+    void poke() override;
+    void register_interest(std::weak_ptr<IdleStateObserver> const& observer, time::Duration timeout) override;
+    void unregister_interest(IdleStateObserver const& observer) override;
+    auto inhibit_idle() -> std::shared_ptr<WakeLock> override;
+
+private:
+    struct Interest
+    {
+        std::weak_ptr<IdleStateObserver> observer;
+        time::Duration timeout;
+        bool idle;
+    };
+
+    class InhibitingWakeLock;
+
+    void alarm_fired();
+    void release_wake_lock();
+
+    /// Marks (and returns) the interests whose timeout has expired. Requires mutex is held.
+    auto newly_idle(std::lock_guard<std::mutex> const&) -> std::vector<std::shared_ptr<IdleStateObserver>>;
+
+    /// Schedules the alarm for the next timeout to expire. Requires mutex is held.
+    void schedule_alarm(std::lock_guard<std::mutex> const&);
+
+    std::shared_ptr<time::Clock> const clock;
+
+    std::mutex mutex;
+    std::vector<Interest> interests;
+    time::Timestamp last_activity;
+    int wake_locks{0};
+
+    std::unique_ptr<time::Alarm> const alarm;
+};
+}
+}
+
+#endif // MIR_SCENE_BASIC_IDLE_HUB_H_
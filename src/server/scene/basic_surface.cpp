@@ -30,6 +30,7 @@
 
 #include "mir/scene/scene_report.h"
 #include "mir/scene/null_surface_observer.h"
+#include "mir/time/alarm_factory.h"
 
 #include <boost/throw_exception.hpp>
 
@@ -47,6 +48,12 @@ namespace mf = mir::frontend;
 namespace geom = mir::geometry;
 namespace mrs = mir::renderer::software;
 
+namespace
+{
+/// About a frame at 60Hz: a drag's notifications keep pace with the display, not with the mouse
+std::chrono::milliseconds const move_notification_interval{16};
+}
+
 void ms::SurfaceObservers::attrib_changed(Surface const* surf, MirWindowAttrib attrib, int value)
 {
     for_each([&](std::shared_ptr<SurfaceObserver> const& observer)
@@ -309,6 +316,21 @@ ms::BasicSurface::BasicSurface(
 {
 }
 
+ms::BasicSurface::BasicSurface(
+    std::shared_ptr<Session> const& session,
+    std::string const& name,
+    geometry::Rectangle rect,
+    std::weak_ptr<Surface> const& parent,
+    MirPointerConfinementState state,
+    std::list<StreamInfo> const& layers,
+    std::shared_ptr<mg::CursorImage> const& cursor_image,
+    std::shared_ptr<SceneReport> const& report,
+    time::AlarmFactory& alarm_factory) :
+    BasicSurface(session, name, rect, parent, state, layers, cursor_image, report)
+{
+    move_alarm = alarm_factory.create_alarm([this] { deliver_coalesced_move(); });
+}
+
 ms::BasicSurface::~BasicSurface() noexcept
 {
     for(auto& layer : layers)
@@ -326,8 +348,45 @@ void ms::BasicSurface::move_to(geometry::Point const& top_left)
 {
     {
         std::lock_guard<std::mutex> lock(guard);
+        if (surface_rect.top_left == top_left)
+            return;
         surface_rect.top_left = top_left;
+
+        if (move_alarm)
+        {
+            // move_alarm is pending, and will tell observers where the surface ends up
+            if (move_notified)
+            {
+                move_deferred = true;
+                return;
+            }
+            move_notified = true;
+        }
+    }
+
+    // The alarm may hold its own lock while calling back into deliver_coalesced_move(), so is scheduled without ours
+    if (move_alarm)
+        move_alarm->reschedule_in(move_notification_interval);
+    observers->moved_to(this, top_left);
+}
+
+void ms::BasicSurface::deliver_coalesced_move()
+{
+    geom::Point top_left;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        if (!move_deferred)
+        {
+            move_notified = false;
+            return;
+        }
+
+        // move_notified stays set, as later moves are coalesced into the next interval
+        move_deferred = false;
+        top_left = surface_rect.top_left;
     }
+
+    move_alarm->reschedule_in(move_notification_interval);
     observers->moved_to(this, top_left);
 }
 
@@ -818,6 +877,7 @@ public:
         std::shared_ptr<mc::BufferStream> const& stream,
         void const* compositor_id,
         geom::Rectangle const& position,
+        geom::Rectangle const& src_bounds,
         std::experimental::optional<geom::Rectangle> const& clip_area,
         glm::mat4 const& transform,
         float alpha,
@@ -826,6 +886,7 @@ public:
       compositor_id{compositor_id},
       alpha_{alpha},
       screen_position_(position),
+      src_bounds_(src_bounds),
       clip_area_(clip_area),
       transformation_(transform),
       id_(id)
@@ -851,6 +912,9 @@ public:
     geom::Rectangle screen_position() const override
     { return screen_position_; }
 
+    geom::Rectangle src_bounds() const override
+    { return src_bounds_; }
+
     std::experimental::optional<geom::Rectangle> clip_area() const override
     { return clip_area_; }
 
@@ -871,6 +935,7 @@ private:
     void const*const compositor_id;
     float const alpha_;
     geom::Rectangle const screen_position_;
+    geom::Rectangle const src_bounds_;
     std::experimental::optional<geom::Rectangle> const clip_area_;
     glm::mat4 const transformation_;
     mg::Renderable::ID const id_;
@@ -957,6 +1022,7 @@ mg::RenderableList ms::BasicSurface::generate_renderables(mc::CompositorID id) c
             list.emplace_back(std::make_shared<SurfaceSnapshot>(
                 info.stream, id,
                 geom::Rectangle{content_top_left_ + info.displacement, std::move(size)},
+                info.stream->src_bounds(),
                 clip_area_,
                 transformation_matrix, surface_alpha, info.stream.get()));
         }
@@ -976,6 +1042,18 @@ MirPointerConfinementState ms::BasicSurface::confine_pointer_state() const
     return confine_pointer_state_;
 }
 
+void ms::BasicSurface::set_confinement_region(std::vector<geom::Rectangle> const& region)
+{
+    std::lock_guard<std::mutex> lock(guard);
+    confinement_region_ = region;
+}
+
+auto ms::BasicSurface::confinement_region() const -> std::vector<geom::Rectangle>
+{
+    std::lock_guard<std::mutex> lock(guard);
+    return confinement_region_;
+}
+
 void ms::BasicSurface::placed_relative(geometry::Rectangle const& placement)
 {
     observers->placed_relative(this, placement);
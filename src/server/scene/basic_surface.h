@@ -50,6 +50,11 @@ namespace input
 {
 class Surface;
 }
+namespace time
+{
+class Alarm;
+class AlarmFactory;
+}
 namespace scene
 {
 class SceneReport;
@@ -77,6 +82,19 @@ public:
         std::shared_ptr<graphics::CursorImage> const& cursor_image,
         std::shared_ptr<SceneReport> const& report);
 
+    /// Moves made faster than move_notification_interval (e.g. during a drag) are coalesced: observers
+    /// hear of the first at once and of the latest when the interval is up
+    BasicSurface(
+        std::shared_ptr<Session> const& session,
+        std::string const& name,
+        geometry::Rectangle rect,
+        std::weak_ptr<Surface> const& parent,
+        MirPointerConfinementState state,
+        std::list<scene::StreamInfo> const& streams,
+        std::shared_ptr<graphics::CursorImage> const& cursor_image,
+        std::shared_ptr<SceneReport> const& report,
+        time::AlarmFactory& alarm_factory);
+
     ~BasicSurface() noexcept;
 
     std::string name() const override;
@@ -144,6 +162,9 @@ public:
 
     void set_confine_pointer_state(MirPointerConfinementState state) override;
     MirPointerConfinementState confine_pointer_state() const override;
+    void set_confinement_region(std::vector<geometry::Rectangle> const& region) override;
+    auto confinement_region() const -> std::vector<geometry::Rectangle> override;
+
     void placed_relative(geometry::Rectangle const& placement) override;
     void start_drag_and_drop(std::vector<uint8_t> const& handle) override;
 
@@ -185,6 +206,7 @@ private:
     MirOrientationMode set_preferred_orientation(MirOrientationMode mode);
     auto content_size(ProofOfMutexLock const&) const -> geometry::Size;
     auto content_top_left(ProofOfMutexLock const&) const -> geometry::Point;
+    void deliver_coalesced_move();
 
     std::shared_ptr<SurfaceObservers> observers = std::make_shared<SurfaceObservers>();
     std::mutex mutable guard;
@@ -210,6 +232,11 @@ private:
     MirWindowVisibility visibility_ = mir_window_visibility_occluded;
     MirOrientationMode pref_orientation_mode = mir_orientation_mode_any;
     MirPointerConfinementState confine_pointer_state_ = mir_pointer_unconfined;
+    std::vector<geometry::Rectangle> confinement_region_;
+    /// Set once observers have been told of a move, until move_alarm finds no later one to tell them of
+    bool move_notified{false};
+    /// Set when a move has been held back for move_alarm
+    bool move_deferred{false};
 
     /// \deprecated can be removed along with mirclient
     std::unique_ptr<CursorStreamImageAdapter> const cursor_stream_adapter;
@@ -226,6 +253,9 @@ private:
         geometry::DeltaY bottom;
         geometry::DeltaX right;
     } margins;
+
+    /// Null if moves are not coalesced. Last, so that it can't fire while the rest is destroyed.
+    std::unique_ptr<time::Alarm> move_alarm;
 };
 
 }
@@ -25,6 +25,7 @@
 #include "mir/scene/session_event_handler_register.h"
 #include "mir/scene/session_event_sink.h"
 #include "mir/graphics/display.h"
+#include "mir/graphics/incremental_display.h"
 #include "mir/compositor/compositor.h"
 #include "mir/geometry/rectangles.h"
 #include "mir/graphics/display_configuration_policy.h"
@@ -182,6 +183,7 @@ ms::MediatingDisplayChanger::MediatingDisplayChanger(
       observer{observer},
       base_configuration_{display->configuration()},
       base_configuration_applied{true},
+      applied_configuration{base_configuration_->clone()},
       alarm_factory{alarm_factory},
       session_observer{std::make_unique<SessionObserver>(this)}
 {
@@ -474,17 +476,16 @@ void ms::MediatingDisplayChanger::apply_config(
         if (configuration_has_new_outputs_enabled(*display->configuration(), *conf) ||
             !display->apply_if_configuration_preserves_display_buffers(*conf))
         {
-            ApplyNowAndRevertOnScopeExit comp{
-                [this] { compositor->stop(); },
-                [this] { compositor->start(); }};
-            display->configure(*conf);
+            reconfigure_display(*conf);
         }
 
+        applied_configuration = conf->clone();
         observer->configuration_applied(conf);
         base_configuration_applied = false;
     }
     catch (std::exception const& e)
     {
+        applied_configuration.reset();
         try
         {
             /*
@@ -494,10 +495,7 @@ void ms::MediatingDisplayChanger::apply_config(
              * was one that has been successfully display->configure()d, or it was the
              * configuration that existed at Mir startup. Which presumably worked!
              */
-            ApplyNowAndRevertOnScopeExit comp{
-                [this] { compositor->stop(); },
-                [this] { compositor->start(); }};
-            display->configure(*existing_configuration);
+            reconfigure_display(*existing_configuration);
         }
         catch (std::exception const& e)
         {
@@ -509,6 +507,30 @@ void ms::MediatingDisplayChanger::apply_config(
     }
 }
 
+void ms::MediatingDisplayChanger::reconfigure_display(mg::DisplayConfiguration const& conf)
+{
+    if (auto const incremental = dynamic_cast<mg::IncrementalDisplay*>(display->native_display()))
+    {
+        // Outputs whose sync groups survive go on compositing throughout
+        incremental->configure_incrementally(
+            conf,
+            [this](mg::DisplaySyncGroup& group) { compositor->remove_display_sync_group(group); },
+            [this](mg::DisplaySyncGroup& group) { compositor->add_display_sync_group(group); });
+    }
+    else
+    {
+        ApplyNowAndRevertOnScopeExit comp{
+            [this] { compositor->stop(); },
+            [this] { compositor->start(); }};
+        display->configure(conf);
+    }
+}
+
+auto ms::MediatingDisplayChanger::is_current_display_config(mg::DisplayConfiguration const& conf) const -> bool
+{
+    return applied_configuration && *applied_configuration == conf;
+}
+
 void ms::MediatingDisplayChanger::apply_base_config()
 {
     apply_config(base_configuration_);
@@ -540,6 +562,16 @@ void ms::MediatingDisplayChanger::focus_change_handler(
     auto const it = config_map.find(session);
     if (it != config_map.end())
     {
+        /*
+         * Sessions often share a configuration (or focus returns to the session whose
+         * configuration is showing), so don't disturb the display when nothing changes.
+         */
+        if (is_current_display_config(*it->second))
+        {
+            base_configuration_applied = false;
+            return;
+        }
+
         try
         {
             apply_config(it->second);
@@ -100,6 +100,9 @@ private:
 
     void apply_config(std::shared_ptr<graphics::DisplayConfiguration> const& conf);
     void apply_base_config();
+    /// Replaces the display buffers, disturbing only the outputs that change if the display allows it
+    void reconfigure_display(graphics::DisplayConfiguration const& conf);
+    auto is_current_display_config(graphics::DisplayConfiguration const& conf) const -> bool;
     void send_config_to_all_sessions(
         std::shared_ptr<graphics::DisplayConfiguration> const& conf);
 
@@ -117,6 +120,8 @@ private:
     std::weak_ptr<scene::Session> focused_session;
     std::shared_ptr<graphics::DisplayConfiguration> base_configuration_;
     bool base_configuration_applied;
+    /// What apply_config() last applied (not every display updates its configuration()), or null if unknown
+    std::shared_ptr<graphics::DisplayConfiguration const> applied_configuration;
     std::shared_ptr<time::AlarmFactory> const alarm_factory;
     std::unique_ptr<time::Alarm> preview_configuration_timeout;
     std::weak_ptr<scene::Session> currently_previewing_session;
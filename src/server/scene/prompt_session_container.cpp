@@ -20,71 +20,130 @@
 #include "mir/scene/session.h"
 
 #include <boost/throw_exception.hpp>
-#include <atomic>
+#include <algorithm>
+#include <mutex>
 
 namespace ms = mir::scene;
 namespace mf = mir::frontend;
 
 namespace
 {
-std::atomic<unsigned> insertion_order{0};
+bool same_owner(std::weak_ptr<ms::Session> const& lhs, std::weak_ptr<ms::Session> const& rhs)
+{
+    return !lhs.owner_before(rhs) && !rhs.owner_before(lhs);
+}
+
+/// Memberships are ordered by participant type, then prompt session
+template<typename Membership>
+auto memberships_matching(
+    std::vector<Membership>& memberships,
+    ms::PromptSessionContainer::ParticipantType participant_type,
+    ms::PromptSession* prompt_session)
+{
+    struct Key
+    {
+        ms::PromptSessionContainer::ParticipantType participant_type;
+        ms::PromptSession* prompt_session;
+    };
+
+    struct Compare
+    {
+        bool operator()(Membership const& lhs, Key const& rhs) const
+        {
+            return lhs.participant_type < rhs.participant_type ||
+                (lhs.participant_type == rhs.participant_type &&
+                 std::less<ms::PromptSession*>{}(lhs.prompt_session, rhs.prompt_session));
+        }
+
+        bool operator()(Key const& lhs, Membership const& rhs) const
+        {
+            return lhs.participant_type < rhs.participant_type ||
+                (lhs.participant_type == rhs.participant_type &&
+                 std::less<ms::PromptSession*>{}(lhs.prompt_session, rhs.prompt_session));
+        }
+    };
+
+    return std::equal_range(memberships.begin(), memberships.end(), Key{participant_type, prompt_session}, Compare{});
+}
 }
 
 ms::PromptSessionContainer::PromptSessionContainer()
-    : prompt_session_index(participant_map)
-    , participant_index(get<1>(participant_map))
 {
 }
 
 void ms::PromptSessionContainer::insert_prompt_session(std::shared_ptr<PromptSession> const& prompt_session)
 {
-    std::unique_lock<std::mutex> lk(mutex);
-    prompt_sessions[prompt_session.get()] = prompt_session;
+    std::lock_guard<std::shared_timed_mutex> lk(mutex);
+    prompt_sessions[prompt_session.get()].prompt_session = prompt_session;
 }
 
 void ms::PromptSessionContainer::remove_prompt_session(std::shared_ptr<PromptSession> const& prompt_session)
 {
-    std::unique_lock<std::mutex> lk(mutex);
+    std::lock_guard<std::shared_timed_mutex> lk(mutex);
 
-    {
-        participant_by_prompt_session::iterator it, end;
-        boost::tie(it, end) = prompt_session_index.equal_range(prompt_session.get());
-        prompt_session_index.erase(it, end);
-    }
+    auto const entry = prompt_sessions.find(prompt_session.get());
+    if (entry == prompt_sessions.end())
+        return;
 
-    prompt_sessions.erase(prompt_session.get());
+    for (auto const& participant : entry->second.participants)
+        remove_membership(participant.key, participant.session, participant.participant_type, prompt_session.get());
+
+    prompt_sessions.erase(entry);
 }
 
 bool ms::PromptSessionContainer::insert_participant(PromptSession* prompt_session, std::weak_ptr<Session> const& session, ParticipantType participant_type)
 {
-    std::unique_lock<std::mutex> lk(mutex);
+    std::lock_guard<std::shared_timed_mutex> lk(mutex);
 
     // the prompt session must have first been added by insert_prompt_session.
-    if (prompt_sessions.find(prompt_session) == prompt_sessions.end())
+    auto const entry = prompt_sessions.find(prompt_session);
+    if (entry == prompt_sessions.end())
         BOOST_THROW_EXCEPTION(std::runtime_error("Prompt Session does not exist"));
 
     if (auto locked_session = session.lock())
     {
-        participant_by_prompt_session::iterator it;
-        bool valid = false;
+        auto& session_memberships = memberships[locked_session.get()];
+
+        auto const matching = memberships_matching(session_memberships, participant_type, prompt_session);
+
+        for (auto i = matching.first; i != matching.second; ++i)
+        {
+            if (same_owner(i->session, locked_session))
+                return false;
+        }
 
-        Participant participant{prompt_session, locked_session, participant_type, insertion_order++};
-        boost::tie(it,valid) = participant_map.insert(participant);
+        session_memberships.insert(matching.second, Membership{prompt_session, locked_session, participant_type});
+        entry->second.participants.push_back(Participant{locked_session.get(), locked_session, participant_type});
 
-        return valid;
+        return true;
     }
     return false;
 }
 
 bool ms::PromptSessionContainer::remove_participant(PromptSession* prompt_session, std::weak_ptr<Session> const& session, ParticipantType participant_type)
 {
-    std::unique_lock<std::mutex> lk(mutex);
+    std::lock_guard<std::shared_timed_mutex> lk(mutex);
 
-    participant_by_session::iterator it = participant_index.find(boost::make_tuple(session, participant_type, prompt_session));
-    if (it == participant_index.end())
+    auto const entry = prompt_sessions.find(prompt_session);
+    if (entry == prompt_sessions.end())
         return false;
 
-    participant_index.erase(it);
+    // A prompt session has only a handful of participants, and scanning them (rather than looking
+    // the session up) still finds sessions that have already gone away.
+    auto& participants = entry->second.participants;
+    auto const participant = std::find_if(
+        participants.begin(),
+        participants.end(),
+        [&](Participant const& participant)
+        {
+            return participant.participant_type == participant_type && same_owner(participant.session, session);
+        });
+
+    if (participant == participants.end())
+        return false;
+
+    remove_membership(participant->key, participant->session, participant_type, prompt_session);
+    participants.erase(participant);
     return true;
 }
 
@@ -92,16 +151,14 @@ void ms::PromptSessionContainer::for_each_participant_in_prompt_session(
     PromptSession* prompt_session,
     std::function<void(std::weak_ptr<Session> const&, ms::PromptSessionContainer::ParticipantType participant_type)> f) const
 {
-    std::unique_lock<std::mutex> lk(mutex);
+    std::shared_lock<std::shared_timed_mutex> lk(mutex);
 
-    participant_by_prompt_session::iterator it,end;
-    boost::tie(it,end) = prompt_session_index.equal_range(prompt_session);
+    auto const entry = prompt_sessions.find(prompt_session);
+    if (entry == prompt_sessions.end())
+        return;
 
-    for (; it != end; ++it)
-    {
-        Participant const& participant = *it;
+    for (auto const& participant : entry->second.participants)
         f(participant.session, participant.participant_type);
-    }
 }
 
 void ms::PromptSessionContainer::for_each_prompt_session_with_participant(
@@ -109,18 +166,20 @@ void ms::PromptSessionContainer::for_each_prompt_session_with_participant(
     ParticipantType participant_type,
     std::function<void(std::shared_ptr<PromptSession> const&)> f) const
 {
-    std::unique_lock<std::mutex> lk(mutex);
+    std::shared_lock<std::shared_timed_mutex> lk(mutex);
 
-    participant_by_session::iterator it,end;
-    boost::tie(it,end) = participant_index.equal_range(boost::make_tuple(participant, participant_type));
+    auto const session_memberships = memberships_of(participant);
+    if (!session_memberships)
+        return;
 
-    for (; it != end; ++it)
+    for (auto const& membership : *session_memberships)
     {
-        Participant const& participant = *it;
+        if (membership.participant_type != participant_type || !same_owner(membership.session, participant))
+            continue;
 
-        auto tsit = prompt_sessions.find(participant.prompt_session);
+        auto tsit = prompt_sessions.find(membership.prompt_session);
         if (tsit != prompt_sessions.end())
-            f(tsit->second);
+            f(tsit->second.prompt_session);
     }
 }
 
@@ -128,16 +187,54 @@ void ms::PromptSessionContainer::for_each_prompt_session_with_participant(
     std::weak_ptr<Session> const& participant,
     std::function<void(std::shared_ptr<PromptSession> const&, ParticipantType)> f) const
 {
-    std::unique_lock<std::mutex> lk(mutex);
-    participant_by_session::iterator it,end;
-    boost::tie(it,end) = participant_index.equal_range(participant);
+    std::shared_lock<std::shared_timed_mutex> lk(mutex);
 
-    for (; it != end; ++it)
+    auto const session_memberships = memberships_of(participant);
+    if (!session_memberships)
+        return;
+
+    for (auto const& membership : *session_memberships)
     {
-        Participant const& participant = *it;
+        if (!same_owner(membership.session, participant))
+            continue;
 
-        auto tsit = prompt_sessions.find(participant.prompt_session);
+        auto tsit = prompt_sessions.find(membership.prompt_session);
         if (tsit != prompt_sessions.end())
-            f(tsit->second, participant.participant_type);
+            f(tsit->second.prompt_session, membership.participant_type);
     }
 }
+
+void ms::PromptSessionContainer::remove_membership(
+    Session* key,
+    std::weak_ptr<Session> const& session,
+    ParticipantType participant_type,
+    PromptSession* prompt_session)
+{
+    auto const session_memberships = memberships.find(key);
+    if (session_memberships == memberships.end())
+        return;
+
+    auto& entries = session_memberships->second;
+    auto const matching = memberships_matching(entries, participant_type, prompt_session);
+    entries.erase(
+        std::remove_if(
+            matching.first,
+            matching.second,
+            [&](Membership const& membership) { return same_owner(membership.session, session); }),
+        matching.second);
+
+    if (entries.empty())
+        memberships.erase(session_memberships);
+}
+
+auto ms::PromptSessionContainer::memberships_of(std::weak_ptr<Session> const& session) const
+    -> std::vector<Membership> const*
+{
+    // Sessions that have gone can no longer be looked up by address
+    auto const locked_session = session.lock();
+    if (!locked_session)
+        return nullptr;
+
+    auto const session_memberships = memberships.find(locked_session.get());
+    return session_memberships != memberships.end() ? &session_memberships->second : nullptr;
+}
@@ -20,20 +20,14 @@
 #define MIR_SCENE_PROMPT_SESSION_CONTAINER_H_
 
 #include <sys/types.h>
-#include <mutex>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
 #include <unordered_map>
-
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/member.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index/composite_key.hpp>
-#include <boost/multi_index/mem_fun.hpp>
+#include <vector>
 
 namespace mir
 {
-using boost::multi_index_container;
-using namespace boost::multi_index;
-
 namespace scene
 {
 class Session;
@@ -63,56 +57,45 @@ public:
     void for_each_prompt_session_with_participant(std::weak_ptr<Session> const& participant, std::function<void(std::shared_ptr<PromptSession> const&, ParticipantType)> f) const;
 
 private:
-    std::mutex mutable mutex;
-
-    std::unordered_map<PromptSession*, std::shared_ptr<PromptSession>> prompt_sessions;
+    /// Lookups far outnumber changes (they happen on every session lifecycle and focus change), so
+    /// readers share the lock
+    std::shared_timed_mutex mutable mutex;
 
     struct Participant
+    {
+        Session* key;                   ///< The session when it was inserted; only valid alongside session
+        std::weak_ptr<Session> session;
+        ParticipantType participant_type;
+    };
+
+    struct Membership
     {
         PromptSession* prompt_session;
         std::weak_ptr<Session> session;
         ParticipantType participant_type;
-        uint insert_order;
+    };
+
+    struct PromptSessionEntry
+    {
+        std::shared_ptr<PromptSession> prompt_session;
+        std::vector<Participant> participants;  ///< In insertion order
     };
 
     /**
-     * A multi map for associating PromptSessions <-> Sessions.
-     * indexed by insertion order for determining the Sessions participating in a PromptSession
-     * and indexed for determining the Prompt Sessions in which a Session is participating.
+     * PromptSessions <-> Sessions are associated through a pair of hash maps.
+     * Each PromptSession holds its participants in insertion order, and each Session holds the
+     * PromptSessions it participates in, ordered by participant type.
      * A Session can be associated a number of times with a single PromptSession, providing it has a different type
      * eg A Session can be both a helper and a provider for a PromptSession.
+     *
+     * Sessions are keyed by address, which can be reused once a session has gone, so matches are
+     * confirmed against the weak_ptr held with them.
      */
-    typedef multi_index_container<
-        Participant,
-        indexed_by<
-            ordered_non_unique<
-                composite_key<
-                    Participant,
-                    member<Participant, PromptSession*, &Participant::prompt_session>,
-                    member<Participant, uint, &Participant::insert_order>
-                >
-            >,
-            ordered_unique<
-                composite_key<
-                    Participant,
-                    member<Participant, std::weak_ptr<Session>, &Participant::session>,
-                    member<Participant, ParticipantType, &Participant::participant_type>,
-                    member<Participant, PromptSession*, &Participant::prompt_session>
-                >,
-                composite_key_compare<
-                    std::owner_less<std::weak_ptr<Session>>,
-                    std::less<ParticipantType>,
-                    std::less<PromptSession*>>
-            >
-        >
-    > PromptSessionParticipants;
-
-    typedef nth_index<PromptSessionParticipants,0>::type participant_by_prompt_session;
-    typedef nth_index<PromptSessionParticipants,1>::type participant_by_session;
-
-    PromptSessionParticipants participant_map;
-    participant_by_prompt_session& prompt_session_index;
-    participant_by_session& participant_index;
+    std::unordered_map<PromptSession*, PromptSessionEntry> prompt_sessions;
+    std::unordered_map<Session*, std::vector<Membership>> memberships;
+
+    void remove_membership(Session* key, std::weak_ptr<Session> const& session, ParticipantType participant_type, PromptSession* prompt_session);
+    auto memberships_of(std::weak_ptr<Session> const& session) const -> std::vector<Membership> const*;
 };
 
 }
@@ -19,13 +19,10 @@
 #include "rendering_tracker.h"
 #include "mir/scene/surface.h"
 
-#include <algorithm>
-
 #include <stdexcept>
 #include <boost/throw_exception.hpp>
 
 namespace ms = mir::scene;
-namespace mc = mir::compositor;
 
 ms::RenderingTracker::RenderingTracker(
     std::weak_ptr<ms::Surface> const& weak_surface)
@@ -33,78 +30,79 @@ ms::RenderingTracker::RenderingTracker(
 {
 }
 
-void ms::RenderingTracker::rendered_in(mc::CompositorID cid)
+void ms::RenderingTracker::rendered_in(CompositorMask compositor)
 {
-    std::lock_guard<std::mutex> lock{guard};
-
-    ensure_is_active_compositor(cid);
+    ensure_is_active_compositor(compositor);
 
-    occlusions.erase(cid);
+    occlusions &= ~compositor;
 
-    configure_visibility(mir_window_visibility_exposed);
+    if (published_visibility != mir_window_visibility_exposed)
+        publish_visibility();
 }
 
-void ms::RenderingTracker::occluded_in(mc::CompositorID cid)
+void ms::RenderingTracker::occluded_in(CompositorMask compositor)
 {
-    std::lock_guard<std::mutex> lock{guard};
-
-    ensure_is_active_compositor(cid);
+    ensure_is_active_compositor(compositor);
 
-    occlusions.insert(cid);
+    occlusions |= compositor;
 
-    if (occluded_in_all_active_compositors())
-        configure_visibility(mir_window_visibility_occluded);
+    if (published_visibility != mir_window_visibility_occluded &&
+        occluded_in_all_active_compositors())
+        publish_visibility();
 }
 
-void ms::RenderingTracker::active_compositors(std::set<mc::CompositorID> const& cids)
+void ms::RenderingTracker::active_compositors(CompositorMask compositors)
 {
-    std::lock_guard<std::mutex> lock{guard};
-
-    active_compositors_ = cids;
+    active_compositors_ = compositors;
 
-    remove_occlusions_for_inactive_compositors();
+    // Forget about occlusions in compositors that are gone
+    occlusions &= compositors;
 
     if (occluded_in_all_active_compositors())
-        configure_visibility(mir_window_visibility_occluded);
+        publish_visibility();
 }
 
-bool ms::RenderingTracker::is_exposed_in(mc::CompositorID cid) const
+bool ms::RenderingTracker::is_exposed_in(CompositorMask compositor) const
 {
-    std::lock_guard<std::mutex> lock{guard};
+    ensure_is_active_compositor(compositor);
 
-    ensure_is_active_compositor(cid);
-
-    if (occlusions.size() == 0)
-        return true;
-
-    return occlusions.find(cid) == occlusions.end();
+    return !(occlusions & compositor);
 }
 
-bool ms::RenderingTracker::occluded_in_all_active_compositors()
+bool ms::RenderingTracker::is_active(CompositorMask compositor) const
 {
-    return occlusions == active_compositors_;
+    return compositor && (compositor & active_compositors_) == compositor;
 }
 
-void ms::RenderingTracker::configure_visibility(MirWindowVisibility visibility)
+bool ms::RenderingTracker::occluded_in_all_active_compositors() const
 {
-    if (auto const surface = weak_surface.lock())
-        surface->configure(mir_window_attrib_visibility, visibility);
+    auto const active = active_compositors_.load();
+    return (occlusions & active) == active;
 }
 
-void ms::RenderingTracker::remove_occlusions_for_inactive_compositors()
+void ms::RenderingTracker::publish_visibility()
 {
-    std::set<mc::CompositorID> new_occlusions;
+    std::lock_guard<std::mutex> lock{publish_guard};
+
+    // Compositors may change the occlusions concurrently, so keep going
+    // until what was last published matches the current state
+    for (;;)
+    {
+        auto const visibility = occluded_in_all_active_compositors() ?
+            mir_window_visibility_occluded : mir_window_visibility_exposed;
+
+        if (published_visibility == visibility)
+            break;
 
-    std::set_intersection(
-        active_compositors_.begin(), active_compositors_.end(),
-        occlusions.begin(), occlusions.end(),
-        std::inserter(new_occlusions, new_occlusions.begin()));
+        published_visibility = visibility;
 
-    occlusions = std::move(new_occlusions);
+        if (auto const surface = weak_surface.lock())
+            surface->configure(mir_window_attrib_visibility, visibility);
+    }
 }
 
-void ms::RenderingTracker::ensure_is_active_compositor(compositor::CompositorID cid) const
+void ms::RenderingTracker::ensure_is_active_compositor(CompositorMask compositor) const
 {
-    if (active_compositors_.find(cid) == active_compositors_.end())
+    if (!is_active(compositor))
         BOOST_THROW_EXCEPTION(std::logic_error("No active compositor with supplied id"));
 }
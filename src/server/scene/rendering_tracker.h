@@ -19,10 +19,9 @@
 #ifndef MIR_SCENE_RENDERING_TRACKER_H_
 #define MIR_SCENE_RENDERING_TRACKER_H_
 
-#include "mir/compositor/compositor_id.h"
-
+#include <atomic>
+#include <cstdint>
 #include <memory>
-#include <set>
 #include <mutex>
 
 #include "mir_toolkit/common.h"
@@ -34,26 +33,37 @@ namespace scene
 
 class Surface;
 
+/// Tracks in which compositors a surface is occluded, and updates the
+/// surface visibility when that changes. Compositors are identified by a
+/// single bit assigned by the scene (see SurfaceStack), so that the state
+/// of all of them fits in one word that is updated without locking.
 class RenderingTracker
 {
 public:
+    using CompositorMask = std::uint64_t;
+    static unsigned int const max_compositors = 64;
+
     RenderingTracker(std::weak_ptr<Surface> const& weak_surface);
 
-    void rendered_in(compositor::CompositorID cid);
-    void occluded_in(compositor::CompositorID cid);
-    void active_compositors(std::set<compositor::CompositorID> const& cids);
-    bool is_exposed_in(compositor::CompositorID cid) const;
+    void rendered_in(CompositorMask compositor);
+    void occluded_in(CompositorMask compositor);
+    void active_compositors(CompositorMask compositors);
+    bool is_exposed_in(CompositorMask compositor) const;
+    bool is_active(CompositorMask compositor) const;
 
 private:
-    bool occluded_in_all_active_compositors();
-    void configure_visibility(MirWindowVisibility visibility);
-    void remove_occlusions_for_inactive_compositors();
-    void ensure_is_active_compositor(compositor::CompositorID cid) const;
+    bool occluded_in_all_active_compositors() const;
+    void publish_visibility();
+    void ensure_is_active_compositor(CompositorMask compositor) const;
 
     std::weak_ptr<Surface> const weak_surface;
-    std::set<compositor::CompositorID> occlusions;
-    std::set<compositor::CompositorID> active_compositors_;
-    std::mutex mutable guard;
+    std::atomic<CompositorMask> occlusions{0};
+    std::atomic<CompositorMask> active_compositors_{0};
+
+    // Only taken when the visibility changes, not on every frame
+    std::mutex publish_guard;
+    static int const nothing_published = -1;
+    std::atomic<int> published_visibility{nothing_published};
 };
 
 }
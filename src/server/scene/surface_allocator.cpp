@@ -30,9 +30,11 @@ namespace mi=mir::input;
 
 ms::SurfaceAllocator::SurfaceAllocator(
     std::shared_ptr<mg::CursorImage> const& default_cursor_image,
-    std::shared_ptr<SceneReport> const& report) :
+    std::shared_ptr<SceneReport> const& report,
+    std::shared_ptr<time::AlarmFactory> const& alarm_factory) :
     default_cursor_image(default_cursor_image),
-    report(report)
+    report(report),
+    alarm_factory(alarm_factory)
 {
 }
 
@@ -50,7 +52,8 @@ std::shared_ptr<ms::Surface> ms::SurfaceAllocator::create_surface(
         confine,
         streams,
         default_cursor_image,
-        report);
+        report,
+        *alarm_factory);
 
     return surface;
 }
@@ -28,6 +28,7 @@ namespace graphics
 class CursorImage;
 }
 namespace compositor { class BufferStream; }
+namespace time { class AlarmFactory; }
 namespace scene
 {
 class SceneReport;
@@ -37,7 +38,8 @@ class SurfaceAllocator : public SurfaceFactory
 public:
     SurfaceAllocator(
          std::shared_ptr<graphics::CursorImage> const& default_cursor_image,
-         std::shared_ptr<SceneReport> const& report);
+         std::shared_ptr<SceneReport> const& report,
+         std::shared_ptr<time::AlarmFactory> const& alarm_factory);
 
     std::shared_ptr<Surface> create_surface(
         std::shared_ptr<Session> const& session,
@@ -47,6 +49,7 @@ public:
 private:
     std::shared_ptr<graphics::CursorImage> const default_cursor_image;
     std::shared_ptr<SceneReport> const report;
+    std::shared_ptr<time::AlarmFactory> const alarm_factory;
 };
 
 }
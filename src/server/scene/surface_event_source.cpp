@@ -96,6 +96,13 @@ void ms::SurfaceEventSource::placed_relative(Surface const*, geometry::Rectangle
 
 void ms::SurfaceEventSource::input_consumed(Surface const*, MirEvent const* event)
 {
+    // mirclient predates touchpad gestures and would abort on receiving one
+    if (mir_event_get_type(event) == mir_event_type_input &&
+        mir_input_event_get_type(mir_event_get_input_event(event)) == mir_input_event_type_touchpad_gesture)
+    {
+        return;
+    }
+
     auto ev = mev::clone_event(*event);
     mev::set_window_id(*ev, id.as_value());
     event_sink->handle_event(move(ev));
@@ -34,6 +34,7 @@
 #include <functional>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 namespace ms = mir::scene;
 namespace mc = mir::compositor;
@@ -44,17 +45,112 @@ namespace geom = mir::geometry;
 namespace
 {
 
+/**
+ * Collects whether each surface was rendered or occluded in a frame of one
+ * compositor, merging the outcomes of a surface's renderables into a single
+ * update of its RenderingTracker.
+ *
+ * A surface is exposed as soon as any of its renderables is reported
+ * rendered, and occluded once all of them have been reported occluded.
+ * Until then (say, because the compositor doesn't report every element) its
+ * visibility is unchanged.
+ */
+class FrameVisibility
+{
+public:
+    using CompositorMask = ms::RenderingTracker::CompositorMask;
+
+    FrameVisibility(CompositorMask compositor, std::weak_ptr<void const> const& registration)
+        : compositor{compositor},
+          registration{registration}
+    {
+    }
+
+    /// Returns the slot to report the outcome for a renderable of tracker
+    size_t add(std::shared_ptr<ms::RenderingTracker> const& tracker)
+    {
+        // A surface's renderables are added one after another
+        if (surfaces.empty() || surfaces.back().tracker != tracker)
+            surfaces.push_back({tracker, 0, false});
+
+        ++surfaces.back().unreported;
+        entries.push_back({surfaces.size() - 1, false});
+        return entries.size() - 1;
+    }
+
+    void rendered(size_t slot)
+    {
+        report(slot, true);
+    }
+
+    void occluded(size_t slot)
+    {
+        report(slot, false);
+    }
+
+private:
+    struct SurfaceEntry
+    {
+        std::shared_ptr<ms::RenderingTracker> tracker;
+        size_t unreported;
+        bool committed;
+    };
+
+    struct Entry
+    {
+        size_t surface;
+        bool reported;
+    };
+
+    void report(size_t slot, bool rendered)
+    {
+        auto& entry = entries[slot];
+        auto& surface = surfaces[entry.surface];
+
+        if (!surface.tracker->is_active(compositor))
+            BOOST_THROW_EXCEPTION(std::logic_error("No active compositor with supplied id"));
+
+        if (!entry.reported)
+        {
+            entry.reported = true;
+            --surface.unreported;
+        }
+
+        // If the compositor has been unregistered since the frame started its
+        // slot may since have been given to another, which this frame is not for
+        if (surface.committed || !registration.lock())
+            return;
+
+        if (rendered)
+        {
+            surface.committed = true;
+            surface.tracker->rendered_in(compositor);
+        }
+        else if (surface.unreported == 0)
+        {
+            // None of the surface's renderables was rendered, or it would have been committed already
+            surface.committed = true;
+            surface.tracker->occluded_in(compositor);
+        }
+    }
+
+    CompositorMask const compositor;
+    std::weak_ptr<void const> const registration;
+    std::vector<SurfaceEntry> surfaces;
+    std::vector<Entry> entries;
+};
+
 class SurfaceSceneElement : public mc::SceneElement
 {
 public:
     SurfaceSceneElement(
         std::string name,
         std::shared_ptr<mg::Renderable> const& renderable,
-        std::shared_ptr<ms::RenderingTracker> const& tracker,
-        mc::CompositorID id)
+        std::shared_ptr<FrameVisibility> const& frame,
+        std::shared_ptr<ms::RenderingTracker> const& tracker)
         : renderable_{renderable},
-          tracker{tracker},
-          cid{id},
+          frame{frame},
+          slot{frame->add(tracker)},
           surface_name(name)
     {
     }
@@ -66,18 +162,18 @@ public:
 
     void rendered() override
     {
-        tracker->rendered_in(cid);
+        frame->rendered(slot);
     }
 
     void occluded() override
     {
-        tracker->occluded_in(cid);
+        frame->occluded(slot);
     }
 
 private:
     std::shared_ptr<mg::Renderable> const renderable_;
-    std::shared_ptr<ms::RenderingTracker> const tracker;
-    mc::CompositorID cid;
+    std::shared_ptr<FrameVisibility> const frame;
+    size_t const slot;
     std::string const surface_name;
 };
 
@@ -155,6 +251,7 @@ mc::SceneElementSequence ms::SurfaceStack::scene_elements_for(mc::CompositorID i
     RecursiveReadLock lg(guard);
 
     scene_changed = false;
+    auto const frame = std::make_shared<FrameVisibility>(compositor_mask_for(id), registration_of(id));
     mc::SceneElementSequence elements;
     for (auto const& layer : surface_layers)
     {
@@ -162,14 +259,15 @@ mc::SceneElementSequence ms::SurfaceStack::scene_elements_for(mc::CompositorID i
         {
             if (surface->visible())
             {
+                auto const& tracker = rendering_trackers[surface.get()];
                 for (auto& renderable : surface->generate_renderables(id))
                 {
                     elements.emplace_back(
                         std::make_shared<SurfaceSceneElement>(
                             surface->name(),
                             renderable,
-                            rendering_trackers[surface.get()],
-                            id));
+                            frame,
+                            tracker));
                 }
             }
         }
@@ -186,23 +284,21 @@ int ms::SurfaceStack::frames_pending(mc::CompositorID id) const
     RecursiveReadLock lg(guard);
 
     int result = scene_changed ? 1 : 0;
-    for (auto const& layer : surface_layers)
+    auto const compositor = compositor_mask_for(id);
+
+    // Every surface in the stack has a tracker, and the order doesn't matter
+    // here, so there's no need to look each of them up.
+    for (auto const& tracker : rendering_trackers)
     {
-        for (auto const& surface : layer)
+        auto const surface = tracker.first;
+        if (surface->visible() && tracker.second->is_exposed_in(compositor))
         {
-            if (surface->visible())
-            {
-                auto const tracker = rendering_trackers.find(surface.get());
-                if (tracker != rendering_trackers.end() && tracker->second->is_exposed_in(id))
-                {
-                    // Note that we ask the surface and not a Renderable.
-                    // This is because we don't want to waste time and resources
-                    // on a snapshot till we're sure we need it...
-                    int ready = surface->buffers_ready_for_compositor(id);
-                    if (ready > result)
-                        result = ready;
-                }
-            }
+            // Note that we ask the surface and not a Renderable.
+            // This is because we don't want to waste time and resources
+            // on a snapshot till we're sure we need it...
+            int ready = surface->buffers_ready_for_compositor(id);
+            if (ready > result)
+                result = ready;
         }
     }
     return result;
@@ -212,7 +308,20 @@ void ms::SurfaceStack::register_compositor(mc::CompositorID cid)
 {
     RecursiveWriteLock lg(guard);
 
-    registered_compositors.insert(cid);
+    auto const free_slot = std::find_if(compositor_slots.begin(), compositor_slots.end(),
+        [](CompositorSlot const& slot) { return !slot.registration; });
+    if (free_slot != compositor_slots.end())
+    {
+        *free_slot = {cid, std::make_shared<char>()};
+    }
+    else if (compositor_slots.size() < RenderingTracker::max_compositors)
+    {
+        compositor_slots.push_back({cid, std::make_shared<char>()});
+    }
+    else
+    {
+        BOOST_THROW_EXCEPTION(std::runtime_error("Too many compositors registered"));
+    }
 
     update_rendering_tracker_compositors();
 }
@@ -221,7 +330,11 @@ void ms::SurfaceStack::unregister_compositor(mc::CompositorID cid)
 {
     RecursiveWriteLock lg(guard);
 
-    registered_compositors.erase(cid);
+    for (auto& slot : compositor_slots)
+    {
+        if (slot.registration && slot.id == cid)
+            slot = {};
+    }
 
     update_rendering_tracker_compositors();
 }
@@ -262,6 +375,13 @@ void ms::SurfaceStack::emit_scene_changed()
     observers.scene_changed();
 }
 
+void ms::SurfaceStack::emit_scene_damaged(geometry::Rectangle const& damage)
+{
+    // Unlike emit_scene_changed() this doesn't flag the whole scene as
+    // changed: only the compositors overlapping the damage get scheduled.
+    observers.scene_damaged(damage);
+}
+
 void ms::SurfaceStack::add_surface(
     std::shared_ptr<Surface> const& surface,
     mi::InputReceptionMode input_mode)
@@ -432,7 +552,7 @@ void ms::SurfaceStack::create_rendering_tracker_for(std::shared_ptr<Surface> con
     auto const tracker = std::make_shared<RenderingTracker>(surface);
 
     RecursiveWriteLock ul(guard);
-    tracker->active_compositors(registered_compositors);
+    tracker->active_compositors(registered_compositors_mask());
     rendering_trackers[surface.get()] = tracker;
 }
 
@@ -440,8 +560,44 @@ void ms::SurfaceStack::update_rendering_tracker_compositors()
 {
     RecursiveReadLock ul(guard);
 
+    auto const active = registered_compositors_mask();
     for (auto const& pair : rendering_trackers)
-        pair.second->active_compositors(registered_compositors);
+        pair.second->active_compositors(active);
+}
+
+auto ms::SurfaceStack::compositor_mask_for(mc::CompositorID cid) const -> RenderingTracker::CompositorMask
+{
+    for (auto slot = 0u; slot != compositor_slots.size(); ++slot)
+    {
+        if (compositor_slots[slot].registration && compositor_slots[slot].id == cid)
+            return RenderingTracker::CompositorMask{1} << slot;
+    }
+
+    return 0;
+}
+
+auto ms::SurfaceStack::registration_of(mc::CompositorID cid) const -> std::weak_ptr<void const>
+{
+    for (auto const& slot : compositor_slots)
+    {
+        if (slot.registration && slot.id == cid)
+            return slot.registration;
+    }
+
+    return {};
+}
+
+auto ms::SurfaceStack::registered_compositors_mask() const -> RenderingTracker::CompositorMask
+{
+    RenderingTracker::CompositorMask result{0};
+
+    for (auto slot = 0u; slot != compositor_slots.size(); ++slot)
+    {
+        if (compositor_slots[slot].registration)
+            result |= RenderingTracker::CompositorMask{1} << slot;
+    }
+
+    return result;
 }
 
 void ms::SurfaceStack::insert_surface_at_top_of_depth_layer(std::shared_ptr<Surface> const& surface)
@@ -502,6 +658,12 @@ void ms::Observers::scene_changed()
         { observer->scene_changed(); });
 }
 
+void ms::Observers::scene_damaged(geometry::Rectangle const& damage)
+{
+   for_each([&](std::shared_ptr<Observer> const& observer)
+        { observer->scene_damaged(damage); });
+}
+
 void ms::Observers::surface_exists(std::shared_ptr<Surface> const& surface)
 {
     for_each([&](std::shared_ptr<Observer> const& observer)
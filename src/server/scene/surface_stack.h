@@ -29,6 +29,7 @@
 
 #include "mir/basic_observers.h"
 #include "mir/scene/surface_observer.h"
+#include "rendering_tracker.h"
 
 #include <atomic>
 #include <map>
@@ -49,7 +50,6 @@ namespace scene
 {
 class BasicSurface;
 class SceneReport;
-class RenderingTracker;
 
 class Observers : public Observer, BasicObservers<Observer>
 {
@@ -59,6 +59,7 @@ public:
    void surface_removed(std::shared_ptr<Surface> const& surface) override;
    void surfaces_reordered() override;
    void scene_changed() override;
+   void scene_damaged(geometry::Rectangle const& damage) override;
    void surface_exists(std::shared_ptr<Surface> const& surface) override;
    void end_observation() override;
 
@@ -106,12 +107,16 @@ public:
     void remove_input_visualization(std::weak_ptr<graphics::Renderable> const& overlay) override;
 
     void emit_scene_changed() override;
+    void emit_scene_damaged(geometry::Rectangle const& damage) override;
 
 private:
     SurfaceStack(const SurfaceStack&) = delete;
     SurfaceStack& operator=(const SurfaceStack&) = delete;
     void create_rendering_tracker_for(std::shared_ptr<Surface> const&);
     void update_rendering_tracker_compositors();
+    auto compositor_mask_for(compositor::CompositorID cid) const -> RenderingTracker::CompositorMask;
+    auto registration_of(compositor::CompositorID cid) const -> std::weak_ptr<void const>;
+    auto registered_compositors_mask() const -> RenderingTracker::CompositorMask;
     void insert_surface_at_top_of_depth_layer(std::shared_ptr<Surface> const& surface);
 
     RecursiveReadWriteMutex mutable guard;
@@ -127,7 +132,15 @@ private:
      */
     std::vector<std::vector<std::shared_ptr<Surface>>> surface_layers;
     std::map<Surface*,std::shared_ptr<RenderingTracker>> rendering_trackers;
-    std::set<compositor::CompositorID> registered_compositors;
+    struct CompositorSlot
+    {
+        compositor::CompositorID id;
+        /// Null if the slot is free; otherwise alive while id stays registered, so a
+        /// frame it started is not committed for a compositor that later reuses the slot
+        std::shared_ptr<void const> registration;
+    };
+    /// Registered compositors, indexed by their bit in RenderingTracker::CompositorMask
+    std::vector<CompositorSlot> compositor_slots;
     
     std::vector<std::shared_ptr<graphics::Renderable>> overlays;
 
@@ -30,7 +30,9 @@
 #include "mir/scene/surface.h"
 #include "mir/scene/surface_creation_parameters.h"
 #include "mir/input/seat.h"
+#include "mir/geometry/rectangles.h"
 #include "decoration/manager.h"
+#include "mir_toolkit/event.h"
 
 #include <algorithm>
 #include <vector>
@@ -44,6 +46,56 @@ namespace geom = mir::geometry;
 namespace
 {
 
+/// \return true if the surface asks for the pointer to be confined (and sets up the seat accordingly)
+auto confine_pointer_for(ms::Surface const& surface, mi::Seat& seat) -> bool
+{
+    switch (surface.confine_pointer_state())
+    {
+    case mir_pointer_confined_to_window:
+    {
+        auto const bounds = surface.input_bounds();
+        auto const region = surface.confinement_region();
+        if (region.empty())
+        {
+            seat.set_confinement_regions({bounds});
+            return true;
+        }
+
+        auto const content_offset = as_displacement(surface.top_left()) + surface.content_offset();
+        geom::Rectangles confinement;
+        for (auto rect : region)
+        {
+            rect.top_left += content_offset;
+            auto const clipped = rect.intersection_with(bounds);
+            if (clipped.size.width > geom::Width{} && clipped.size.height > geom::Height{})
+                confinement.add(clipped);
+        }
+
+        // A region entirely outside the surface can't hold the pointer, so fall back to the whole surface
+        if (confinement.size() == 0)
+            confinement.add(bounds);
+
+        seat.set_confinement_regions(confinement);
+        return true;
+    }
+
+    case mir_pointer_locked_to_window:
+    {
+        // Confining the cursor to where it is now keeps it (and the surface under it) still
+        auto const state = seat.create_device_state();
+        auto const device_state = mir_event_get_input_device_state_event(state.get());
+        geom::Point const cursor{
+            mir_input_device_state_event_pointer_axis(device_state, mir_pointer_axis_x),
+            mir_input_device_state_event_pointer_axis(device_state, mir_pointer_axis_y)};
+        seat.set_confinement_regions({{cursor, {1, 1}}});
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
 struct UpdateConfinementOnSurfaceChanges : ms::NullSurfaceObserver
 {
     UpdateConfinementOnSurfaceChanges(msh::AbstractShell* shell) :
@@ -101,9 +153,9 @@ void msh::AbstractShell::update_focused_surface_confined_region()
 {
     auto const current_focus = focus_surface.lock();
 
-    if (current_focus && current_focus->confine_pointer_state() == mir_pointer_confined_to_window)
+    if (current_focus)
     {
-        seat->set_confinement_regions({current_focus->input_bounds()});
+        confine_pointer_for(*current_focus, *seat);
     }
 }
 
@@ -224,13 +276,15 @@ void msh::AbstractShell::modify_surface(std::shared_ptr<scene::Session> const& s
         }
     }
 
-    if (modifications.confine_pointer.is_set() && focused_surface() == surface)
+    if (modifications.confinement_region.is_set())
     {
-        if (surface->confine_pointer_state() == mir_pointer_confined_to_window)
-        {
-            seat->set_confinement_regions({surface->input_bounds()});
-        }
-        else
+        surface->set_confinement_region(modifications.confinement_region.value());
+    }
+
+    if ((modifications.confine_pointer.is_set() || modifications.confinement_region.is_set()) &&
+        focused_surface() == surface)
+    {
+        if (!confine_pointer_for(*surface, *seat))
         {
             seat->reset_confinement_regions();
         }
@@ -429,10 +483,7 @@ void msh::AbstractShell::notify_focus_locked(
 
         if (surface)
         {
-            if (surface->confine_pointer_state() == mir_pointer_confined_to_window)
-            {
-                seat->set_confinement_regions({surface->input_bounds()});
-            }
+            confine_pointer_for(*surface, *seat);
 
             // Ensure the surface has really taken the focus before notifying it that it is focused
             input_targeter->set_focus(surface);
@@ -507,6 +558,10 @@ bool msh::AbstractShell::handle(MirEvent const& event)
 
     case mir_input_event_type_pointer:
         return window_manager->handle_pointer_event(mir_input_event_get_pointer_event(input_event));
+
+    case mir_input_event_type_touchpad_gesture:
+        // Window managers don't intercept gestures (yet), they go to the client with the pointer focus
+        return false;
     
     case mir_input_event_types:
         abort();
@@ -108,6 +108,7 @@ struct msd::InputManager::Observer
         }   break;
 
         case mir_input_event_type_key:
+        case mir_input_event_type_touchpad_gesture:
         case mir_input_event_types:
             break;
         }
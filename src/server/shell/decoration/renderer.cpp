@@ -22,6 +22,7 @@
 #include "input.h"
 
 #include "mir/graphics/graphic_buffer_allocator.h"
+#include "mir/graphics/buffer.h"
 #include "mir/renderer/sw/pixel_source.h"
 #include "mir/geometry/displacement.h"
 #include "mir/log.h"
@@ -33,6 +34,8 @@
 
 #include <locale>
 #include <codecvt>
+#include <algorithm>
+#include <cstring>
 
 namespace ms = mir::scene;
 namespace mg = mir::graphics;
@@ -106,10 +109,60 @@ inline void render_row(
         return;
     geom::X const right = std::min(left.x + as_delta(length), as_x(buf_size.width));
     left.x = std::max(left.x, geom::X{});
+    if (right <= left.x)
+        return;
     uint32_t* const start = data + (left.y.as_int() * buf_size.width.as_int()) + left.x.as_int();
-    uint32_t* const end = start + right.as_int() - left.x.as_int();
-    for (uint32_t* i = start; i < end; i++)
-        *i = color;
+    // A plain fill is vectorized by the compiler, which a hand written per-pixel loop often was not
+    std::fill_n(start, right.as_int() - left.x.as_int(), color);
+}
+
+/// Fills a rectangle by filling its first row and copying that row to the rest
+inline void render_rect(
+    uint32_t* const data,
+    geom::Size buf_size,
+    geom::Rectangle rect,
+    uint32_t color)
+{
+    geom::X const left = std::max(rect.left(), geom::X{});
+    geom::X const right = std::min(rect.right(), as_x(buf_size.width));
+    geom::Y const top = std::max(rect.top(), geom::Y{});
+    geom::Y const bottom = std::min(rect.bottom(), as_y(buf_size.height));
+    if (left >= right || top >= bottom)
+        return;
+
+    int const stride = buf_size.width.as_int();
+    uint32_t* const first_row = data + top.as_int() * stride + left.as_int();
+    size_t const row_length = right.as_int() - left.as_int();
+    std::fill_n(first_row, row_length, color);
+    for (int y = top.as_int() + 1; y < bottom.as_int(); y++)
+        memcpy(data + y * stride + left.as_int(), first_row, row_length * sizeof(uint32_t));
+}
+
+/// Copies a block of pixels into the buffer at the given position, clipping to the buffer
+inline void blit(
+    uint32_t* const data,
+    geom::Size buf_size,
+    uint32_t const* const block,
+    geom::Rectangle rect)
+{
+    geom::X const left = std::max(rect.left(), geom::X{});
+    geom::X const right = std::min(rect.right(), as_x(buf_size.width));
+    geom::Y const top = std::max(rect.top(), geom::Y{});
+    geom::Y const bottom = std::min(rect.bottom(), as_y(buf_size.height));
+    if (left >= right || top >= bottom)
+        return;
+
+    int const block_stride = rect.size.width.as_int();
+    int const block_dx = (left - rect.left()).as_int();
+    size_t const row_length = right.as_int() - left.as_int();
+    for (geom::Y y = top; y < bottom; y += geom::DeltaY{1})
+    {
+        int const block_y = (y - rect.top()).as_int();
+        memcpy(
+            data + y.as_int() * buf_size.width.as_int() + left.as_int(),
+            block + block_y * block_stride + block_dx,
+            row_length * sizeof(uint32_t));
+    }
 }
 
 inline void render_close_icon(
@@ -185,16 +238,35 @@ public:
         Pixel color) override;
 
 private:
+    /// A rasterized glyph, kept so titles are not run through FreeType each time a decoration is redrawn
+    struct Glyph
+    {
+        std::vector<unsigned char> alpha; ///< One byte per pixel, rows are width bytes long
+        int width;
+        int rows;
+        geom::Displacement bearing;       ///< Offset from the pen position to the top left of the bitmap
+        geom::Displacement advance;
+    };
+
+    /// Glyphs are keyed by pixel height and codepoint (all text is drawn in the same face)
+    using GlyphKey = std::pair<int, char32_t>;
+
+    /// Titles can contain arbitrary text, so the cache is dropped if it grows past this
+    static size_t const max_cached_glyphs = 4096;
+
     std::mutex mutex;
     FT_Library library;
     FT_Face face;
+    geom::Height char_size{};
+    std::map<GlyphKey, Glyph> glyph_cache;
 
     void set_char_size(geom::Height height);
+    auto glyph_for(char32_t glyph, geom::Height height) -> Glyph const&;
     void rasterize_glyph(char32_t glyph);
     void render_glyph(
         Pixel* buf,
         geom::Size buf_size,
-        FT_Bitmap const* glyph,
+        Glyph const& glyph,
         geom::Point top_left,
         Pixel color);
 
@@ -290,34 +362,15 @@ void msd::Renderer::Text::Impl::render(
         return;
     }
 
-    try
-    {
-        set_char_size(height_pixels);
-    }
-    catch (std::runtime_error const& error)
-    {
-        log_warning(error.what());
-        return;
-    }
-
     auto const utf32 = utf8_to_utf32(text);
 
     for (char32_t const glyph : utf32)
     {
         try
         {
-            rasterize_glyph(glyph);
-
-            geom::Point glyph_top_left =
-                top_left +
-                geom::Displacement{
-                    face->glyph->bitmap_left,
-                    height_pixels.as_int() - face->glyph->bitmap_top};
-            render_glyph(buf, buf_size, &face->glyph->bitmap, glyph_top_left, color);
-
-            top_left += geom::Displacement{
-                face->glyph->advance.x / 64,
-                face->glyph->advance.y / 64};
+            auto const& cached = glyph_for(glyph, height_pixels);
+            render_glyph(buf, buf_size, cached, top_left + cached.bearing, color);
+            top_left += cached.advance;
         }
         catch (std::runtime_error const& error)
         {
@@ -328,9 +381,54 @@ void msd::Renderer::Text::Impl::render(
 
 void msd::Renderer::Text::Impl::set_char_size(geom::Height height)
 {
+    if (height == char_size)
+        return;
+
     if (auto const error = FT_Set_Pixel_Sizes(face, 0, height.as_int()))
+    {
+        char_size = geom::Height{};
         BOOST_THROW_EXCEPTION(std::runtime_error(
             "Setting char size failed with error " + std::to_string(error)));
+    }
+
+    char_size = height;
+}
+
+auto msd::Renderer::Text::Impl::glyph_for(char32_t glyph, geom::Height height) -> Glyph const&
+{
+    GlyphKey const key{height.as_int(), glyph};
+
+    auto const existing = glyph_cache.find(key);
+    if (existing != glyph_cache.end())
+        return existing->second;
+
+    set_char_size(height);
+    rasterize_glyph(glyph);
+
+    if (glyph_cache.size() >= max_cached_glyphs)
+        glyph_cache.clear();
+
+    FT_Bitmap const& bitmap = face->glyph->bitmap;
+    Glyph rasterized{
+        std::vector<unsigned char>(bitmap.width * bitmap.rows),
+        static_cast<int>(bitmap.width),
+        static_cast<int>(bitmap.rows),
+        geom::Displacement{
+            face->glyph->bitmap_left,
+            height.as_int() - face->glyph->bitmap_top},
+        geom::Displacement{
+            face->glyph->advance.x / 64,
+            face->glyph->advance.y / 64}};
+
+    for (unsigned row = 0; row < bitmap.rows; row++)
+    {
+        memcpy(
+            rasterized.alpha.data() + row * bitmap.width,
+            bitmap.buffer + row * bitmap.pitch,
+            bitmap.width);
+    }
+
+    return glyph_cache.emplace(key, std::move(rasterized)).first->second;
 }
 
 void msd::Renderer::Text::Impl::rasterize_glyph(char32_t glyph)
@@ -349,15 +447,15 @@ void msd::Renderer::Text::Impl::rasterize_glyph(char32_t glyph)
 void msd::Renderer::Text::Impl::render_glyph(
     Pixel* buf,
     geom::Size buf_size,
-    FT_Bitmap const* glyph,
+    Glyph const& glyph,
     geom::Point top_left,
     Pixel color)
 {
     geom::X const buffer_left = std::max(top_left.x, geom::X{});
-    geom::X const buffer_right = std::min(top_left.x + geom::DeltaX{glyph->width}, as_x(buf_size.width));
+    geom::X const buffer_right = std::min(top_left.x + geom::DeltaX{glyph.width}, as_x(buf_size.width));
 
     geom::Y const buffer_top = std::max(top_left.y, geom::Y{});
-    geom::Y const buffer_bottom = std::min(top_left.y + geom::DeltaY{glyph->rows}, as_y(buf_size.height));
+    geom::Y const buffer_bottom = std::min(top_left.y + geom::DeltaY{glyph.rows}, as_y(buf_size.height));
 
     geom::Displacement const glyph_offset = as_displacement(top_left);
 
@@ -367,13 +465,15 @@ void msd::Renderer::Text::Impl::render_glyph(
     for (geom::Y buffer_y = buffer_top; buffer_y < buffer_bottom; buffer_y += geom::DeltaY{1})
     {
         geom::Y const glyph_y = buffer_y - glyph_offset.dy;
-        unsigned char* const glyph_row = glyph->buffer + glyph_y.as_int() * glyph->pitch;
+        unsigned char const* const glyph_row = glyph.alpha.data() + glyph_y.as_int() * glyph.width;
         Pixel* const buffer_row = buf + buffer_y.as_int() * buf_size.width.as_int();
 
         for (geom::X buffer_x = buffer_left; buffer_x < buffer_right; buffer_x += geom::DeltaX{1})
         {
             geom::X const glyph_x = buffer_x - glyph_offset.dx;
             unsigned char const glyph_alpha = ((int)glyph_row[glyph_x.as_int()] * color_alpha) / 255;
+            if (!glyph_alpha)
+                continue;
             unsigned char* const buffer_pixels = (unsigned char *)(buffer_row + buffer_x.as_int());
             for (int i = 0; i < 3; i++)
             {
@@ -540,13 +640,10 @@ auto msd::Renderer::render_titlebar() -> std::experimental::optional<std::shared
 
     if (needs_titlebar_redraw)
     {
-        for (geom::Y y{0}; y < as_y(titlebar_size.height); y += geom::DeltaY{1})
-        {
-            render_row(
-                titlebar_pixels.get(), titlebar_size,
-                {0, y}, titlebar_size.width,
-                current_theme->background_color);
-        }
+        render_rect(
+            titlebar_pixels.get(), titlebar_size,
+            {{}, titlebar_size},
+            current_theme->background_color);
 
         text->render(
             titlebar_pixels.get(),
@@ -561,31 +658,9 @@ auto msd::Renderer::render_titlebar() -> std::experimental::optional<std::shared
     {
         for (auto const& button : buttons)
         {
-            auto const icon = button_icons.find(button.function);
-            if (icon != button_icons.end())
+            if (auto const pixels = button_pixels(button.function, button.state, button.rect.size))
             {
-                Pixel button_color = icon->second.normal_color;
-                if (button.state == ButtonState::Hovered)
-                    button_color = icon->second.active_color;
-                for (geom::Y y{button.rect.top()}; y < button.rect.bottom(); y += geom::DeltaY{1})
-                {
-                    render_row(
-                        titlebar_pixels.get(),
-                        titlebar_size,
-                        {button.rect.left(), y},
-                        button.rect.size.width,
-                        button_color);
-                }
-                geom::Rectangle const icon_rect = {
-                button.rect.top_left + static_geometry->icon_padding, {
-                    button.rect.size.width - static_geometry->icon_padding.dx * 2,
-                    button.rect.size.height - static_geometry->icon_padding.dy * 2}};
-                icon->second.render_icon(
-                    titlebar_pixels.get(),
-                    titlebar_size,
-                    icon_rect,
-                    static_geometry->icon_line_width,
-                    icon->second.icon_color);
+                blit(titlebar_pixels.get(), titlebar_size, pixels, button.rect);
             }
             else
             {
@@ -600,6 +675,49 @@ auto msd::Renderer::render_titlebar() -> std::experimental::optional<std::shared
     return make_buffer(titlebar_pixels.get(), titlebar_size);
 }
 
+auto msd::Renderer::button_pixels(
+    ButtonFunction function,
+    ButtonState state,
+    geometry::Size size) -> Pixel const*
+{
+    if (!area(size))
+        return nullptr;
+
+    auto const icon = button_icons.find(function);
+    if (icon == button_icons.end())
+        return nullptr;
+
+    // All buttons share a size, so the cached icons only need replacing when that changes
+    if (size != button_icon_size)
+    {
+        button_icon_size = size;
+        button_icon_pixels.clear();
+    }
+
+    auto& pixels = button_icon_pixels[std::make_pair(function, state)];
+    if (!pixels)
+    {
+        pixels = alloc_pixels(size);
+        Pixel const button_color =
+            (state == ButtonState::Hovered) ?
+            icon->second.active_color :
+            icon->second.normal_color;
+        render_rect(pixels.get(), size, {{}, size}, button_color);
+        geom::Rectangle const icon_rect = {
+            geom::Point{} + static_geometry->icon_padding, {
+                size.width - static_geometry->icon_padding.dx * 2,
+                size.height - static_geometry->icon_padding.dy * 2}};
+        icon->second.render_icon(
+            pixels.get(),
+            size,
+            icon_rect,
+            static_geometry->icon_line_width,
+            icon->second.icon_color);
+    }
+
+    return pixels.get();
+}
+
 auto msd::Renderer::render_left_border() -> std::experimental::optional<std::shared_ptr<mg::Buffer>>
 {
     if (!area(left_border_size))
@@ -652,7 +770,9 @@ auto msd::Renderer::make_buffer(
         log_warning("Failed to draw SSD: tried to create zero size buffer");
         return std::experimental::nullopt;
     }
-    std::shared_ptr<graphics::Buffer> const buffer = buffer_allocator->alloc_software_buffer(size, buffer_format);
+    // Always a new buffer (and so a new buffer id): the compositor only re-uploads textures for ids it hasn't seen
+    auto const buffer = buffer_allocator->alloc_software_buffer(size, buffer_format);
+
     auto const pixel_source = dynamic_cast<mrs::PixelSource*>(buffer->native_buffer_base());
     if (!pixel_source)
     {
@@ -25,6 +25,7 @@
 
 #include <memory>
 #include <map>
+#include <vector>
 
 namespace mir
 {
@@ -129,7 +130,17 @@ private:
 
     std::shared_ptr<Text> const text;
 
+    /// Buttons (background and icon) are rendered once per function and state, and copied into the titlebar
+    ///@{
+    geometry::Size button_icon_size{};
+    std::map<std::pair<ButtonFunction, ButtonState>, std::unique_ptr<Pixel[]>> button_icon_pixels;
+    ///@}
+
     void update_solid_color_pixels();
+    auto button_pixels(
+        ButtonFunction function,
+        ButtonState state,
+        geometry::Size size) -> Pixel const*;
     auto make_buffer(
         Pixel const* pixels,
         geometry::Size size) -> std::experimental::optional<std::shared_ptr<graphics::Buffer>>;
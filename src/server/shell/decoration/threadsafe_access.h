@@ -21,6 +21,7 @@
 
 #include "mir/executor.h"
 #include "mir/fatal.h"
+#include "mir/heap_accounting.h"
 
 #include <memory>
 #include <mutex>
@@ -55,6 +56,7 @@ public:
     {
         executor->spawn([self = this->shared_from_this(), work]()
             {
+                mir::heap_accounting::Scope const heap_scope{mir::heap_accounting::Subsystem::decorations};
                 std::lock_guard<std::mutex> lock{self->mutex};
                 if (self->target)
                     work(self->target.value());
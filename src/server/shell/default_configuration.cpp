@@ -28,6 +28,9 @@
 #include "graphics_display_layout.h"
 #include "decoration/basic_manager.h"
 #include "decoration/basic_decoration.h"
+#include "idle_handler.h"
+#include "mir/options/configuration.h"
+#include "mir/options/option.h"
 
 namespace ms = mir::scene;
 namespace msh = mir::shell;
@@ -129,6 +132,22 @@ mir::DefaultServerConfiguration::the_shell_display_layout()
         });
 }
 
+auto mir::DefaultServerConfiguration::the_idle_handler() -> std::shared_ptr<msh::IdleHandler>
+{
+    return idle_handler(
+        [this]()
+        {
+            return std::make_shared<msh::IdleHandler>(
+                the_idle_hub(),
+                the_input_scene(),
+                the_display_configuration_controller(),
+                the_input_manager(),
+                *the_seat_observer_registrar(),
+                the_clock(),
+                std::chrono::seconds{the_options()->get<int>(options::idle_timeout_opt)});
+        });
+}
+
 std::shared_ptr<msh::HostLifecycleEventListener>
 mir::DefaultServerConfiguration::the_host_lifecycle_event_listener()
 {
@@ -0,0 +1,297 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "idle_handler.h"
+
+#include "mir/shell/display_configuration_controller.h"
+#include "mir/scene/idle_hub.h"
+#include "mir/input/input_manager.h"
+#include "mir/input/scene.h"
+#include "mir/input/seat_observer.h"
+#include "mir/graphics/renderable.h"
+#include "mir/graphics/solid_colour_buffer.h"
+#include "mir/geometry/rectangles.h"
+#include "mir/observer_registrar.h"
+#include "mir/time/clock.h"
+#include "mir/log.h"
+
+#include "mir_toolkit/events/event.h"
+#include "mir_toolkit/events/input/input_event.h"
+
+#include <algorithm>
+
+namespace msh = mir::shell;
+namespace ms = mir::scene;
+namespace mi = mir::input;
+namespace mg = mir::graphics;
+namespace geom = mir::geometry;
+
+namespace
+{
+/// How long before the outputs turn off that they are dimmed
+auto dim_period_for(mir::time::Duration off_timeout) -> mir::time::Duration
+{
+    using namespace std::chrono_literals;
+    return std::min<mir::time::Duration>(10s, off_timeout / 2);
+}
+
+/// A translucent black overlay across all the outputs
+class DimmingRenderable : public mg::Renderable
+{
+public:
+    DimmingRenderable(geom::Rectangle const& area) :
+        area{area},
+        buffer_{std::make_shared<mg::SolidColourBuffer>(geom::Size{1, 1}, mg::SolidColourBuffer::Colour{0, 0, 0, 1}, []{})}
+    {
+    }
+
+    unsigned int swap_interval() const override
+    {
+        return 1;
+    }
+
+    mg::Renderable::ID id() const override
+    {
+        return this;
+    }
+
+    std::shared_ptr<mg::Buffer> buffer() const override
+    {
+        return buffer_;
+    }
+
+    geom::Rectangle screen_position() const override
+    {
+        return area;
+    }
+
+    geom::Rectangle src_bounds() const override
+    {
+        return {{0, 0}, buffer_->size()};
+    }
+
+    std::experimental::optional<geom::Rectangle> clip_area() const override
+    {
+        return std::experimental::optional<geom::Rectangle>();
+    }
+
+    float alpha() const override
+    {
+        return 0.5;
+    }
+
+    glm::mat4 transformation() const override
+    {
+        return glm::mat4();
+    }
+
+    bool shaped() const override
+    {
+        return false;
+    }
+
+private:
+    geom::Rectangle const area;
+    std::shared_ptr<mg::Buffer> const buffer_;
+};
+}
+
+class msh::IdleHandler::DimObserver : public ms::IdleStateObserver
+{
+public:
+    DimObserver(IdleHandler* handler) : handler{handler} {}
+
+    void idle() override { handler->dim(); }
+    void active() override { handler->undim(); }
+
+private:
+    IdleHandler* const handler;
+};
+
+class msh::IdleHandler::OffObserver : public ms::IdleStateObserver
+{
+public:
+    OffObserver(IdleHandler* handler) : handler{handler} {}
+
+    void idle() override { handler->turn_off(); }
+    void active() override { handler->turn_on(); }
+
+private:
+    IdleHandler* const handler;
+};
+
+class msh::IdleHandler::ActivityObserver : public mi::SeatObserver
+{
+public:
+    ActivityObserver(IdleHandler* handler) : handler{handler} {}
+
+    void seat_dispatch_event(std::shared_ptr<MirEvent const> const& event) override
+    {
+        if (mir_event_get_type(event.get()) == mir_event_type_input)
+        {
+            auto const input_event = mir_event_get_input_event(event.get());
+            handler->input_event_at(std::chrono::nanoseconds{mir_input_event_get_event_time(input_event)});
+        }
+    }
+
+    void seat_add_device(uint64_t) override {}
+    void seat_remove_device(uint64_t) override {}
+    void seat_set_key_state(uint64_t, std::vector<uint32_t> const&) override {}
+    void seat_set_pointer_state(uint64_t, unsigned) override {}
+    void seat_set_cursor_position(float, float) override {}
+    void seat_set_confinement_region_called(geom::Rectangles const&) override {}
+    void seat_reset_confinement_regions() override {}
+
+private:
+    IdleHandler* const handler;
+};
+
+msh::IdleHandler::IdleHandler(
+    std::shared_ptr<ms::IdleHub> const& idle_hub,
+    std::shared_ptr<mi::Scene> const& input_scene,
+    std::shared_ptr<DisplayConfigurationController> const& display_config_controller,
+    std::shared_ptr<mi::InputManager> const& input_manager,
+    ObserverRegistrar<mi::SeatObserver>& seat_observer_registrar,
+    std::shared_ptr<time::Clock> const& clock,
+    time::Duration off_timeout) :
+    idle_hub{idle_hub},
+    input_scene{input_scene},
+    display_config_controller{display_config_controller},
+    input_manager{input_manager},
+    clock{clock},
+    dim_observer{std::make_shared<DimObserver>(this)},
+    off_observer{std::make_shared<OffObserver>(this)},
+    activity_observer{std::make_shared<ActivityObserver>(this)}
+{
+    if (off_timeout <= time::Duration::zero())
+        return;
+
+    seat_observer_registrar.register_interest(activity_observer);
+    idle_hub->register_interest(dim_observer, off_timeout - dim_period_for(off_timeout));
+    idle_hub->register_interest(off_observer, off_timeout);
+}
+
+msh::IdleHandler::~IdleHandler()
+{
+    idle_hub->unregister_interest(*dim_observer);
+    idle_hub->unregister_interest(*off_observer);
+}
+
+void msh::IdleHandler::dim()
+{
+    geom::Rectangles area;
+    display_config_controller->base_configuration()->for_each_output(
+        [&](mg::DisplayConfigurationOutput const& output)
+        {
+            if (output.connected && output.used)
+                area.add(output.extents());
+        });
+
+    auto const renderable = std::make_shared<DimmingRenderable>(area.bounding_rectangle());
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        if (dimmer)
+            return;
+        dimmer = renderable;
+    }
+
+    input_scene->add_input_visualization(renderable);
+}
+
+void msh::IdleHandler::undim()
+{
+    std::shared_ptr<mg::Renderable> renderable;
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        renderable = std::move(dimmer);
+        dimmer.reset();
+    }
+
+    if (renderable)
+        input_scene->remove_input_visualization(renderable);
+}
+
+void msh::IdleHandler::turn_off()
+{
+    auto const conf = display_config_controller->base_configuration();
+    std::vector<mg::DisplayConfigurationOutputId> ids;
+    conf->for_each_output(
+        [&](mg::UserDisplayConfigurationOutput& output)
+        {
+            if (output.used && output.power_mode == mir_power_mode_on)
+            {
+                output.power_mode = mir_power_mode_off;
+                ids.push_back(output.id);
+            }
+        });
+
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        if (off)
+            return;
+        off = true;
+        turned_off = std::move(ids);
+        first_event_while_off = std::chrono::nanoseconds::zero();
+    }
+
+    display_config_controller->set_base_configuration(conf);
+    input_manager->suspend_non_wake_devices();
+}
+
+void msh::IdleHandler::turn_on()
+{
+    std::vector<mg::DisplayConfigurationOutputId> ids;
+    std::chrono::nanoseconds wake_event_time;
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        if (!off)
+            return;
+        off = false;
+        ids = std::move(turned_off);
+        turned_off.clear();
+        wake_event_time = first_event_while_off;
+    }
+
+    input_manager->resume_non_wake_devices();
+
+    auto const conf = display_config_controller->base_configuration();
+    conf->for_each_output(
+        [&](mg::UserDisplayConfigurationOutput& output)
+        {
+            if (std::find(begin(ids), end(ids), output.id) != end(ids))
+                output.power_mode = mir_power_mode_on;
+        });
+    display_config_controller->set_base_configuration(conf);
+
+    if (wake_event_time != std::chrono::nanoseconds::zero())
+    {
+        auto const latency = clock->now().time_since_epoch() - wake_event_time;
+        log_info(
+            "Outputs powered on %.1fms after the first input event",
+            std::chrono::duration<double, std::milli>(latency).count());
+    }
+}
+
+void msh::IdleHandler::input_event_at(std::chrono::nanoseconds event_time)
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        if (off && first_event_while_off == std::chrono::nanoseconds::zero())
+            first_event_while_off = event_time;
+    }
+
+    idle_hub->poke();
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MIR_SHELL_IDLE_HANDLER_H_
+#define MIR_SHELL_IDLE_HANDLER_H_
+
+#include "mir/graphics/display_configuration.h"
+#include "mir/time/types.h"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace mir
+{
+template<class Observer>
+class ObserverRegistrar;
+
+namespace graphics
+{
+class Renderable;
+}
+namespace input
+{
+class InputManager;
+class Scene;
+class SeatObserver;
+}
+namespace scene
+{
+class IdleHub;
+class IdleStateObserver;
+}
+namespace time
+{
+class Clock;
+}
+
+namespace shell
+{
+class DisplayConfigurationController;
+
+/**
+ * Dims, and then turns off, the outputs when the idle hub reports inactivity
+ *
+ * While the outputs are off, input devices that cannot wake the system are not polled.
+ */
+class IdleHandler
+{
+public:
+    /// A \p off_timeout of zero disables the handler
+    IdleHandler(
+        std::shared_ptr<scene::IdleHub> const& idle_hub,
+        std::shared_ptr<input::Scene> const& input_scene,
+        std::shared_ptr<DisplayConfigurationController> const& display_config_controller,
+        std::shared_ptr<input::InputManager> const& input_manager,
+        ObserverRegistrar<input::SeatObserver>& seat_observer_registrar,
+        std::shared_ptr<time::Clock> const& clock,
+        time::Duration off_timeout);
+    ~IdleHandler();
+
+private:
+    class DimObserver;
+    class OffObserver;
+    class ActivityObserver;
+
+    void dim();
+    void undim();
+    void turn_off();
+    void turn_on();
+    void input_event_at(std::chrono::nanoseconds event_time);
+
+    std::shared_ptr<scene::IdleHub> const idle_hub;
+    std::shared_ptr<input::Scene> const input_scene;
+    std::shared_ptr<DisplayConfigurationController> const display_config_controller;
+    std::shared_ptr<input::InputManager> const input_manager;
+    std::shared_ptr<time::Clock> const clock;
+
+    std::mutex mutex;
+    std::shared_ptr<graphics::Renderable> dimmer;
+    std::vector<graphics::DisplayConfigurationOutputId> turned_off;
+    bool off{false};
+    std::chrono::nanoseconds first_event_while_off{0};
+
+    std::shared_ptr<scene::IdleStateObserver> const dim_observer;
+    std::shared_ptr<scene::IdleStateObserver> const off_observer;
+    std::shared_ptr<input::SeatObserver> const activity_observer;
+};
+}
+}
+
+#endif // MIR_SHELL_IDLE_HANDLER_H_
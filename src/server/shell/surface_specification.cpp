@@ -134,6 +134,8 @@ void msh::SurfaceSpecification::update_from(SurfaceSpecification const& that)
         shell_chrome = that.shell_chrome;
     if (that.confine_pointer.is_set())
         confine_pointer = that.confine_pointer;
+    if (that.confinement_region.is_set())
+        confinement_region = that.confinement_region;
     if (that.cursor_image.is_set())
         cursor_image = that.cursor_image;
     if (that.stream_cursor.is_set())
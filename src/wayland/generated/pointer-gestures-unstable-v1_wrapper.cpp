@@ -0,0 +1,391 @@
+/*
+ * AUTOGENERATED - DO NOT EDIT
+ *
+ * This file is generated from pointer-gestures-unstable-v1.xml
+ * To regenerate, run the “refresh-wayland-wrapper” target.
+ */
+
+#include "pointer-gestures-unstable-v1_wrapper.h"
+
+#include <boost/throw_exception.hpp>
+#include <boost/exception/diagnostic_information.hpp>
+
+#include <wayland-server-core.h>
+
+#include "mir/log.h"
+
+namespace mir
+{
+namespace wayland
+{
+extern struct wl_interface const wl_pointer_interface_data;
+extern struct wl_interface const wl_surface_interface_data;
+extern struct wl_interface const zwp_pointer_gesture_pinch_v1_interface_data;
+extern struct wl_interface const zwp_pointer_gesture_swipe_v1_interface_data;
+extern struct wl_interface const zwp_pointer_gestures_v1_interface_data;
+}
+}
+
+namespace mw = mir::wayland;
+
+namespace
+{
+struct wl_interface const* all_null_types [] {
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr};
+}
+
+// PointerGesturesV1
+
+mw::PointerGesturesV1* mw::PointerGesturesV1::from(struct wl_resource* resource)
+{
+    return static_cast<PointerGesturesV1*>(wl_resource_get_user_data(resource));
+}
+
+struct mw::PointerGesturesV1::Thunks
+{
+    static int const supported_version;
+
+    static void get_swipe_gesture_thunk(struct wl_client* client, struct wl_resource* resource, uint32_t id, struct wl_resource* pointer)
+    {
+        auto me = static_cast<PointerGesturesV1*>(wl_resource_get_user_data(resource));
+        wl_resource* id_resolved{
+            wl_resource_create(client, &zwp_pointer_gesture_swipe_v1_interface_data, wl_resource_get_version(resource), id)};
+        if (id_resolved == nullptr)
+        {
+            wl_client_post_no_memory(client);
+            BOOST_THROW_EXCEPTION((std::bad_alloc{}));
+        }
+        try
+        {
+            me->get_swipe_gesture(id_resolved, pointer);
+        }
+        catch(...)
+        {
+            internal_error_processing_request(client, "PointerGesturesV1::get_swipe_gesture()");
+        }
+    }
+
+    static void get_pinch_gesture_thunk(struct wl_client* client, struct wl_resource* resource, uint32_t id, struct wl_resource* pointer)
+    {
+        auto me = static_cast<PointerGesturesV1*>(wl_resource_get_user_data(resource));
+        wl_resource* id_resolved{
+            wl_resource_create(client, &zwp_pointer_gesture_pinch_v1_interface_data, wl_resource_get_version(resource), id)};
+        if (id_resolved == nullptr)
+        {
+            wl_client_post_no_memory(client);
+            BOOST_THROW_EXCEPTION((std::bad_alloc{}));
+        }
+        try
+        {
+            me->get_pinch_gesture(id_resolved, pointer);
+        }
+        catch(...)
+        {
+            internal_error_processing_request(client, "PointerGesturesV1::get_pinch_gesture()");
+        }
+    }
+
+    static void resource_destroyed_thunk(wl_resource* resource)
+    {
+        delete static_cast<PointerGesturesV1*>(wl_resource_get_user_data(resource));
+    }
+
+    static void bind_thunk(struct wl_client* client, void* data, uint32_t version, uint32_t id)
+    {
+        auto me = static_cast<PointerGesturesV1::Global*>(data);
+        auto resource = wl_resource_create(
+            client,
+            &zwp_pointer_gestures_v1_interface_data,
+            std::min((int)version, Thunks::supported_version),
+            id);
+        if (resource == nullptr)
+        {
+            wl_client_post_no_memory(client);
+            BOOST_THROW_EXCEPTION((std::bad_alloc{}));
+        }
+        try
+        {
+            me->bind(resource);
+        }
+        catch(...)
+        {
+            internal_error_processing_request(client, "PointerGesturesV1 global bind");
+        }
+    }
+
+    static struct wl_interface const* get_swipe_gesture_types[];
+    static struct wl_interface const* get_pinch_gesture_types[];
+    static struct wl_message const request_messages[];
+    static void const* request_vtable[];
+};
+
+int const mw::PointerGesturesV1::Thunks::supported_version = 1;
+
+mw::PointerGesturesV1::PointerGesturesV1(struct wl_resource* resource, Version<1>)
+    : client{wl_resource_get_client(resource)},
+      resource{resource}
+{
+    if (resource == nullptr)
+    {
+        BOOST_THROW_EXCEPTION((std::bad_alloc{}));
+    }
+    wl_resource_set_implementation(resource, Thunks::request_vtable, this, &Thunks::resource_destroyed_thunk);
+}
+
+bool mw::PointerGesturesV1::is_instance(wl_resource* resource)
+{
+    return wl_resource_instance_of(resource, &zwp_pointer_gestures_v1_interface_data, Thunks::request_vtable);
+}
+
+void mw::PointerGesturesV1::destroy_wayland_object() const
+{
+    wl_resource_destroy(resource);
+}
+
+mw::PointerGesturesV1::Global::Global(wl_display* display, Version<1>)
+    : wayland::Global{
+          wl_global_create(
+              display,
+              &zwp_pointer_gestures_v1_interface_data,
+              Thunks::supported_version,
+              this,
+              &Thunks::bind_thunk)}
+{}
+
+auto mw::PointerGesturesV1::Global::interface_name() const -> char const*
+{
+    return PointerGesturesV1::interface_name;
+}
+
+struct wl_interface const* mw::PointerGesturesV1::Thunks::get_swipe_gesture_types[] {
+    &zwp_pointer_gesture_swipe_v1_interface_data,
+    &wl_pointer_interface_data};
+
+struct wl_interface const* mw::PointerGesturesV1::Thunks::get_pinch_gesture_types[] {
+    &zwp_pointer_gesture_pinch_v1_interface_data,
+    &wl_pointer_interface_data};
+
+struct wl_message const mw::PointerGesturesV1::Thunks::request_messages[] {
+    {"get_swipe_gesture", "no", get_swipe_gesture_types},
+    {"get_pinch_gesture", "no", get_pinch_gesture_types}};
+
+void const* mw::PointerGesturesV1::Thunks::request_vtable[] {
+    (void*)Thunks::get_swipe_gesture_thunk,
+    (void*)Thunks::get_pinch_gesture_thunk};
+
+// PointerGestureSwipeV1
+
+mw::PointerGestureSwipeV1* mw::PointerGestureSwipeV1::from(struct wl_resource* resource)
+{
+    return static_cast<PointerGestureSwipeV1*>(wl_resource_get_user_data(resource));
+}
+
+struct mw::PointerGestureSwipeV1::Thunks
+{
+    static int const supported_version;
+
+    static void destroy_thunk(struct wl_client* client, struct wl_resource* resource)
+    {
+        auto me = static_cast<PointerGestureSwipeV1*>(wl_resource_get_user_data(resource));
+        try
+        {
+            me->destroy();
+        }
+        catch(...)
+        {
+            internal_error_processing_request(client, "PointerGestureSwipeV1::destroy()");
+        }
+    }
+
+    static void resource_destroyed_thunk(wl_resource* resource)
+    {
+        delete static_cast<PointerGestureSwipeV1*>(wl_resource_get_user_data(resource));
+    }
+
+    static struct wl_interface const* begin_types[];
+    static struct wl_message const request_messages[];
+    static struct wl_message const event_messages[];
+    static void const* request_vtable[];
+};
+
+int const mw::PointerGestureSwipeV1::Thunks::supported_version = 1;
+
+mw::PointerGestureSwipeV1::PointerGestureSwipeV1(struct wl_resource* resource, Version<1>)
+    : client{wl_resource_get_client(resource)},
+      resource{resource}
+{
+    if (resource == nullptr)
+    {
+        BOOST_THROW_EXCEPTION((std::bad_alloc{}));
+    }
+    wl_resource_set_implementation(resource, Thunks::request_vtable, this, &Thunks::resource_destroyed_thunk);
+}
+
+void mw::PointerGestureSwipeV1::send_begin_event(uint32_t serial, uint32_t time, struct wl_resource* surface, uint32_t fingers) const
+{
+    wl_resource_post_event(resource, Opcode::begin, serial, time, surface, fingers);
+}
+
+void mw::PointerGestureSwipeV1::send_update_event(uint32_t time, double dx, double dy) const
+{
+    wl_fixed_t dx_resolved{wl_fixed_from_double(dx)};
+    wl_fixed_t dy_resolved{wl_fixed_from_double(dy)};
+    wl_resource_post_event(resource, Opcode::update, time, dx_resolved, dy_resolved);
+}
+
+void mw::PointerGestureSwipeV1::send_end_event(uint32_t serial, uint32_t time, int32_t cancelled) const
+{
+    wl_resource_post_event(resource, Opcode::end, serial, time, cancelled);
+}
+
+bool mw::PointerGestureSwipeV1::is_instance(wl_resource* resource)
+{
+    return wl_resource_instance_of(resource, &zwp_pointer_gesture_swipe_v1_interface_data, Thunks::request_vtable);
+}
+
+void mw::PointerGestureSwipeV1::destroy_wayland_object() const
+{
+    wl_resource_destroy(resource);
+}
+
+struct wl_interface const* mw::PointerGestureSwipeV1::Thunks::begin_types[] {
+    nullptr,
+    nullptr,
+    &wl_surface_interface_data,
+    nullptr};
+
+struct wl_message const mw::PointerGestureSwipeV1::Thunks::request_messages[] {
+    {"destroy", "", all_null_types}};
+
+struct wl_message const mw::PointerGestureSwipeV1::Thunks::event_messages[] {
+    {"begin", "uuou", begin_types},
+    {"update", "uff", all_null_types},
+    {"end", "uui", all_null_types}};
+
+void const* mw::PointerGestureSwipeV1::Thunks::request_vtable[] {
+    (void*)Thunks::destroy_thunk};
+
+// PointerGesturePinchV1
+
+mw::PointerGesturePinchV1* mw::PointerGesturePinchV1::from(struct wl_resource* resource)
+{
+    return static_cast<PointerGesturePinchV1*>(wl_resource_get_user_data(resource));
+}
+
+struct mw::PointerGesturePinchV1::Thunks
+{
+    static int const supported_version;
+
+    static void destroy_thunk(struct wl_client* client, struct wl_resource* resource)
+    {
+        auto me = static_cast<PointerGesturePinchV1*>(wl_resource_get_user_data(resource));
+        try
+        {
+            me->destroy();
+        }
+        catch(...)
+        {
+            internal_error_processing_request(client, "PointerGesturePinchV1::destroy()");
+        }
+    }
+
+    static void resource_destroyed_thunk(wl_resource* resource)
+    {
+        delete static_cast<PointerGesturePinchV1*>(wl_resource_get_user_data(resource));
+    }
+
+    static struct wl_interface const* begin_types[];
+    static struct wl_message const request_messages[];
+    static struct wl_message const event_messages[];
+    static void const* request_vtable[];
+};
+
+int const mw::PointerGesturePinchV1::Thunks::supported_version = 1;
+
+mw::PointerGesturePinchV1::PointerGesturePinchV1(struct wl_resource* resource, Version<1>)
+    : client{wl_resource_get_client(resource)},
+      resource{resource}
+{
+    if (resource == nullptr)
+    {
+        BOOST_THROW_EXCEPTION((std::bad_alloc{}));
+    }
+    wl_resource_set_implementation(resource, Thunks::request_vtable, this, &Thunks::resource_destroyed_thunk);
+}
+
+void mw::PointerGesturePinchV1::send_begin_event(uint32_t serial, uint32_t time, struct wl_resource* surface, uint32_t fingers) const
+{
+    wl_resource_post_event(resource, Opcode::begin, serial, time, surface, fingers);
+}
+
+void mw::PointerGesturePinchV1::send_update_event(uint32_t time, double dx, double dy, double scale, double rotation) const
+{
+    wl_fixed_t dx_resolved{wl_fixed_from_double(dx)};
+    wl_fixed_t dy_resolved{wl_fixed_from_double(dy)};
+    wl_fixed_t scale_resolved{wl_fixed_from_double(scale)};
+    wl_fixed_t rotation_resolved{wl_fixed_from_double(rotation)};
+    wl_resource_post_event(resource, Opcode::update, time, dx_resolved, dy_resolved, scale_resolved, rotation_resolved);
+}
+
+void mw::PointerGesturePinchV1::send_end_event(uint32_t serial, uint32_t time, int32_t cancelled) const
+{
+    wl_resource_post_event(resource, Opcode::end, serial, time, cancelled);
+}
+
+bool mw::PointerGesturePinchV1::is_instance(wl_resource* resource)
+{
+    return wl_resource_instance_of(resource, &zwp_pointer_gesture_pinch_v1_interface_data, Thunks::request_vtable);
+}
+
+void mw::PointerGesturePinchV1::destroy_wayland_object() const
+{
+    wl_resource_destroy(resource);
+}
+
+struct wl_interface const* mw::PointerGesturePinchV1::Thunks::begin_types[] {
+    nullptr,
+    nullptr,
+    &wl_surface_interface_data,
+    nullptr};
+
+struct wl_message const mw::PointerGesturePinchV1::Thunks::request_messages[] {
+    {"destroy", "", all_null_types}};
+
+struct wl_message const mw::PointerGesturePinchV1::Thunks::event_messages[] {
+    {"begin", "uuou", begin_types},
+    {"update", "uffff", all_null_types},
+    {"end", "uui", all_null_types}};
+
+void const* mw::PointerGesturePinchV1::Thunks::request_vtable[] {
+    (void*)Thunks::destroy_thunk};
+
+namespace mir
+{
+namespace wayland
+{
+
+struct wl_interface const zwp_pointer_gestures_v1_interface_data {
+    mw::PointerGesturesV1::interface_name,
+    mw::PointerGesturesV1::Thunks::supported_version,
+    2, mw::PointerGesturesV1::Thunks::request_messages,
+    0, nullptr};
+
+struct wl_interface const zwp_pointer_gesture_swipe_v1_interface_data {
+    mw::PointerGestureSwipeV1::interface_name,
+    mw::PointerGestureSwipeV1::Thunks::supported_version,
+    1, mw::PointerGestureSwipeV1::Thunks::request_messages,
+    3, mw::PointerGestureSwipeV1::Thunks::event_messages};
+
+struct wl_interface const zwp_pointer_gesture_pinch_v1_interface_data {
+    mw::PointerGesturePinchV1::interface_name,
+    mw::PointerGesturePinchV1::Thunks::supported_version,
+    1, mw::PointerGesturePinchV1::Thunks::request_messages,
+    3, mw::PointerGesturePinchV1::Thunks::event_messages};
+
+}
+}
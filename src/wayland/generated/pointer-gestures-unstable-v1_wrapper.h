@@ -0,0 +1,134 @@
+/*
+ * AUTOGENERATED - DO NOT EDIT
+ *
+ * This file is generated from pointer-gestures-unstable-v1.xml
+ * To regenerate, run the “refresh-wayland-wrapper” target.
+ */
+
+#ifndef MIR_FRONTEND_WAYLAND_POINTER_GESTURES_UNSTABLE_V1_XML_WRAPPER
+#define MIR_FRONTEND_WAYLAND_POINTER_GESTURES_UNSTABLE_V1_XML_WRAPPER
+
+#include <experimental/optional>
+
+#include "mir/fd.h"
+#include <wayland-server-core.h>
+
+#include "mir/wayland/wayland_base.h"
+
+namespace mir
+{
+namespace wayland
+{
+
+class PointerGesturesV1;
+class PointerGestureSwipeV1;
+class PointerGesturePinchV1;
+
+class PointerGesturesV1 : public Resource
+{
+public:
+    static char const constexpr* interface_name = "zwp_pointer_gestures_v1";
+
+    static PointerGesturesV1* from(struct wl_resource*);
+
+    PointerGesturesV1(struct wl_resource* resource, Version<1>);
+    virtual ~PointerGesturesV1() = default;
+
+    void destroy_wayland_object() const;
+
+    struct wl_client* const client;
+    struct wl_resource* const resource;
+
+    struct Thunks;
+
+    static bool is_instance(wl_resource* resource);
+
+    class Global : public wayland::Global
+    {
+    public:
+        Global(wl_display* display, Version<1>);
+
+        auto interface_name() const -> char const* override;
+
+    private:
+        virtual void bind(wl_resource* new_zwp_pointer_gestures_v1) = 0;
+        friend PointerGesturesV1::Thunks;
+    };
+
+private:
+    virtual void get_swipe_gesture(struct wl_resource* id, struct wl_resource* pointer) = 0;
+    virtual void get_pinch_gesture(struct wl_resource* id, struct wl_resource* pointer) = 0;
+};
+
+class PointerGestureSwipeV1 : public Resource
+{
+public:
+    static char const constexpr* interface_name = "zwp_pointer_gesture_swipe_v1";
+
+    static PointerGestureSwipeV1* from(struct wl_resource*);
+
+    PointerGestureSwipeV1(struct wl_resource* resource, Version<1>);
+    virtual ~PointerGestureSwipeV1() = default;
+
+    void send_begin_event(uint32_t serial, uint32_t time, struct wl_resource* surface, uint32_t fingers) const;
+    void send_update_event(uint32_t time, double dx, double dy) const;
+    void send_end_event(uint32_t serial, uint32_t time, int32_t cancelled) const;
+
+    void destroy_wayland_object() const;
+
+    struct wl_client* const client;
+    struct wl_resource* const resource;
+
+    struct Opcode
+    {
+        static uint32_t const begin = 0;
+        static uint32_t const update = 1;
+        static uint32_t const end = 2;
+    };
+
+    struct Thunks;
+
+    static bool is_instance(wl_resource* resource);
+
+private:
+    virtual void destroy() = 0;
+};
+
+class PointerGesturePinchV1 : public Resource
+{
+public:
+    static char const constexpr* interface_name = "zwp_pointer_gesture_pinch_v1";
+
+    static PointerGesturePinchV1* from(struct wl_resource*);
+
+    PointerGesturePinchV1(struct wl_resource* resource, Version<1>);
+    virtual ~PointerGesturePinchV1() = default;
+
+    void send_begin_event(uint32_t serial, uint32_t time, struct wl_resource* surface, uint32_t fingers) const;
+    void send_update_event(uint32_t time, double dx, double dy, double scale, double rotation) const;
+    void send_end_event(uint32_t serial, uint32_t time, int32_t cancelled) const;
+
+    void destroy_wayland_object() const;
+
+    struct wl_client* const client;
+    struct wl_resource* const resource;
+
+    struct Opcode
+    {
+        static uint32_t const begin = 0;
+        static uint32_t const update = 1;
+        static uint32_t const end = 2;
+    };
+
+    struct Thunks;
+
+    static bool is_instance(wl_resource* resource);
+
+private:
+    virtual void destroy() = 0;
+};
+
+}
+}
+
+#endif // MIR_FRONTEND_WAYLAND_POINTER_GESTURES_UNSTABLE_V1_XML_WRAPPER
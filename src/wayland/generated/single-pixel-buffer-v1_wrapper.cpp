@@ -0,0 +1,181 @@
+/*
+ * AUTOGENERATED - DO NOT EDIT
+ *
+ * This file is generated from single-pixel-buffer-v1.xml
+ * To regenerate, run the “refresh-wayland-wrapper” target.
+ */
+
+#include "single-pixel-buffer-v1_wrapper.h"
+
+#include <boost/throw_exception.hpp>
+#include <boost/exception/diagnostic_information.hpp>
+
+#include <wayland-server-core.h>
+
+#include "mir/log.h"
+
+namespace mir
+{
+namespace wayland
+{
+extern struct wl_interface const wl_buffer_interface_data;
+extern struct wl_interface const wp_single_pixel_buffer_manager_v1_interface_data;
+}
+}
+
+namespace mw = mir::wayland;
+
+namespace
+{
+struct wl_interface const* all_null_types [] {
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr};
+}
+
+// SinglePixelBufferManagerV1
+
+mw::SinglePixelBufferManagerV1* mw::SinglePixelBufferManagerV1::from(struct wl_resource* resource)
+{
+    return static_cast<SinglePixelBufferManagerV1*>(wl_resource_get_user_data(resource));
+}
+
+struct mw::SinglePixelBufferManagerV1::Thunks
+{
+    static int const supported_version;
+
+    static void destroy_thunk(struct wl_client* client, struct wl_resource* resource)
+    {
+        auto me = static_cast<SinglePixelBufferManagerV1*>(wl_resource_get_user_data(resource));
+        try
+        {
+            me->destroy();
+        }
+        catch(...)
+        {
+            internal_error_processing_request(client, "SinglePixelBufferManagerV1::destroy()");
+        }
+    }
+
+    static void create_u32_rgba_buffer_thunk(struct wl_client* client, struct wl_resource* resource, uint32_t id, uint32_t r, uint32_t g, uint32_t b, uint32_t a)
+    {
+        auto me = static_cast<SinglePixelBufferManagerV1*>(wl_resource_get_user_data(resource));
+        wl_resource* id_resolved{
+            wl_resource_create(client, &wl_buffer_interface_data, wl_resource_get_version(resource), id)};
+        if (id_resolved == nullptr)
+        {
+            wl_client_post_no_memory(client);
+            BOOST_THROW_EXCEPTION((std::bad_alloc{}));
+        }
+        try
+        {
+            me->create_u32_rgba_buffer(id_resolved, r, g, b, a);
+        }
+        catch(...)
+        {
+            internal_error_processing_request(client, "SinglePixelBufferManagerV1::create_u32_rgba_buffer()");
+        }
+    }
+
+    static void resource_destroyed_thunk(wl_resource* resource)
+    {
+        delete static_cast<SinglePixelBufferManagerV1*>(wl_resource_get_user_data(resource));
+    }
+
+    static void bind_thunk(struct wl_client* client, void* data, uint32_t version, uint32_t id)
+    {
+        auto me = static_cast<SinglePixelBufferManagerV1::Global*>(data);
+        auto resource = wl_resource_create(
+            client,
+            &wp_single_pixel_buffer_manager_v1_interface_data,
+            std::min((int)version, Thunks::supported_version),
+            id);
+        if (resource == nullptr)
+        {
+            wl_client_post_no_memory(client);
+            BOOST_THROW_EXCEPTION((std::bad_alloc{}));
+        }
+        try
+        {
+            me->bind(resource);
+        }
+        catch(...)
+        {
+            internal_error_processing_request(client, "SinglePixelBufferManagerV1 global bind");
+        }
+    }
+
+    static struct wl_interface const* create_u32_rgba_buffer_types[];
+    static struct wl_message const request_messages[];
+    static void const* request_vtable[];
+};
+
+int const mw::SinglePixelBufferManagerV1::Thunks::supported_version = 1;
+
+mw::SinglePixelBufferManagerV1::SinglePixelBufferManagerV1(struct wl_resource* resource, Version<1>)
+    : client{wl_resource_get_client(resource)},
+      resource{resource}
+{
+    if (resource == nullptr)
+    {
+        BOOST_THROW_EXCEPTION((std::bad_alloc{}));
+    }
+    wl_resource_set_implementation(resource, Thunks::request_vtable, this, &Thunks::resource_destroyed_thunk);
+}
+
+bool mw::SinglePixelBufferManagerV1::is_instance(wl_resource* resource)
+{
+    return wl_resource_instance_of(resource, &wp_single_pixel_buffer_manager_v1_interface_data, Thunks::request_vtable);
+}
+
+void mw::SinglePixelBufferManagerV1::destroy_wayland_object() const
+{
+    wl_resource_destroy(resource);
+}
+
+mw::SinglePixelBufferManagerV1::Global::Global(wl_display* display, Version<1>)
+    : wayland::Global{
+          wl_global_create(
+              display,
+              &wp_single_pixel_buffer_manager_v1_interface_data,
+              Thunks::supported_version,
+              this,
+              &Thunks::bind_thunk)}
+{}
+
+auto mw::SinglePixelBufferManagerV1::Global::interface_name() const -> char const*
+{
+    return SinglePixelBufferManagerV1::interface_name;
+}
+
+struct wl_interface const* mw::SinglePixelBufferManagerV1::Thunks::create_u32_rgba_buffer_types[] {
+    &wl_buffer_interface_data,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr};
+
+struct wl_message const mw::SinglePixelBufferManagerV1::Thunks::request_messages[] {
+    {"destroy", "", all_null_types},
+    {"create_u32_rgba_buffer", "nuuuu", create_u32_rgba_buffer_types}};
+
+void const* mw::SinglePixelBufferManagerV1::Thunks::request_vtable[] {
+    (void*)Thunks::destroy_thunk,
+    (void*)Thunks::create_u32_rgba_buffer_thunk};
+
+namespace mir
+{
+namespace wayland
+{
+
+struct wl_interface const wp_single_pixel_buffer_manager_v1_interface_data {
+    mw::SinglePixelBufferManagerV1::interface_name,
+    mw::SinglePixelBufferManagerV1::Thunks::supported_version,
+    2, mw::SinglePixelBufferManagerV1::Thunks::request_messages,
+    0, nullptr};
+
+}
+}
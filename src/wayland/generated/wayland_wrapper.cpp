@@ -85,6 +85,23 @@ void mw::Callback::send_done_event(uint32_t callback_data) const
     wl_resource_post_event(resource, Opcode::done, callback_data);
 }
 
+auto mw::Callback::slab() -> SlabAllocator&
+{
+    // Leaked so that objects destroyed during static deinitialization still have somewhere to go
+    static auto* const allocator = new SlabAllocator{64};
+    return *allocator;
+}
+
+void* mw::Callback::operator new(std::size_t size)
+{
+    return slab().allocate(size);
+}
+
+void mw::Callback::operator delete(void* block, std::size_t size)
+{
+    slab().deallocate(block, size);
+}
+
 void mw::Callback::destroy_wayland_object() const
 {
     wl_resource_destroy(resource);
@@ -518,6 +535,23 @@ bool mw::Buffer::is_instance(wl_resource* resource)
     return wl_resource_instance_of(resource, &wl_buffer_interface_data, Thunks::request_vtable);
 }
 
+auto mw::Buffer::slab() -> SlabAllocator&
+{
+    // Leaked so that objects destroyed during static deinitialization still have somewhere to go
+    static auto* const allocator = new SlabAllocator{64};
+    return *allocator;
+}
+
+void* mw::Buffer::operator new(std::size_t size)
+{
+    return slab().allocate(size);
+}
+
+void mw::Buffer::operator delete(void* block, std::size_t size)
+{
+    slab().deallocate(block, size);
+}
+
 void mw::Buffer::destroy_wayland_object() const
 {
     wl_resource_destroy(resource);
@@ -2668,6 +2702,23 @@ bool mw::Region::is_instance(wl_resource* resource)
     return wl_resource_instance_of(resource, &wl_region_interface_data, Thunks::request_vtable);
 }
 
+auto mw::Region::slab() -> SlabAllocator&
+{
+    // Leaked so that objects destroyed during static deinitialization still have somewhere to go
+    static auto* const allocator = new SlabAllocator{64};
+    return *allocator;
+}
+
+void* mw::Region::operator new(std::size_t size)
+{
+    return slab().allocate(size);
+}
+
+void mw::Region::operator delete(void* block, std::size_t size)
+{
+    slab().deallocate(block, size);
+}
+
 void mw::Region::destroy_wayland_object() const
 {
     wl_resource_destroy(resource);
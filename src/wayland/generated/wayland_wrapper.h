@@ -67,6 +67,10 @@ public:
 
     static bool is_instance(wl_resource* resource);
 
+    static auto slab() -> SlabAllocator&;
+    static void* operator new(std::size_t size);
+    static void operator delete(void* block, std::size_t size);
+
 private:
 };
 
@@ -268,6 +272,10 @@ public:
 
     static bool is_instance(wl_resource* resource);
 
+    static auto slab() -> SlabAllocator&;
+    static void* operator new(std::size_t size);
+    static void operator delete(void* block, std::size_t size);
+
 private:
     virtual void destroy() = 0;
 };
@@ -943,6 +951,10 @@ public:
 
     static bool is_instance(wl_resource* resource);
 
+    static auto slab() -> SlabAllocator&;
+    static void* operator new(std::size_t size);
+    static void operator delete(void* block, std::size_t size);
+
 private:
     virtual void destroy() = 0;
     virtual void add(int32_t x, int32_t y, int32_t width, int32_t height) = 0;
@@ -59,6 +59,15 @@ auto matching_keys_to_vector(
     }
     return interfaces;
 }
+
+// Interfaces whose objects clients create and destroy at a high rate. Their wrappers are allocated from a
+// per-type SlabAllocator. (Only safe where every subclass inherits publicly, as the class-scope operator new and
+// delete must be accessible where the subclass is created and destroyed.)
+std::unordered_set<std::string> const slab_allocated_interfaces{
+    "wl_callback",
+    "wl_region",
+    "wl_buffer",
+};
 }
 
 Interface::Interface(xmlpp::Element const& node,
@@ -78,7 +87,8 @@ Interface::Interface(xmlpp::Element const& node,
       events{get_events(node, generated_name)},
       enums{get_enums(node)},
       parent_interfaces{matching_keys_to_vector(event_constructable_interfaces, name_transform, wl_name)},
-      has_vtable{!requests.empty()}
+      has_vtable{!requests.empty()},
+      slab_allocated{slab_allocated_interfaces.count(wl_name) != 0}
 {
 }
 
@@ -107,6 +117,7 @@ Emitter Interface::declaration() const
             event_opcodes(),
             (thunks_impl_contents().is_valid() ? "struct Thunks;" : nullptr),
             is_instance_prototype(),
+            (slab_allocated ? slab_allocator_prototypes() : nullptr),
             (global ? global.value().declaration() : nullptr),
         }, true, true, Emitter::single_indent),
         empty_line,
@@ -134,6 +145,7 @@ Emitter Interface::implementation() const
             constructor_impl(),
             event_impls(),
             is_instance_impl(),
+            (slab_allocated ? slab_allocator_impl() : nullptr),
             Lines{
                 {"void ", nmspace, "destroy_wayland_object() const"},
                 Block{
@@ -304,6 +316,41 @@ Emitter Interface::is_instance_impl() const
     };
 }
 
+Emitter Interface::slab_allocator_prototypes() const
+{
+    return Lines{
+        "static auto slab() -> SlabAllocator&;",
+        "static void* operator new(std::size_t size);",
+        "static void operator delete(void* block, std::size_t size);"
+    };
+}
+
+Emitter Interface::slab_allocator_impl() const
+{
+    return EmptyLineList{
+        Lines{
+            {"auto ", nmspace, "slab() -> SlabAllocator&"},
+            Block{
+                "// Leaked so that objects destroyed during static deinitialization still have somewhere to go",
+                "static auto* const allocator = new SlabAllocator{64};",
+                "return *allocator;"
+            }
+        },
+        Lines{
+            {"void* ", nmspace, "operator new(std::size_t size)"},
+            Block{
+                "return slab().allocate(size);"
+            }
+        },
+        Lines{
+            {"void ", nmspace, "operator delete(void* block, std::size_t size)"},
+            Block{
+                "slab().deallocate(block, size);"
+            }
+        }
+    };
+}
+
 Emitter Interface::enum_declarations() const
 {
     std::vector<Emitter> declarations;
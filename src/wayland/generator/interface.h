@@ -70,6 +70,8 @@ private:
     Emitter types_init() const;
     Emitter is_instance_prototype() const;
     Emitter is_instance_impl() const;
+    Emitter slab_allocator_prototypes() const;
+    Emitter slab_allocator_impl() const;
 
     static std::vector<Request> get_requests(xmlpp::Element const& node, std::string generated_name);
     static std::vector<Event> get_events(xmlpp::Element const& node, std::string generated_name);
@@ -87,6 +89,7 @@ private:
     std::vector<Enum> const enums;
     std::vector<std::string> const parent_interfaces;
     bool const has_vtable;
+    bool const slab_allocated;
 };
 
 #endif // MIR_WAYLAND_GENERATOR_INTERFACE_H
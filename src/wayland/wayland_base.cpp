@@ -22,8 +22,22 @@
 
 #include "mir/wayland/wayland_base.h"
 
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
 namespace mw = mir::wayland;
 
+namespace
+{
+/// Every block is suitably aligned for any wrapper object and large enough to hold a free list link
+auto block_size_for(std::size_t size) -> std::size_t
+{
+    auto const alignment = alignof(std::max_align_t);
+    return std::max((size + alignment - 1) / alignment * alignment, alignment);
+}
+}
+
 mw::Resource::Resource()
 {
 }
@@ -42,6 +56,96 @@ mw::Global::~Global()
     wl_global_destroy(global);
 }
 
+mw::SlabAllocator::SlabAllocator(std::size_t blocks_per_slab)
+    : blocks_per_slab{blocks_per_slab}
+{
+    if (blocks_per_slab == 0)
+    {
+        BOOST_THROW_EXCEPTION((std::invalid_argument{"SlabAllocator needs at least one block per slab"}));
+    }
+}
+
+mw::SlabAllocator::~SlabAllocator()
+{
+    if (in_use)
+    {
+        ::mir::log(
+            ::mir::logging::Severity::warning,
+            "frontend:Wayland",
+            "Destroying slab allocator with " + std::to_string(in_use) + " blocks still in use");
+    }
+}
+
+auto mw::SlabAllocator::allocate(std::size_t size) -> void*
+{
+    auto const block_size = block_size_for(size);
+
+    std::lock_guard<std::mutex> lock{mutex};
+    auto& size_class = size_class_for(lock, block_size);
+
+    if (!size_class.free_list)
+    {
+        std::unique_ptr<char[]> slab{new char[block_size * blocks_per_slab]};
+        for (auto i = blocks_per_slab; i-- != 0;)
+        {
+            auto const block = reinterpret_cast<FreeBlock*>(slab.get() + i * block_size);
+            block->next = size_class.free_list;
+            size_class.free_list = block;
+        }
+        size_class.slabs.push_back(std::move(slab));
+    }
+
+    auto const block = size_class.free_list;
+    size_class.free_list = block->next;
+    ++in_use;
+    return block;
+}
+
+void mw::SlabAllocator::deallocate(void* block, std::size_t size) noexcept
+{
+    if (!block)
+        return;
+
+    std::lock_guard<std::mutex> lock{mutex};
+    auto& size_class = size_class_for(lock, block_size_for(size));
+
+    auto const free_block = static_cast<FreeBlock*>(block);
+    free_block->next = size_class.free_list;
+    size_class.free_list = free_block;
+    --in_use;
+}
+
+auto mw::SlabAllocator::blocks_in_use() const -> std::size_t
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    return in_use;
+}
+
+auto mw::SlabAllocator::slab_count() const -> std::size_t
+{
+    std::lock_guard<std::mutex> lock{mutex};
+    std::size_t count{0};
+    for (auto const& size_class : size_classes)
+    {
+        count += size_class.slabs.size();
+    }
+    return count;
+}
+
+auto mw::SlabAllocator::size_class_for(std::lock_guard<std::mutex> const&, std::size_t block_size) -> SizeClass&
+{
+    // Each wrapper type has its own allocator, so there are only ever one or two sizes (the object and perhaps
+    // a shared_ptr control block around it)
+    for (auto& size_class : size_classes)
+    {
+        if (size_class.block_size == block_size)
+            return size_class;
+    }
+
+    size_classes.push_back(SizeClass{block_size, nullptr, {}});
+    return size_classes.back();
+}
+
 void mw::internal_error_processing_request(wl_client* client, char const* method_name)
 {
 #if (WAYLAND_VERSION_MAJOR > 1 || (WAYLAND_VERSION_MAJOR == 1 && WAYLAND_VERSION_MINOR > 16))
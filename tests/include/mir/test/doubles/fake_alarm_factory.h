@@ -46,6 +46,9 @@ public:
     void advance_smoothly_by(time::Duration step);
     int wakeup_count() const;
 
+    /// The clock the alarms are scheduled against
+    auto the_clock() const -> std::shared_ptr<time::Clock>;
+
 private:
     class FakeAlarm;
 
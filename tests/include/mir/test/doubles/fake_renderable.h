@@ -55,6 +55,7 @@ public:
                    bool rectangular)
         : buf{std::make_shared<StubBuffer>()},
           rect(display_area),
+          src(geometry::Point{}, display_area.size),
           opacity(opacity),
           rectangular(rectangular)
     {
@@ -94,6 +95,16 @@ public:
     {
         return rect;
     }
+
+    void set_src_bounds(geometry::Rectangle const& bounds)
+    {
+        src = bounds;
+    }
+
+    geometry::Rectangle src_bounds() const override
+    {
+        return src;
+    }
     
     std::experimental::optional<geometry::Rectangle> clip_area() const override
     {
@@ -108,6 +119,7 @@ public:
 private:
     std::shared_ptr<graphics::Buffer> buf;
     mir::geometry::Rectangle rect;
+    mir::geometry::Rectangle src;
     float opacity;
     bool rectangular;
 };
@@ -53,6 +53,8 @@ struct MockBufferStream : public compositor::BufferStream
             .WillByDefault(testing::Return(mir_pixel_format_abgr_8888));
         ON_CALL(*this, stream_size())
             .WillByDefault(testing::Return(geometry::Size{0,0}));
+        ON_CALL(*this, src_bounds())
+            .WillByDefault(testing::Return(geometry::Rectangle{{0,0}, {0,0}}));
     }
     std::shared_ptr<StubBuffer> buffer { std::make_shared<StubBuffer>() };
     MOCK_METHOD1(acquire_client_buffer, void(std::function<void(graphics::Buffer* buffer)>));
@@ -63,6 +65,7 @@ struct MockBufferStream : public compositor::BufferStream
 
     MOCK_METHOD0(get_stream_pixel_format, MirPixelFormat());
     MOCK_METHOD0(stream_size, geometry::Size());
+    MOCK_METHOD0(src_bounds, geometry::Rectangle());
     MOCK_METHOD0(force_client_completion, void());
     MOCK_METHOD1(allow_framedropping, void(bool));
     MOCK_CONST_METHOD0(framedropping, bool());
@@ -78,6 +81,9 @@ struct MockBufferStream : public compositor::BufferStream
     MOCK_METHOD1(disassociate_buffer, void(graphics::BufferID));
     MOCK_METHOD1(associate_buffer, void(graphics::BufferID));
     MOCK_METHOD1(set_scale, void(float));
+    MOCK_METHOD2(set_viewport, void(
+        std::experimental::optional<geometry::Rectangle> const&,
+        std::experimental::optional<geometry::Size> const&));
 
 };
 }
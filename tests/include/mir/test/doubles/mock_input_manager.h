@@ -37,6 +37,8 @@ struct MockInputManager : public input::InputManager
     MOCK_METHOD0(stop, void());
     MOCK_METHOD0(pause_for_config, void());
     MOCK_METHOD0(continue_after_config, void());
+    MOCK_METHOD0(suspend_non_wake_devices, void());
+    MOCK_METHOD0(resume_non_wake_devices, void());
 };
 
 }
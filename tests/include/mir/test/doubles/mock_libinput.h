@@ -51,6 +51,9 @@ public:
     libinput_event* setup_button_event(libinput_device* dev, uint64_t event_time, int button, libinput_button_state state);
     libinput_event* setup_axis_event(libinput_device* dev, uint64_t event_time, double horizontal, double vertical);
     libinput_event* setup_finger_axis_event(libinput_device* dev, uint64_t event_time, double horizontal, double vertical);
+    libinput_event* setup_gesture_event(libinput_device* dev, libinput_event_type type, uint64_t event_time,
+                                        int finger_count, double dx, double dy, double scale, double angle_delta,
+                                        bool cancelled);
     libinput_event* setup_device_add_event(libinput_device* dev);
     libinput_event* setup_device_remove_event(libinput_device* dev);
 
@@ -65,6 +68,7 @@ public:
     MOCK_METHOD1(libinput_event_get_pointer_event, libinput_event_pointer*(libinput_event*));
     MOCK_METHOD1(libinput_event_get_keyboard_event, libinput_event_keyboard*(libinput_event*));
     MOCK_METHOD1(libinput_event_get_touch_event, libinput_event_touch*(libinput_event*));
+    MOCK_METHOD1(libinput_event_get_gesture_event, libinput_event_gesture*(libinput_event*));
 
     MOCK_METHOD1(libinput_event_keyboard_get_time, uint32_t(libinput_event_keyboard*));
     MOCK_METHOD1(libinput_event_keyboard_get_time_usec, uint64_t(libinput_event_keyboard*));
@@ -76,6 +80,8 @@ public:
     MOCK_METHOD1(libinput_event_pointer_get_time_usec, uint64_t(libinput_event_pointer*));
     MOCK_METHOD1(libinput_event_pointer_get_dx, double(libinput_event_pointer*));
     MOCK_METHOD1(libinput_event_pointer_get_dy, double(libinput_event_pointer*));
+    MOCK_METHOD1(libinput_event_pointer_get_dx_unaccelerated, double(libinput_event_pointer*));
+    MOCK_METHOD1(libinput_event_pointer_get_dy_unaccelerated, double(libinput_event_pointer*));
     MOCK_METHOD1(libinput_event_pointer_get_absolute_x, double(libinput_event_pointer*));
     MOCK_METHOD1(libinput_event_pointer_get_absolute_y, double(libinput_event_pointer*));
     MOCK_METHOD2(libinput_event_pointer_get_absolute_x_transformed, double(libinput_event_pointer*, uint32_t));
@@ -104,6 +110,14 @@ public:
     MOCK_METHOD3(libinput_event_touch_get_major_transformed, double(libinput_event_touch*, uint32_t, uint32_t));
     MOCK_METHOD1(libinput_event_touch_get_orientation, double(libinput_event_touch*));
 
+    MOCK_METHOD1(libinput_event_gesture_get_time_usec, uint64_t(libinput_event_gesture*));
+    MOCK_METHOD1(libinput_event_gesture_get_finger_count, int(libinput_event_gesture*));
+    MOCK_METHOD1(libinput_event_gesture_get_cancelled, int(libinput_event_gesture*));
+    MOCK_METHOD1(libinput_event_gesture_get_dx, double(libinput_event_gesture*));
+    MOCK_METHOD1(libinput_event_gesture_get_dy, double(libinput_event_gesture*));
+    MOCK_METHOD1(libinput_event_gesture_get_scale, double(libinput_event_gesture*));
+    MOCK_METHOD1(libinput_event_gesture_get_angle_delta, double(libinput_event_gesture*));
+
     MOCK_METHOD3(libinput_udev_create_context, libinput*(const libinput_interface *, void*, struct udev* udev));
     MOCK_METHOD2(libinput_udev_assign_seat, int(const libinput*, char const* seat));
     MOCK_METHOD2(libinput_path_create_context, libinput*(const libinput_interface *, void*));
@@ -35,6 +35,8 @@ struct MockRenderable : public graphics::Renderable
     {
         ON_CALL(*this, screen_position())
             .WillByDefault(testing::Return(geometry::Rectangle{{},{}}));
+        ON_CALL(*this, src_bounds())
+            .WillByDefault(testing::Return(geometry::Rectangle{{},{}}));
         ON_CALL(*this, clip_area())
             .WillByDefault(testing::Return(std::experimental::optional<geometry::Rectangle>()));
         ON_CALL(*this, buffer())
@@ -50,6 +52,7 @@ struct MockRenderable : public graphics::Renderable
     MOCK_CONST_METHOD0(id, ID());
     MOCK_CONST_METHOD0(buffer, std::shared_ptr<graphics::Buffer>());
     MOCK_CONST_METHOD0(screen_position, geometry::Rectangle());
+    MOCK_CONST_METHOD0(src_bounds, geometry::Rectangle());
     MOCK_CONST_METHOD0(clip_area, std::experimental::optional<geometry::Rectangle>());
     MOCK_CONST_METHOD0(alpha, float());
     MOCK_CONST_METHOD0(transformation, glm::mat4());
@@ -51,6 +51,11 @@ public:
         return geometry::Size();
     }
 
+    geometry::Rectangle src_bounds() override
+    {
+        return geometry::Rectangle();
+    }
+
     void allow_framedropping(bool) override
     {
     }
@@ -73,6 +78,9 @@ public:
     void set_frame_posted_callback(std::function<void(geometry::Size const&)> const&) override {}
     bool has_submitted_buffer() const override { return true; }
     void set_scale(float) override {}
+    void set_viewport(
+        std::experimental::optional<geometry::Rectangle> const&,
+        std::experimental::optional<geometry::Size> const&) override {}
 
     std::shared_ptr<graphics::Buffer> stub_compositor_buffer;
     int nready = 0;
@@ -74,6 +74,10 @@ public:
     {
         return rect;
     }
+    geometry::Rectangle src_bounds() const override
+    {
+        return {{}, rect.size};
+    }
     std::experimental::optional<geometry::Rectangle> clip_area() const override
     {
         return std::experimental::optional<geometry::Rectangle>();
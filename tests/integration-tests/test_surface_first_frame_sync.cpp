@@ -107,6 +107,10 @@ public:
         scene->remove_observer(observer);
     }
 
+    // The stub display never replaces its sync groups
+    void add_display_sync_group(mg::DisplaySyncGroup&) override {}
+    void remove_display_sync_group(mg::DisplaySyncGroup&) override {}
+
 private:
     std::shared_ptr<mg::Display> const display;
     std::shared_ptr<mc::DisplayListener> const display_listener;
@@ -176,6 +176,11 @@ void mtd::FakeAlarmFactory::advance_smoothly_by(mt::Duration step)
     }
 }
 
+auto mtd::FakeAlarmFactory::the_clock() const -> std::shared_ptr<mt::Clock>
+{
+    return clock;
+}
+
 int mtd::FakeAlarmFactory::wakeup_count() const
 {
     return std::accumulate(
@@ -178,6 +178,12 @@ void glUniform2f(GLint location, GLfloat x, GLfloat y)
     global_mock_gl->glUniform2f(location, x, y);
 }
 
+void glUniform4f(GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    CHECK_GLOBAL_VOID_MOCK();
+    global_mock_gl->glUniform4f(location, x, y, z, w);
+}
+
 void glBindBuffer(GLenum buffer, GLuint name)
 {
     CHECK_GLOBAL_VOID_MOCK();
@@ -134,6 +134,11 @@ libinput_event_touch* libinput_event_get_touch_event(libinput_event* event)
     return global_libinput->libinput_event_get_touch_event(event);
 }
 
+libinput_event_gesture* libinput_event_get_gesture_event(libinput_event* event)
+{
+    return global_libinput->libinput_event_get_gesture_event(event);
+}
+
 uint32_t libinput_event_keyboard_get_time(libinput_event_keyboard* event)
 {
     return global_libinput->libinput_event_keyboard_get_time(event);
@@ -179,6 +184,16 @@ double libinput_event_pointer_get_dy(libinput_event_pointer* event)
     return global_libinput->libinput_event_pointer_get_dy(event);
 }
 
+double libinput_event_pointer_get_dx_unaccelerated(libinput_event_pointer* event)
+{
+    return global_libinput->libinput_event_pointer_get_dx_unaccelerated(event);
+}
+
+double libinput_event_pointer_get_dy_unaccelerated(libinput_event_pointer* event)
+{
+    return global_libinput->libinput_event_pointer_get_dy_unaccelerated(event);
+}
+
 double libinput_event_pointer_get_absolute_x(libinput_event_pointer* event)
 {
     return global_libinput->libinput_event_pointer_get_absolute_x(event);
@@ -249,6 +264,41 @@ uint64_t libinput_event_touch_get_time_usec(libinput_event_touch* event)
     return global_libinput->libinput_event_touch_get_time_usec(event);
 }
 
+uint64_t libinput_event_gesture_get_time_usec(libinput_event_gesture* event)
+{
+    return global_libinput->libinput_event_gesture_get_time_usec(event);
+}
+
+int libinput_event_gesture_get_finger_count(libinput_event_gesture* event)
+{
+    return global_libinput->libinput_event_gesture_get_finger_count(event);
+}
+
+int libinput_event_gesture_get_cancelled(libinput_event_gesture* event)
+{
+    return global_libinput->libinput_event_gesture_get_cancelled(event);
+}
+
+double libinput_event_gesture_get_dx(libinput_event_gesture* event)
+{
+    return global_libinput->libinput_event_gesture_get_dx(event);
+}
+
+double libinput_event_gesture_get_dy(libinput_event_gesture* event)
+{
+    return global_libinput->libinput_event_gesture_get_dy(event);
+}
+
+double libinput_event_gesture_get_scale(libinput_event_gesture* event)
+{
+    return global_libinput->libinput_event_gesture_get_scale(event);
+}
+
+double libinput_event_gesture_get_angle_delta(libinput_event_gesture* event)
+{
+    return global_libinput->libinput_event_gesture_get_angle_delta(event);
+}
+
 int32_t libinput_event_touch_get_slot(libinput_event_touch* event)
 {
     return global_libinput->libinput_event_touch_get_slot(event);
@@ -754,6 +804,10 @@ libinput_event* mtd::MockLibInput::setup_pointer_event(libinput_device* dev, uin
         .WillByDefault(Return(relatve_x));
     ON_CALL(*this, libinput_event_pointer_get_dy(pointer_event))
         .WillByDefault(Return(relatve_y));
+    ON_CALL(*this, libinput_event_pointer_get_dx_unaccelerated(pointer_event))
+        .WillByDefault(Return(relatve_x));
+    ON_CALL(*this, libinput_event_pointer_get_dy_unaccelerated(pointer_event))
+        .WillByDefault(Return(relatve_y));
     return event;
 }
 
@@ -853,6 +907,37 @@ libinput_event* mtd::MockLibInput::setup_finger_axis_event(libinput_device* dev,
     return event;
 }
 
+libinput_event* mtd::MockLibInput::setup_gesture_event(libinput_device* dev, libinput_event_type type,
+                                                       uint64_t event_time, int finger_count, double dx, double dy,
+                                                       double scale, double angle_delta, bool cancelled)
+{
+    auto event = get_next_fake_ptr<libinput_event*>();
+    auto gesture_event = reinterpret_cast<libinput_event_gesture*>(event);
+    push_back(event);
+
+    ON_CALL(*this, libinput_event_get_type(event))
+        .WillByDefault(Return(type));
+    ON_CALL(*this, libinput_event_get_device(event))
+        .WillByDefault(Return(dev));
+    ON_CALL(*this, libinput_event_get_gesture_event(event))
+        .WillByDefault(Return(gesture_event));
+    ON_CALL(*this, libinput_event_gesture_get_time_usec(gesture_event))
+        .WillByDefault(Return(event_time));
+    ON_CALL(*this, libinput_event_gesture_get_finger_count(gesture_event))
+        .WillByDefault(Return(finger_count));
+    ON_CALL(*this, libinput_event_gesture_get_cancelled(gesture_event))
+        .WillByDefault(Return(cancelled));
+    ON_CALL(*this, libinput_event_gesture_get_dx(gesture_event))
+        .WillByDefault(Return(dx));
+    ON_CALL(*this, libinput_event_gesture_get_dy(gesture_event))
+        .WillByDefault(Return(dy));
+    ON_CALL(*this, libinput_event_gesture_get_scale(gesture_event))
+        .WillByDefault(Return(scale));
+    ON_CALL(*this, libinput_event_gesture_get_angle_delta(gesture_event))
+        .WillByDefault(Return(angle_delta));
+    return event;
+}
+
 libinput_event* mtd::MockLibInput::setup_device_add_event(libinput_device* dev)
 {
     auto event = get_next_fake_ptr<libinput_event*>();
@@ -80,6 +80,14 @@ void mtf::StubInputPlatform::continue_after_config()
 {
 }
 
+void mtf::StubInputPlatform::suspend_non_wake_devices()
+{
+}
+
+void mtf::StubInputPlatform::resume_non_wake_devices()
+{
+}
+
 void mtf::StubInputPlatform::add(std::shared_ptr<mir::input::InputDevice> const& dev)
 {
     auto input_platform = stub_input_platform.load();
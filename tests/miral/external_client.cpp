@@ -25,6 +25,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <fstream>
+
+#include <sys/wait.h>
 #include <miral/x11_support.h>
 
 using namespace testing;
@@ -223,3 +225,29 @@ TEST_F(ExternalClient, another_strange_override_does_nothing)
     EXPECT_THAT(client_env_x11_value("NO_AT_BRIDGE"), StrEq("1"));
     EXPECT_THAT(client_env_x11_value("_JAVA_AWT_WM_NONREPARENTING"), StrEq("1"));
 }
+
+TEST_F(ExternalClient, launched_client_is_a_waitable_child)
+{
+    if (getenv("XDG_RUNTIME_DIR") == nullptr)
+        add_to_environment("XDG_RUNTIME_DIR", "/tmp");
+
+    start_server();
+
+    external_client.launch({"bash", "-c", "exit 42"});
+
+    int status;
+    ASSERT_THAT(waitpid(external_client.pid(), &status, 0), Eq(external_client.pid()));
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_THAT(WEXITSTATUS(status), Eq(42));
+}
+
+TEST_F(ExternalClient, failure_to_launch_client_is_reported_without_throwing)
+{
+    if (getenv("XDG_RUNTIME_DIR") == nullptr)
+        add_to_environment("XDG_RUNTIME_DIR", "/tmp");
+
+    start_server();
+
+    EXPECT_NO_THROW(external_client.launch({"/nonexistent/path/to/client"}));
+    EXPECT_THAT(external_client.pid(), Eq(-1));
+}
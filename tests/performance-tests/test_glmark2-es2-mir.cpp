@@ -17,18 +17,26 @@
 #include "mir_test_framework/async_server_runner.h"
 #include "mir/test/popen.h"
 #include <mir_test_framework/executable_path.h>
+#include <mir/logging/logger.h>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <cstdio>
 #include <fstream>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace mo = mir::options;
+namespace ml = mir::logging;
 namespace mtf = mir_test_framework;
 
+using namespace std::literals::chrono_literals;
+
 namespace
 {
 struct AbstractGLMark2Test : testing::Test, mtf::AsyncServerRunner {
@@ -94,15 +102,56 @@ struct AbstractGLMark2Test : testing::Test, mtf::AsyncServerRunner {
     }
 };
 
+/// Collects the MapRequest to first frame latencies the X11 window manager logs (verbosely)
+class MapLatencyLogger : public ml::Logger
+{
+public:
+    using ml::Logger::log;
+
+    void log(ml::Severity, std::string const& message, std::string const&) override
+    {
+        auto const report = message.find(" showed its first frame ");
+        float ms;
+        if (report != std::string::npos &&
+            sscanf(message.c_str() + report, " showed its first frame %fms after its map request", &ms) == 1)
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            latencies_.push_back(std::chrono::duration<float, std::milli>{ms});
+        }
+    }
+
+    auto latencies() const -> std::vector<std::chrono::duration<float, std::milli>>
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        return latencies_;
+    }
+
+private:
+    std::mutex mutable mutex;
+    std::vector<std::chrono::duration<float, std::milli>> latencies_;
+};
+
 struct GLMark2Xwayland : AbstractGLMark2Test
 {
+    GLMark2Xwayland()
+    {
+        add_to_environment("MIR_SERVER_ENABLE_X11", "1");
+        add_to_environment("MIR_X11_VERBOSE_LOG", "1");
+        server.override_the_logger([this]() { return map_latency_logger; });
+    }
+
     char const* command() override
     {
         static auto command = mir_test_framework::executable_path() + "/miral-xrun -Xwayland glmark2-es2";
         return command.c_str();
     }
+
+    std::shared_ptr<MapLatencyLogger> const map_latency_logger{std::make_shared<MapLatencyLogger>()};
 };
 
+/// Generous: this covers the client's first render, not just the window manager's work
+auto const max_map_to_first_frame = 250ms;
+
 struct GLMark2Wayland : AbstractGLMark2Test
 {
     GLMark2Wayland()
@@ -137,6 +186,17 @@ TEST_F(GLMark2Wayland, windowed)
     EXPECT_THAT(run_glmark2(""), ::testing::Ge(100));
 }
 
+TEST_F(GLMark2Xwayland, map_request_to_first_frame_latency)
+{
+    run_glmark2("");
+
+    auto const latencies = map_latency_logger->latencies();
+    ASSERT_FALSE(latencies.empty()) << "No X window showed a frame";
+    auto const worst = *std::max_element(latencies.begin(), latencies.end());
+    printf("Worst MapRequest to first frame latency: %.1fms\n", worst.count());
+    EXPECT_THAT(worst, ::testing::Le(max_map_to_first_frame));
+}
+
 TEST_F(GLMark2Xwayland, fullscreen_default)
 {
     EXPECT_THAT(run_glmark2("--fullscreen"), ::testing::Ge(56));
@@ -0,0 +1,192 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "system_performance_test.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std::literals::chrono_literals;
+using namespace mir::test;
+
+namespace
+{
+/// Subsystems are reported in this order each period, so a report of the last one ends the round
+char const* const last_subsystem_reported = "xwayland";
+
+int const pairs_of_clients{5};
+
+struct Sample
+{
+    size_t bytes_in_use;
+    size_t bytes_per_second;
+};
+
+/**
+ * Each subsystem's steady-state footprint with pairs_of_clients pairs of clients running.
+ * When a deliberate change moves these, update them from the table the test prints.
+ */
+std::map<std::string, Sample> const baseline{
+    {"compositor",        {  768 << 10,  256 << 10}},
+    {"renderer",          { 1536 << 10,  128 << 10}},
+    {"wayland",           { 3072 << 10, 1024 << 10}},
+    {"window_management", {  384 << 10,   16 << 10}},
+    {"input",             {  256 << 10,    8 << 10}},
+    {"decorations",       {   64 << 10,    4 << 10}},
+    {"xwayland",          {   16 << 10,    4 << 10}},
+    {"other",             {16384 << 10,  512 << 10}}};
+
+/// A subsystem may exceed its baseline (for bytes in use and for the allocation rate) by this factor...
+double const margin{1.25};
+/// ...plus this much, so subsystems that barely allocate are not held to zero
+size_t const slack{64 << 10};
+
+/**
+ * Independently of the baseline, the steady state is checked against the idle server and the
+ * server with one pair of clients measured earlier in the same run. With N pairs a subsystem
+ * may use its idle figure plus N times what one pair added, with this margin (and the slack above)
+ */
+double const scaling_margin{1.5};
+
+/// How much a subsystem's heap may grow between the last two reports once the clients are running
+size_t const max_steady_state_growth{64 << 10};
+
+using Round = std::map<std::string, Sample>;
+
+struct MemoryFootprint : SystemPerformanceTest
+{
+    void SetUp() override
+    {
+        // Only the server gets the accounting allocator: clients are spawned after it starts
+        setenv("LD_PRELOAD", MIR_HEAP_ACCOUNTING_LIBRARY, 1);
+        SystemPerformanceTest::set_up_with("--heap-accounting-period=1");
+        unsetenv("LD_PRELOAD");
+    }
+
+    void spawn_pair_of_clients()
+    {
+        spawn_clients({"mir_demo_client_wayland", "mir_demo_client_wayland_egl_spinner"});
+    }
+
+    /// Reads the server's heap reports until a round is complete, or the server exits
+    auto read_round() -> Round
+    {
+        Round round;
+        char line[256];
+        while (fgets(line, sizeof(line), server_output))
+        {
+            if (char const* report = strstr(line, "heap: "))
+            {
+                char subsystem[32];
+                Sample sample;
+                if (3 == sscanf(report, "heap: %31[^:]: %zu bytes in %*u blocks, allocating %zu bytes/s",
+                                subsystem, &sample.bytes_in_use, &sample.bytes_per_second))
+                {
+                    round[subsystem] = sample;
+                    if (strcmp(subsystem, last_subsystem_reported) == 0)
+                        break;
+                }
+            }
+        }
+        return round;
+    }
+
+    /// Skips the round in progress, and the next to let things settle, then reads one
+    auto read_settled_round() -> Round
+    {
+        read_round();
+        read_round();
+        return read_round();
+    }
+
+    /// Reads the complete rounds reported until the server exits
+    auto read_remaining_rounds(size_t subsystems) -> std::vector<Round>
+    {
+        std::vector<Round> rounds;
+        for (auto round = read_round(); round.size() == subsystems; round = read_round())
+            rounds.push_back(round);
+        return rounds;
+    }
+
+    static auto within_margin(size_t expected) -> size_t
+    {
+        return static_cast<size_t>(margin * expected) + slack;
+    }
+
+    static auto scaled_from(size_t idle, size_t one_pair) -> size_t
+    {
+        auto const per_pair = one_pair > idle ? one_pair - idle : 0;
+        return idle + static_cast<size_t>(scaling_margin * per_pair * pairs_of_clients) + slack;
+    }
+
+    /// Prints a round in the form of the baseline table, for updating it
+    static void print_as_baseline(Round const& round)
+    {
+        printf("Measured steady state:\n");
+        for (auto const& subsystem : round)
+        {
+            printf("    {\"%s\", {%zu, %zu}},\n",
+                   subsystem.first.c_str(), subsystem.second.bytes_in_use, subsystem.second.bytes_per_second);
+        }
+    }
+};
+} // anonymous namespace
+
+TEST_F(MemoryFootprint, subsystems_stay_within_heap_budget)
+{
+    auto const idle = read_settled_round();
+    ASSERT_FALSE(idle.empty()) << "No heap reports: is " MIR_HEAP_ACCOUNTING_LIBRARY " preloaded?";
+
+    spawn_pair_of_clients();
+    auto const one_pair = read_settled_round();
+    ASSERT_EQ(idle.size(), one_pair.size());
+
+    for (auto i = 1; i != pairs_of_clients; ++i)
+        spawn_pair_of_clients();
+    run_server_for(10s);
+
+    auto const rounds = read_remaining_rounds(idle.size());
+    ASSERT_GE(rounds.size(), 2u);
+    auto const& steady_state = rounds.back();
+    auto const& previous = rounds[rounds.size() - 2];
+
+    for (auto const& subsystem : steady_state)
+    {
+        auto const& name = subsystem.first;
+        auto const& sample = subsystem.second;
+        SCOPED_TRACE(name);
+        ASSERT_EQ(1u, baseline.count(name)) << "New subsystems need a baseline";
+        ASSERT_EQ(1u, idle.count(name));
+        ASSERT_EQ(1u, one_pair.count(name));
+
+        EXPECT_LE(sample.bytes_in_use, within_margin(baseline.at(name).bytes_in_use));
+        EXPECT_LE(sample.bytes_per_second, within_margin(baseline.at(name).bytes_per_second));
+
+        EXPECT_LE(sample.bytes_in_use,
+                  scaled_from(idle.at(name).bytes_in_use, one_pair.at(name).bytes_in_use));
+        EXPECT_LE(sample.bytes_per_second,
+                  scaled_from(idle.at(name).bytes_per_second, one_pair.at(name).bytes_per_second));
+
+        EXPECT_LT(sample.bytes_in_use, previous.at(name).bytes_in_use + max_steady_state_growth);
+    }
+
+    if (HasFailure())
+        print_as_baseline(steady_state);
+}
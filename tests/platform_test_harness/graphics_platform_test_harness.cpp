@@ -481,6 +481,11 @@ void basic_software_buffer_drawing(
             return mir::geometry::Rectangle{top_left, buffer()->size()};
         }
 
+        auto src_bounds() const -> mir::geometry::Rectangle override
+        {
+            return mir::geometry::Rectangle{{0, 0}, buffer()->size()};
+        }
+
         auto alpha() const -> float override
         {
             return 1.0f;
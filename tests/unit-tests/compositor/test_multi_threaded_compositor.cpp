@@ -24,6 +24,7 @@
 #include "mir/compositor/scene.h"
 #include "mir/compositor/display_buffer_compositor_factory.h"
 #include "mir/scene/observer.h"
+#include "mir/graphics/display_configuration_observer.h"
 #include "mir/raii.h"
 
 #include "mir/test/current_thread_name.h"
@@ -264,6 +265,14 @@ public:
         return true;
     }
 
+    unsigned int record_count_for(mg::DisplayBuffer& display_buffer)
+    {
+        std::lock_guard<std::mutex> lk{m};
+
+        auto const record = records.find(&display_buffer);
+        return record == records.end() ? 0 : record->second.first;
+    }
+
 private:
     std::mutex m;
     typedef std::pair<unsigned int, std::unordered_set<std::thread::id>> Record;
@@ -948,3 +957,92 @@ TEST(MultiThreadedCompositor, can_schedule_from_display_observer_when_removing_d
         display, stub_scene, db_compositor_factory, mock_display_listener, mock_report, default_delay, true};
     compositor.start();
 }
+
+TEST(MultiThreadedCompositor, parks_compositing_for_powered_off_outputs_until_they_are_powered_on)
+{
+    using namespace testing;
+
+    std::vector<geom::Rectangle> const rects{{{0, 0}, {640, 480}}, {{640, 0}, {640, 480}}};
+    auto display = std::make_shared<mtd::StubDisplay>(rects);
+    auto scene = std::make_shared<StubScene>();
+    auto db_compositor_factory = std::make_shared<RecordingDisplayBufferCompositorFactory>();
+    mc::MultiThreadedCompositor compositor{display, scene, db_compositor_factory, null_display_listener, null_report, default_delay, true};
+
+    std::vector<mg::DisplayBuffer*> buffers;
+    display->for_each_display_sync_group([&](mg::DisplaySyncGroup& group)
+        { group.for_each_display_buffer([&](mg::DisplayBuffer& buffer) { buffers.push_back(&buffer); }); });
+    ASSERT_THAT(buffers.size(), Eq(2u));
+    auto& lit_buffer = *buffers[0];
+    auto& off_buffer = *buffers[1];
+
+    compositor.start();
+
+    while (!db_compositor_factory->check_record_count_for_each_buffer(rects.size(), 1))
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    auto const config = std::make_shared<mtd::StubDisplayConfig>(rects);
+    config->outputs[1].power_mode = mir_power_mode_off;
+    compositor.display_configuration_observer()->configuration_applied(config);
+
+    auto const off_count = db_compositor_factory->record_count_for(off_buffer);
+
+    for (auto i = 1u; i <= 3; ++i)
+    {
+        scene->emit_change_event();
+        while (db_compositor_factory->record_count_for(lit_buffer) < 1 + i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_THAT(db_compositor_factory->record_count_for(off_buffer), Eq(off_count));
+
+    // Powering on again composites a fresh frame, without any scene change
+    config->outputs[1].power_mode = mir_power_mode_on;
+    compositor.display_configuration_observer()->configuration_applied(config);
+
+    while (db_compositor_factory->record_count_for(off_buffer) <= off_count)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    compositor.stop();
+}
+
+TEST(MultiThreadedCompositor, adds_and_removes_sync_groups_while_other_outputs_keep_compositing)
+{
+    using namespace testing;
+
+    auto display = std::make_shared<mtd::StubDisplay>(std::vector<geom::Rectangle>{{{0, 0}, {640, 480}}});
+    auto scene = std::make_shared<StubScene>();
+    auto db_compositor_factory = std::make_shared<RecordingDisplayBufferCompositorFactory>();
+    mc::MultiThreadedCompositor compositor{display, scene, db_compositor_factory, null_display_listener, null_report, default_delay, true};
+
+    mg::DisplayBuffer* existing_buffer{nullptr};
+    display->for_each_display_sync_group([&](mg::DisplaySyncGroup& group)
+        { group.for_each_display_buffer([&](mg::DisplayBuffer& buffer) { existing_buffer = &buffer; }); });
+    ASSERT_THAT(existing_buffer, NotNull());
+
+    mtd::StubDisplaySyncGroup added_group{{geom::Rectangle{{640, 0}, {640, 480}}}};
+    mg::DisplayBuffer* added_buffer{nullptr};
+    added_group.for_each_display_buffer([&](mg::DisplayBuffer& buffer) { added_buffer = &buffer; });
+
+    compositor.start();
+
+    while (db_compositor_factory->record_count_for(*existing_buffer) < 1)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    compositor.add_display_sync_group(added_group);
+
+    // A new group composites a first frame without waiting for a scene change
+    while (db_compositor_factory->record_count_for(*added_buffer) < 1)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    compositor.remove_display_sync_group(added_group);
+    auto const removed_count = db_compositor_factory->record_count_for(*added_buffer);
+    auto const existing_count = db_compositor_factory->record_count_for(*existing_buffer);
+
+    scene->emit_change_event();
+    while (db_compositor_factory->record_count_for(*existing_buffer) <= existing_count)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    EXPECT_THAT(db_compositor_factory->record_count_for(*added_buffer), Eq(removed_count));
+
+    compositor.stop();
+}
@@ -203,6 +203,37 @@ TEST_F(Stream, reports_size)
     EXPECT_THAT(stream.stream_size(), Eq(new_size));
 }
 
+TEST_F(Stream, viewport_crops_and_scales_buffers)
+{
+    geom::Rectangle const source{{10, 20}, {1920, 1080}};
+    geom::Size const destination{3840, 2160};
+    auto const buffer = std::make_shared<mtd::StubBuffer>(geom::Size{1940, 1100});
+
+    stream.set_viewport(source, destination);
+    stream.submit_buffer(buffer);
+
+    EXPECT_THAT(stream.src_bounds(), Eq(source));
+    EXPECT_THAT(stream.stream_size(), Eq(destination));
+}
+
+TEST_F(Stream, viewport_source_alone_sets_size)
+{
+    geom::Rectangle const source{{1, 1}, {20, 1}};
+
+    stream.set_viewport(source, {});
+
+    EXPECT_THAT(stream.src_bounds(), Eq(source));
+    EXPECT_THAT(stream.stream_size(), Eq(source.size));
+}
+
+TEST_F(Stream, without_viewport_shows_whole_buffer)
+{
+    stream.submit_buffer(buffers[0]);
+
+    EXPECT_THAT(stream.src_bounds(), Eq(geom::Rectangle{{}, initial_size}));
+    EXPECT_THAT(stream.stream_size(), Eq(initial_size));
+}
+
 //Likewise, no reason buffers couldn't all be a different pixel format
 TEST_F(Stream, reports_format)
 {
@@ -0,0 +1,153 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/graphics/frame_timing_tracker.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+namespace mg = mir::graphics;
+namespace mt = mir::time;
+
+using namespace testing;
+using namespace std::chrono_literals;
+
+namespace
+{
+auto frame(int64_t msc, std::chrono::nanoseconds ust) -> mg::Frame
+{
+    mg::Frame result;
+    result.msc = msc;
+    result.ust = mt::PosixTimestamp{CLOCK_MONOTONIC, ust};
+    return result;
+}
+
+auto at(std::chrono::nanoseconds t) -> mt::PosixTimestamp
+{
+    return mt::PosixTimestamp{CLOCK_MONOTONIC, t};
+}
+
+struct FrameTimingTracker : Test
+{
+    mg::FrameTimingTracker tracker;
+    unsigned int const output{1};
+    unsigned int const other_output{2};
+};
+}
+
+TEST_F(FrameTimingTracker, knows_nothing_before_frames_are_presented)
+{
+    EXPECT_FALSE(tracker.next_frame_after(at(1s)));
+}
+
+TEST_F(FrameTimingTracker, knows_nothing_from_a_single_frame)
+{
+    tracker.frame_presented(output, frame(1, 1s));
+
+    EXPECT_FALSE(tracker.next_frame_after(at(1s + 1ms)));
+}
+
+TEST_F(FrameTimingTracker, predicts_next_frame_from_period_and_phase)
+{
+    tracker.frame_presented(output, frame(1, 1s));
+    tracker.frame_presented(output, frame(2, 1s + 10ms));
+
+    auto const next = tracker.next_frame_after(at(1s + 13ms));
+
+    ASSERT_TRUE(next);
+    EXPECT_THAT(next.value().nanoseconds, Eq(1s + 20ms));
+}
+
+TEST_F(FrameTimingTracker, extrapolates_over_frames_not_presented)
+{
+    tracker.frame_presented(output, frame(1, 1s));
+    tracker.frame_presented(output, frame(5, 1s + 40ms));
+
+    auto const next = tracker.next_frame_after(at(1s + 95ms));
+
+    ASSERT_TRUE(next);
+    EXPECT_THAT(next.value().nanoseconds, Eq(1s + 100ms));
+}
+
+TEST_F(FrameTimingTracker, next_frame_is_strictly_after_the_given_time)
+{
+    tracker.frame_presented(output, frame(1, 1s));
+    tracker.frame_presented(output, frame(2, 1s + 10ms));
+
+    auto const next = tracker.next_frame_after(at(1s + 30ms));
+
+    ASSERT_TRUE(next);
+    EXPECT_THAT(next.value().nanoseconds, Eq(1s + 40ms));
+}
+
+TEST_F(FrameTimingTracker, follows_the_fastest_output)
+{
+    tracker.frame_presented(output, frame(1, 1s));
+    tracker.frame_presented(output, frame(2, 1s + 16ms));
+    tracker.frame_presented(other_output, frame(1, 1s + 1ms));
+    tracker.frame_presented(other_output, frame(2, 1s + 9ms));
+
+    auto const next = tracker.next_frame_after(at(1s + 10ms));
+
+    ASSERT_TRUE(next);
+    EXPECT_THAT(next.value().nanoseconds, Eq(1s + 17ms));
+}
+
+TEST_F(FrameTimingTracker, ignores_outputs_that_stopped_presenting_long_ago)
+{
+    tracker.frame_presented(output, frame(1, 1s));
+    tracker.frame_presented(output, frame(2, 1s + 10ms));
+
+    EXPECT_FALSE(tracker.next_frame_after(at(10s)));
+}
+
+TEST_F(FrameTimingTracker, forgets_period_when_frame_counter_restarts)
+{
+    tracker.frame_presented(output, frame(100, 1s));
+    tracker.frame_presented(output, frame(101, 1s + 10ms));
+    tracker.frame_presented(output, frame(1, 1s + 50ms));
+
+    EXPECT_FALSE(tracker.next_frame_after(at(1s + 55ms)));
+}
+
+TEST_F(FrameTimingTracker, display_report_passes_vsyncs_on)
+{
+    struct StubDisplayReport : mg::DisplayReport
+    {
+        void report_successful_setup_of_native_resources() override {}
+        void report_successful_egl_make_current_on_construction() override {}
+        void report_successful_egl_buffer_swap_on_construction() override {}
+        void report_successful_display_construction() override {}
+        void report_egl_configuration(EGLDisplay, EGLConfig) override {}
+        void report_vsync(unsigned int, mg::Frame const&) override { ++vsyncs; }
+        void report_successful_drm_mode_set_crtc_on_construction() override {}
+        void report_drm_master_failure(int) override {}
+        void report_vt_switch_away_failure() override {}
+        void report_vt_switch_back_failure() override {}
+
+        int vsyncs{0};
+    };
+
+    auto const wrapped = std::make_shared<StubDisplayReport>();
+    auto const shared_tracker = std::make_shared<mg::FrameTimingTracker>();
+    mg::FrameTimingDisplayReport report{wrapped, shared_tracker};
+
+    report.report_vsync(output, frame(1, 1s));
+    report.report_vsync(output, frame(2, 1s + 10ms));
+
+    EXPECT_THAT(wrapped->vsyncs, Eq(2));
+    EXPECT_TRUE(shared_tracker->next_frame_after(at(1s + 15ms)));
+}
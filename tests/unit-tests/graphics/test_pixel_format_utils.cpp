@@ -118,3 +118,17 @@ TEST(MirPixelFormatUtils, valid_mir_pixel_format)
     EXPECT_FALSE(valid_pixel_format(mir_pixel_format_invalid));
     EXPECT_FALSE(valid_pixel_format(mir_pixel_formats));
 }
+
+TEST(MirPixelFormatUtils, yuv_formats)
+{
+    EXPECT_TRUE(is_yuv(mir_pixel_format_nv12));
+    EXPECT_TRUE(is_yuv(mir_pixel_format_yuyv));
+    EXPECT_TRUE(is_yuv(mir_pixel_format_i420));
+    EXPECT_FALSE(is_yuv(mir_pixel_format_xrgb_8888));
+    EXPECT_FALSE(is_yuv(mir_pixel_format_invalid));
+    EXPECT_FALSE(is_yuv(mir_pixel_formats));
+
+    EXPECT_TRUE(valid_pixel_format(mir_pixel_format_nv12));
+    EXPECT_FALSE(contains_alpha(mir_pixel_format_nv12));
+    EXPECT_EQ(8, red_channel_depth(mir_pixel_format_i420));
+}
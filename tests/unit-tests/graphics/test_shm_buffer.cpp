@@ -88,6 +88,8 @@ struct PlatformlessShmBuffer : mgc::MemoryBackedShmBuffer
         return buffer;
     }
 
+    using MemoryBackedShmBuffer::upload_to_texture;
+
     std::shared_ptr<mg::NativeBuffer> native_buffer_handle() const override
     {
         return nullptr;
@@ -280,6 +282,9 @@ std::string to_string(MirPixelFormat format)
         ENUM_TO_STR(mir_pixel_format_rgb_565);
         ENUM_TO_STR(mir_pixel_format_rgba_5551);
         ENUM_TO_STR(mir_pixel_format_rgba_4444);
+        ENUM_TO_STR(mir_pixel_format_nv12);
+        ENUM_TO_STR(mir_pixel_format_yuyv);
+        ENUM_TO_STR(mir_pixel_format_i420);
 #undef ENUM_TO_STR
     default:
         return "UNKNOWN MirPixelFormat";
@@ -362,3 +367,35 @@ TEST_F(ShmBufferTest, texture_is_destroyed_on_thread_with_current_context)
         eglMakeCurrent(dummy_dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
     }
 }
+
+TEST_F(ShmBufferTest, supports_only_packed_yuv)
+{
+    EXPECT_TRUE(mgc::ShmBuffer::supports(mir_pixel_format_yuyv));
+    EXPECT_FALSE(mgc::ShmBuffer::supports(mir_pixel_format_nv12));
+    EXPECT_FALSE(mgc::ShmBuffer::supports(mir_pixel_format_i420));
+}
+
+TEST_F(ShmBufferTest, uploads_yuyv_as_luma_and_chroma_views)
+{
+    geom::Size const yuyv_size{64, 48};
+    PlatformlessShmBuffer buf{yuyv_size, mir_pixel_format_yuyv, egl_delegate};
+    auto const pixels = buf.pixel_buffer();
+
+    EXPECT_CALL(mock_gl, glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE_ALPHA, 64, 48, 0,
+                                      GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, pixels));
+    EXPECT_CALL(mock_gl, glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 32, 48, 0,
+                                      GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+
+    buf.upload_to_texture(pixels, buf.stride());
+}
+
+TEST_F(ShmBufferTest, binds_a_texture_per_yuyv_view)
+{
+    geom::Size const yuyv_size{64, 48};
+    PlatformlessShmBuffer buf{yuyv_size, mir_pixel_format_yuyv, egl_delegate};
+
+    EXPECT_CALL(mock_gl, glGenTextures(2, _));
+    EXPECT_CALL(mock_gl, glBindTexture(GL_TEXTURE_2D, _)).Times(2);
+
+    buf.ShmBuffer::bind();
+}
@@ -97,6 +97,21 @@ struct MockEventBuilder : mi::EventBuilder
                                        return builder.pointer_event(time, action, buttons, x, y,
                                                                     hscroll, vscroll, relative_x, relative_y);
                                   }));
+        ON_CALL(*this, pointer_motion_event(_, _, _, _, _, _))
+            .WillByDefault(Invoke([this](Timestamp time, MirPointerButtons buttons, float relative_x,
+                                         float relative_y, float unaccelerated_x, float unaccelerated_y)
+                                  {
+                                       return builder.pointer_motion_event(time, buttons, relative_x, relative_y,
+                                                                           unaccelerated_x, unaccelerated_y);
+                                  }));
+        ON_CALL(*this, touchpad_gesture_event(_, _, _, _, _, _, _, _, _))
+            .WillByDefault(Invoke([this](Timestamp time, MirTouchpadGesture gesture, MirTouchpadGestureAction action,
+                                         unsigned int fingers, float dx, float dy, float scale, float rotation,
+                                         bool cancelled)
+                                  {
+                                       return builder.touchpad_gesture_event(time, gesture, action, fingers,
+                                                                             dx, dy, scale, rotation, cancelled);
+                                  }));
     }
     using EventBuilder::Timestamp;
     MOCK_METHOD4(key_event, mir::EventUPtr(Timestamp, MirKeyboardAction, xkb_keysym_t, int));
@@ -107,6 +122,11 @@ struct MockEventBuilder : mi::EventBuilder
     MOCK_METHOD9(
         pointer_event,
         mir::EventUPtr(Timestamp, MirPointerAction, MirPointerButtons, float, float, float, float, float, float));
+    MOCK_METHOD6(pointer_motion_event,
+                 mir::EventUPtr(Timestamp, MirPointerButtons, float, float, float, float));
+    MOCK_METHOD9(touchpad_gesture_event,
+                 mir::EventUPtr(Timestamp, MirTouchpadGesture, MirTouchpadGestureAction, unsigned int,
+                                float, float, float, float, bool));
     mir::EventUPtr device_state_event(float, float) override
     {
         return {nullptr,[](MirEvent*){}};
@@ -408,6 +428,27 @@ TEST_F(LibInputDeviceOnMouse, process_event_converts_pointer_event)
     process_events(mouse);
 }
 
+TEST_F(LibInputDeviceOnMouse, process_event_keeps_unaccelerated_pointer_motion)
+{
+    float const x_movement = 15;
+    float const y_movement = 17;
+    float const x_unaccelerated = 5;
+    float const y_unaccelerated = 6;
+
+    EXPECT_CALL(mock_sink, handle_input(AllOf(
+        mt::PointerEventWithDiff(x_movement, y_movement),
+        mt::PointerEventWithUnacceleratedDiff(x_unaccelerated, y_unaccelerated))));
+
+    mouse.start(&mock_sink, &mock_builder);
+    auto const event = env.mock_libinput.setup_pointer_event(fake_device, event_time_1, x_movement, y_movement);
+    auto const pointer_event = reinterpret_cast<libinput_event_pointer*>(event);
+    ON_CALL(env.mock_libinput, libinput_event_pointer_get_dx_unaccelerated(pointer_event))
+        .WillByDefault(Return(x_unaccelerated));
+    ON_CALL(env.mock_libinput, libinput_event_pointer_get_dy_unaccelerated(pointer_event))
+        .WillByDefault(Return(y_unaccelerated));
+    process_events(mouse);
+}
+
 TEST_F(LibInputDeviceOnMouse, process_event_handles_absolute_pointer_events)
 {
     float x1 = 15;
@@ -745,6 +786,55 @@ TEST_F(LibInputDeviceOnTouchpad, process_event_handles_scroll)
 
 }
 
+TEST_F(LibInputDeviceOnTouchpad, process_event_converts_swipe_gesture)
+{
+    InSequence seq;
+    EXPECT_CALL(mock_builder,
+                touchpad_gesture_event(time_stamp_1, mir_touchpad_gesture_swipe, mir_touchpad_gesture_action_begin,
+                                       3, 0.0f, 0.0f, 1.0f, 0.0f, false));
+    EXPECT_CALL(mock_builder,
+                touchpad_gesture_event(time_stamp_2, mir_touchpad_gesture_swipe, mir_touchpad_gesture_action_update,
+                                       3, 4.0f, -2.0f, 1.0f, 0.0f, false));
+    EXPECT_CALL(mock_builder,
+                touchpad_gesture_event(time_stamp_3, mir_touchpad_gesture_swipe, mir_touchpad_gesture_action_end,
+                                       3, 0.0f, 0.0f, 1.0f, 0.0f, false));
+
+    env.mock_libinput.setup_gesture_event(fake_device, LIBINPUT_EVENT_GESTURE_SWIPE_BEGIN, event_time_1, 3, 0, 0, 0, 0, false);
+    env.mock_libinput.setup_gesture_event(fake_device, LIBINPUT_EVENT_GESTURE_SWIPE_UPDATE, event_time_2, 3, 4, -2, 0, 0, false);
+    env.mock_libinput.setup_gesture_event(fake_device, LIBINPUT_EVENT_GESTURE_SWIPE_END, event_time_3, 3, 0, 0, 0, 0, false);
+    touchpad.start(&mock_sink, &mock_builder);
+    process_events(touchpad);
+}
+
+TEST_F(LibInputDeviceOnTouchpad, process_event_converts_pinch_gesture)
+{
+    InSequence seq;
+    EXPECT_CALL(mock_builder,
+                touchpad_gesture_event(time_stamp_1, mir_touchpad_gesture_pinch, mir_touchpad_gesture_action_begin,
+                                       2, 0.0f, 0.0f, 1.0f, 0.0f, false));
+    EXPECT_CALL(mock_builder,
+                touchpad_gesture_event(time_stamp_2, mir_touchpad_gesture_pinch, mir_touchpad_gesture_action_update,
+                                       2, 1.0f, 1.0f, 1.5f, 10.0f, false));
+    EXPECT_CALL(mock_builder,
+                touchpad_gesture_event(time_stamp_3, mir_touchpad_gesture_pinch, mir_touchpad_gesture_action_end,
+                                       2, 0.0f, 0.0f, 1.5f, 0.0f, true));
+
+    env.mock_libinput.setup_gesture_event(fake_device, LIBINPUT_EVENT_GESTURE_PINCH_BEGIN, event_time_1, 2, 0, 0, 1.0, 0, false);
+    env.mock_libinput.setup_gesture_event(fake_device, LIBINPUT_EVENT_GESTURE_PINCH_UPDATE, event_time_2, 2, 1, 1, 1.5, 10, false);
+    env.mock_libinput.setup_gesture_event(fake_device, LIBINPUT_EVENT_GESTURE_PINCH_END, event_time_3, 2, 0, 0, 1.5, 0, true);
+    touchpad.start(&mock_sink, &mock_builder);
+    process_events(touchpad);
+}
+
+TEST_F(LibInputDeviceOnTouchpad, gesture_events_reach_the_sink)
+{
+    EXPECT_CALL(mock_sink, handle_input(mt::TouchpadGestureEvent(mir_touchpad_gesture_swipe, mir_touchpad_gesture_action_begin)));
+
+    env.mock_libinput.setup_gesture_event(fake_device, LIBINPUT_EVENT_GESTURE_SWIPE_BEGIN, event_time_1, 3, 0, 0, 0, 0, false);
+    touchpad.start(&mock_sink, &mock_builder);
+    process_events(touchpad);
+}
+
 TEST_F(LibInputDeviceOnTouchpad, reads_touchpad_settings_from_libinput)
 {
     setup_touchpad_configuration(fake_device, mir_touchpad_click_mode_finger_count,
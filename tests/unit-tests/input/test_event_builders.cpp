@@ -130,6 +130,50 @@ TEST_F(InputEventBuilder, makes_valid_pointer_event)
     EXPECT_EQ(vscroll_value, mir_pointer_event_axis_value(pev, mir_pointer_axis_vscroll));
 }
 
+TEST_F(InputEventBuilder, makes_valid_touchpad_gesture_event)
+{
+    auto const gesture = mir_touchpad_gesture_pinch;
+    auto const action = mir_touchpad_gesture_action_update;
+    unsigned int const finger_count = 3;
+    float const dx = 2.5f, dy = -1.5f, scale = 1.25f, rotation = 4.0f;
+
+    auto ev = mev::make_touchpad_gesture_event(device_id, timestamp, modifiers,
+        gesture, action, finger_count, dx, dy, scale, rotation, false);
+    auto e = ev.get();
+
+    EXPECT_EQ(mir_event_type_input, mir_event_get_type(e));
+    auto ie = mir_event_get_input_event(e);
+    EXPECT_EQ(mir_input_event_type_touchpad_gesture, mir_input_event_get_type(ie));
+    EXPECT_EQ(device_id, mir_input_event_get_device_id(ie));
+    EXPECT_EQ(timestamp.count(), mir_input_event_get_event_time(ie));
+    auto gev = mir_input_event_get_touchpad_gesture_event(ie);
+    EXPECT_EQ(gesture, mir_touchpad_gesture_event_gesture(gev));
+    EXPECT_EQ(action, mir_touchpad_gesture_event_action(gev));
+    EXPECT_EQ(finger_count, mir_touchpad_gesture_event_finger_count(gev));
+    EXPECT_EQ(dx, mir_touchpad_gesture_event_dx(gev));
+    EXPECT_EQ(dy, mir_touchpad_gesture_event_dy(gev));
+    EXPECT_EQ(scale, mir_touchpad_gesture_event_scale(gev));
+    EXPECT_EQ(rotation, mir_touchpad_gesture_event_rotation(gev));
+    EXPECT_FALSE(mir_touchpad_gesture_event_cancelled(gev));
+    EXPECT_FALSE(mir_input_event_has_cookie(ie));
+}
+
+TEST_F(InputEventBuilder, touchpad_gesture_event_survives_serialization)
+{
+    auto ev = mev::make_touchpad_gesture_event(device_id, timestamp, modifiers,
+        mir_touchpad_gesture_swipe, mir_touchpad_gesture_action_end, 4, 0, 0, 1, 0, true);
+
+    auto deserialized = MirEvent::deserialize(MirEvent::serialize(ev.get()));
+
+    auto ie = mir_event_get_input_event(deserialized.get());
+    ASSERT_THAT(mir_input_event_get_type(ie), Eq(mir_input_event_type_touchpad_gesture));
+    auto gev = mir_input_event_get_touchpad_gesture_event(ie);
+    EXPECT_THAT(mir_touchpad_gesture_event_gesture(gev), Eq(mir_touchpad_gesture_swipe));
+    EXPECT_THAT(mir_touchpad_gesture_event_action(gev), Eq(mir_touchpad_gesture_action_end));
+    EXPECT_THAT(mir_touchpad_gesture_event_finger_count(gev), Eq(4u));
+    EXPECT_TRUE(mir_touchpad_gesture_event_cancelled(gev));
+}
+
 // The following three requirements can be removed as soon as we remove android::InputDispatcher, which is the
 // only remaining part that relies on the difference between mir_motion_action_pointer_{up,down} and
 // mir_motion_action_{up,down} and the difference between mir_motion_action_move and mir_motion_action_hover_move.
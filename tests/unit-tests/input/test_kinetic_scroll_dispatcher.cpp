@@ -0,0 +1,212 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/server/input/kinetic_scroll_dispatcher.h"
+
+#include "mir/events/event_builders.h"
+#include "mir/graphics/frame_timing.h"
+
+#include "mir/test/doubles/mock_input_dispatcher.h"
+#include "mir/test/doubles/fake_alarm_factory.h"
+#include "mir/test/fake_shared.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+namespace mi = mir::input;
+namespace mg = mir::graphics;
+namespace mev = mir::events;
+namespace mt = mir::test;
+namespace mtd = mir::test::doubles;
+
+using namespace testing;
+using namespace std::chrono_literals;
+
+namespace
+{
+MirInputDeviceId const touchpad{3};
+
+auto scroll(std::chrono::nanoseconds time, float vscroll) -> std::shared_ptr<MirEvent const>
+{
+    return mev::make_event(
+        touchpad, time, std::vector<uint8_t>{}, mir_input_event_modifier_none, mir_pointer_action_motion,
+        0, 100, 100, 0, vscroll, 0, 0);
+}
+
+auto motion(std::chrono::nanoseconds time) -> std::shared_ptr<MirEvent const>
+{
+    return mev::make_event(
+        touchpad, time, std::vector<uint8_t>{}, mir_input_event_modifier_none, mir_pointer_action_motion,
+        0, 101, 100, 0, 0, 1, 0);
+}
+
+auto vscroll_of(std::shared_ptr<MirEvent const> const& event) -> float
+{
+    auto const pev = mir_input_event_get_pointer_event(mir_event_get_input_event(event.get()));
+    return mir_pointer_event_axis_value(pev, mir_pointer_axis_vscroll);
+}
+
+struct StubFrameTiming : mg::FrameTiming
+{
+    auto next_frame_after(mir::time::PosixTimestamp const& t) const
+        -> mir::optional_value<mir::time::PosixTimestamp> override
+    {
+        if (!until_next_frame)
+            return {};
+        return mir::time::PosixTimestamp{t.clock_id, t.nanoseconds + until_next_frame.value()};
+    }
+
+    mir::optional_value<std::chrono::nanoseconds> until_next_frame;
+};
+
+struct KineticScrollDispatcher : Test
+{
+    NiceMock<mtd::MockInputDispatcher> next_dispatcher;
+    mtd::FakeAlarmFactory alarm_factory;
+    StubFrameTiming frame_timing;
+    std::chrono::milliseconds const tick{16};
+    mi::KineticScrollDispatcher dispatcher{
+        mt::fake_shared(next_dispatcher),
+        mt::fake_shared(alarm_factory),
+        alarm_factory.the_clock(),
+        mt::fake_shared(frame_timing),
+        tick};
+
+    std::vector<float> synthetic_scroll;
+
+    void SetUp() override
+    {
+        ON_CALL(next_dispatcher, dispatch(_)).WillByDefault(Return(true));
+    }
+
+    /// Scroll at 10ms intervals, then lift the fingers
+    void fast_finger_scroll()
+    {
+        for (auto i = 0; i != 5; ++i)
+            dispatcher.dispatch(scroll(i * 10ms, 2.0f));
+        dispatcher.dispatch(scroll(45ms, 0.0f));
+    }
+
+    void run_ticks(int count)
+    {
+        for (auto i = 0; i != count; ++i)
+            alarm_factory.advance_by(tick + 1ms);
+    }
+
+    void record_synthetic_scroll()
+    {
+        EXPECT_CALL(next_dispatcher, dispatch(_)).WillRepeatedly(Invoke(
+            [this](std::shared_ptr<MirEvent const> const& event)
+            {
+                synthetic_scroll.push_back(vscroll_of(event));
+                return true;
+            }));
+    }
+};
+}
+
+TEST_F(KineticScrollDispatcher, passes_events_on)
+{
+    auto const event = scroll(0ns, 1.0f);
+
+    EXPECT_CALL(next_dispatcher, dispatch(event)).Times(1);
+
+    dispatcher.dispatch(event);
+}
+
+TEST_F(KineticScrollDispatcher, fast_scroll_continues_and_decelerates_after_fingers_lift)
+{
+    fast_finger_scroll();
+    record_synthetic_scroll();
+
+    run_ticks(3);
+
+    ASSERT_THAT(synthetic_scroll.size(), Eq(3u));
+    EXPECT_THAT(synthetic_scroll[0], Gt(0.0f));
+    EXPECT_THAT(synthetic_scroll[1], Lt(synthetic_scroll[0]));
+    EXPECT_THAT(synthetic_scroll[2], Lt(synthetic_scroll[1]));
+}
+
+TEST_F(KineticScrollDispatcher, fling_eventually_stops)
+{
+    fast_finger_scroll();
+    run_ticks(500);
+
+    EXPECT_CALL(next_dispatcher, dispatch(_)).Times(0);
+    run_ticks(10);
+}
+
+TEST_F(KineticScrollDispatcher, slow_scroll_does_not_fling)
+{
+    dispatcher.dispatch(scroll(0ms, 0.01f));
+    dispatcher.dispatch(scroll(40ms, 0.01f));
+    dispatcher.dispatch(scroll(80ms, 0.01f));
+    dispatcher.dispatch(scroll(90ms, 0.0f));
+
+    EXPECT_CALL(next_dispatcher, dispatch(_)).Times(0);
+    run_ticks(5);
+}
+
+TEST_F(KineticScrollDispatcher, resting_fingers_before_lifting_does_not_fling)
+{
+    for (auto i = 0; i != 5; ++i)
+        dispatcher.dispatch(scroll(i * 10ms, 2.0f));
+    dispatcher.dispatch(scroll(500ms, 0.0f));
+
+    EXPECT_CALL(next_dispatcher, dispatch(_)).Times(0);
+    run_ticks(5);
+}
+
+TEST_F(KineticScrollDispatcher, pointer_motion_stops_fling)
+{
+    fast_finger_scroll();
+    run_ticks(1);
+    dispatcher.dispatch(motion(70ms));
+
+    EXPECT_CALL(next_dispatcher, dispatch(_)).Times(0);
+    run_ticks(5);
+}
+
+TEST_F(KineticScrollDispatcher, ticks_fall_on_output_refreshes)
+{
+    frame_timing.until_next_frame = 5ms;
+    fast_finger_scroll();
+    record_synthetic_scroll();
+
+    alarm_factory.advance_by(4ms);
+    EXPECT_THAT(synthetic_scroll.size(), Eq(0u));
+
+    alarm_factory.advance_by(2ms);
+    EXPECT_THAT(synthetic_scroll.size(), Eq(1u));
+
+    alarm_factory.advance_by(4ms);
+    EXPECT_THAT(synthetic_scroll.size(), Eq(1u));
+
+    alarm_factory.advance_by(2ms);
+    EXPECT_THAT(synthetic_scroll.size(), Eq(2u));
+}
+
+TEST_F(KineticScrollDispatcher, scrolls_as_far_as_the_fling_moves_between_refreshes)
+{
+    frame_timing.until_next_frame = 5ms;
+    fast_finger_scroll();   // 8 units over 40ms
+    record_synthetic_scroll();
+
+    alarm_factory.advance_by(6ms);
+
+    ASSERT_THAT(synthetic_scroll.size(), Eq(1u));
+    EXPECT_THAT(synthetic_scroll[0], FloatNear(200.0f * 0.005f, 0.01f));
+}
@@ -255,6 +255,22 @@ struct FakeToucher
     MirInputDeviceId const id;
 };
 
+struct FakeTouchpad
+{
+    FakeTouchpad(MirInputDeviceId id = 0)
+        : id(id)
+    {
+    }
+
+    mir::EventUPtr swipe(MirTouchpadGestureAction action, float dx = 0, float dy = 0)
+    {
+        return mev::make_touchpad_gesture_event(id, std::chrono::nanoseconds(0), 0,
+            mir_touchpad_gesture_swipe, action, 3, dx, dy, 1.0f, 0.0f, false);
+    }
+
+    MirInputDeviceId const id;
+};
+
 }
 
 TEST_F(SurfaceInputDispatcher, key_event_delivered_to_focused_surface)
@@ -423,6 +439,72 @@ TEST_F(SurfaceInputDispatcher, pointer_gesture_target_may_vanish_and_the_situati
     EXPECT_TRUE(dispatcher.dispatch(std::move(ev_3)));
 }
 
+TEST_F(SurfaceInputDispatcher, touchpad_gesture_delivered_to_surface_under_cursor)
+{
+    auto surface = scene.add_surface({{0, 0}, {5, 5}});
+    auto another_surface = scene.add_surface({{5, 5}, {5, 5}});
+
+    FakePointer pointer;
+    FakeTouchpad touchpad;
+
+    EXPECT_CALL(*another_surface, consume(mt::TouchpadGestureEvent(_, _))).Times(0);
+    EXPECT_CALL(*surface, consume(mt::PointerEnterEvent())).Times(1);
+    EXPECT_CALL(*surface, consume(mt::TouchpadGestureEvent(
+        mir_touchpad_gesture_swipe, mir_touchpad_gesture_action_begin))).Times(1);
+    EXPECT_CALL(*surface, consume(mt::TouchpadGestureEvent(
+        mir_touchpad_gesture_swipe, mir_touchpad_gesture_action_update))).Times(1);
+    EXPECT_CALL(*surface, consume(mt::TouchpadGestureEvent(
+        mir_touchpad_gesture_swipe, mir_touchpad_gesture_action_end))).Times(1);
+
+    dispatcher.start();
+
+    EXPECT_TRUE(dispatcher.dispatch(pointer.move_to({1, 1})));
+    EXPECT_TRUE(dispatcher.dispatch(touchpad.swipe(mir_touchpad_gesture_action_begin)));
+    EXPECT_TRUE(dispatcher.dispatch(touchpad.swipe(mir_touchpad_gesture_action_update, 5, 5)));
+    EXPECT_TRUE(dispatcher.dispatch(touchpad.swipe(mir_touchpad_gesture_action_end)));
+}
+
+TEST_F(SurfaceInputDispatcher, touchpad_gesture_stays_with_the_surface_it_began_on)
+{
+    auto surface = scene.add_surface({{0, 0}, {5, 5}});
+    auto another_surface = scene.add_surface({{5, 5}, {5, 5}});
+
+    FakePointer mouse{1};
+    FakeTouchpad touchpad{2};
+
+    EXPECT_CALL(*surface, consume(_)).Times(AnyNumber());
+    EXPECT_CALL(*another_surface, consume(_)).Times(AnyNumber());
+    EXPECT_CALL(*another_surface, consume(mt::TouchpadGestureEvent(_, _))).Times(0);
+    EXPECT_CALL(*surface, consume(mt::TouchpadGestureEvent(_, _))).Times(3);
+
+    dispatcher.start();
+
+    EXPECT_TRUE(dispatcher.dispatch(mouse.move_to({1, 1})));
+    EXPECT_TRUE(dispatcher.dispatch(touchpad.swipe(mir_touchpad_gesture_action_begin)));
+    EXPECT_TRUE(dispatcher.dispatch(mouse.move_to({6, 6})));
+    EXPECT_TRUE(dispatcher.dispatch(touchpad.swipe(mir_touchpad_gesture_action_update, 1, 1)));
+    EXPECT_TRUE(dispatcher.dispatch(touchpad.swipe(mir_touchpad_gesture_action_end)));
+}
+
+TEST_F(SurfaceInputDispatcher, touchpad_gesture_dropped_if_no_surface_under_cursor)
+{
+    auto surface = scene.add_surface({{0, 0}, {5, 5}});
+
+    FakePointer pointer;
+    FakeTouchpad touchpad;
+
+    EXPECT_CALL(*surface, consume(_)).Times(AnyNumber());
+    EXPECT_CALL(*surface, consume(mt::TouchpadGestureEvent(_, _))).Times(0);
+
+    dispatcher.start();
+
+    EXPECT_FALSE(dispatcher.dispatch(touchpad.swipe(mir_touchpad_gesture_action_begin)));
+    EXPECT_TRUE(dispatcher.dispatch(pointer.move_to({1, 1})));
+    EXPECT_TRUE(dispatcher.dispatch(pointer.move_to({10, 10})));
+    EXPECT_FALSE(dispatcher.dispatch(touchpad.swipe(mir_touchpad_gesture_action_update)));
+    EXPECT_FALSE(dispatcher.dispatch(touchpad.swipe(mir_touchpad_gesture_action_end)));
+}
+
 TEST_F(SurfaceInputDispatcher, touch_delivered_to_surface)
 {
     auto surface = scene.add_surface({{1, 1}, {1, 1}});
@@ -63,6 +63,28 @@ TEST_F(BypassMatchTest, single_fullscreen_window_bypassed)
     EXPECT_EQ(window, *it);
 }
 
+TEST_F(BypassMatchTest, scaled_fullscreen_window_not_bypassed)
+{
+    auto window = std::make_shared<mtd::FakeRenderable>(0, 0, 1920, 1200);
+    window->set_src_bounds({{0, 0}, {960, 600}});
+    mgm::BypassMatch matcher(primary_monitor);
+    mg::RenderableList list{window};
+
+    auto it = std::find_if(list.rbegin(), list.rend(), matcher);
+    EXPECT_EQ(list.rend(), it);
+}
+
+TEST_F(BypassMatchTest, cropped_fullscreen_window_not_bypassed)
+{
+    auto window = std::make_shared<mtd::FakeRenderable>(0, 0, 1920, 1200);
+    window->set_src_bounds({{10, 10}, {1920, 1200}});
+    mgm::BypassMatch matcher(primary_monitor);
+    mg::RenderableList list{window};
+
+    auto it = std::find_if(list.rbegin(), list.rend(), matcher);
+    EXPECT_EQ(list.rend(), it);
+}
+
 TEST_F(BypassMatchTest, translucent_fullscreen_window_not_bypassed)
 {
     mgm::BypassMatch matcher(primary_monitor);
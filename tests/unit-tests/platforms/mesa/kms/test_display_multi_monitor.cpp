@@ -19,6 +19,7 @@
 #include "mir/graphics/display.h"
 #include "mir/graphics/display_buffer.h"
 #include "mir/graphics/display_configuration.h"
+#include "mir/graphics/incremental_display.h"
 #include "mir/graphics/platform.h"
 
 #include "src/platforms/mesa/server/kms/platform.h"
@@ -41,6 +42,7 @@
 #include <gmock/gmock.h>
 
 #include <unordered_set>
+#include <vector>
 #include <fcntl.h>
 
 namespace mg = mir::graphics;
@@ -541,6 +543,50 @@ TEST_F(MesaDisplayMultiMonitorTest, configure_clears_unused_connected_outputs)
     }
 }
 
+TEST_F(MesaDisplayMultiMonitorTest, incremental_configure_replaces_only_the_sync_groups_of_changed_outputs)
+{
+    using namespace testing;
+
+    int const num_connected_outputs{2};
+    int const num_disconnected_outputs{0};
+
+    setup_outputs(num_connected_outputs, num_disconnected_outputs);
+
+    auto display = create_display_side_by_side(create_platform());
+    auto const incremental = dynamic_cast<mg::IncrementalDisplay*>(display->native_display());
+    ASSERT_THAT(incremental, NotNull());
+
+    std::vector<mg::DisplaySyncGroup*> groups_before;
+    display->for_each_display_sync_group(
+        [&](mg::DisplaySyncGroup& group) { groups_before.push_back(&group); });
+    ASSERT_THAT(groups_before.size(), Eq(2u));
+
+    /* Give the second output a different mode, leaving the first as it was */
+    auto conf = display->configuration();
+    int output_index{0};
+    conf->for_each_output(
+        [&](mg::UserDisplayConfigurationOutput& output)
+        {
+            if (output_index++ == 1)
+                output.current_mode_index = 2;
+        });
+
+    std::vector<mg::DisplaySyncGroup*> removed;
+    std::vector<mg::DisplaySyncGroup*> added;
+    incremental->configure_incrementally(
+        *conf,
+        [&](mg::DisplaySyncGroup& group) { removed.push_back(&group); },
+        [&](mg::DisplaySyncGroup& group) { added.push_back(&group); });
+
+    std::vector<mg::DisplaySyncGroup*> groups_after;
+    display->for_each_display_sync_group(
+        [&](mg::DisplaySyncGroup& group) { groups_after.push_back(&group); });
+
+    EXPECT_THAT(removed, ElementsAre(groups_before[1]));
+    ASSERT_THAT(added.size(), Eq(1u));
+    EXPECT_THAT(groups_after, UnorderedElementsAre(groups_before[0], added[0]));
+}
+
 TEST_F(MesaDisplayMultiMonitorTest, resume_clears_unused_connected_outputs)
 {
     using namespace testing;
@@ -26,6 +26,7 @@
 #include <mir/test/doubles/mock_renderable.h>
 #include <mir/test/doubles/mock_buffer_stream.h>
 #include <mir/compositor/buffer_stream.h>
+#include <mir/graphics/solid_colour_buffer.h>
 #include <mir/test/doubles/mock_gl.h>
 #include <mir/test/doubles/mock_egl.h>
 #include <src/renderers/gl/renderer.h>
@@ -220,6 +221,25 @@ TEST_F(GLRenderer, avoids_src_alpha_for_rgbx_blending)  // LP: #1423462
     renderer.render(renderable_list);
 }
 
+TEST_F(GLRenderer, draws_solid_colour_buffers_without_textures)
+{
+    bool consumed{false};
+    auto const solid_colour = std::make_shared<mg::SolidColourBuffer>(
+        mir::geometry::Size{1, 1},
+        mg::SolidColourBuffer::Colour{0.25f, 0.5f, 0.75f, 1.0f},
+        [&consumed]{ consumed = true; });
+    EXPECT_CALL(*renderable, buffer()).WillRepeatedly(Return(solid_colour));
+
+    EXPECT_CALL(mock_gl, glUniform4f(_, 0.25f, 0.5f, 0.75f, 1.0f));
+    EXPECT_CALL(mock_gl, glBindTexture(_, _)).Times(0);
+    EXPECT_CALL(mock_gl, glDrawArrays(_, _, _)).Times(AtLeast(1));
+
+    mrg::Renderer renderer(display_buffer);
+    renderer.render(renderable_list);
+
+    EXPECT_TRUE(consumed);
+}
+
 TEST_F(GLRenderer, clears_all_channels_zero)
 {
     InSequence seq;
@@ -734,6 +734,55 @@ TEST_F(AbstractShell, aux_rect_gets_adjusted_for_windows_with_margins)
 }
 
 // lp:1625401
+TEST_F(AbstractShell, confinement_region_confines_pointer_to_region_clipped_to_the_surface)
+{
+    std::shared_ptr<ms::Session> session =
+        shell.open_session(__LINE__, "XPlane", std::shared_ptr<mf::EventSink>());
+
+    auto creation_params = ms::a_surface()
+        .with_buffer_stream(session->create_buffer_stream(properties));
+    auto surface = shell.create_surface(session, creation_params, nullptr);
+    surface->move_to({100, 200});
+    surface->resize({50, 50});
+
+    msh::FocusController& focus_controller = shell;
+    focus_controller.set_focus_to(session, surface);
+
+    // The window manager applies the confinement state, which the mock doesn't
+    surface->set_confine_pointer_state(mir_pointer_confined_to_window);
+
+    msh::SurfaceSpecification modifications;
+    modifications.confinement_region = std::vector<geom::Rectangle>{{{10, 10}, {5, 5}}, {{40, 40}, {20, 20}}};
+
+    EXPECT_CALL(seat, set_confinement_regions(
+        geom::Rectangles{{{110, 210}, {5, 5}}, {{140, 240}, {10, 10}}}));
+
+    shell.modify_surface(session, surface, modifications);
+}
+
+TEST_F(AbstractShell, confinement_region_outside_the_surface_confines_pointer_to_the_surface)
+{
+    std::shared_ptr<ms::Session> session =
+        shell.open_session(__LINE__, "XPlane", std::shared_ptr<mf::EventSink>());
+
+    auto creation_params = ms::a_surface()
+        .with_buffer_stream(session->create_buffer_stream(properties));
+    auto surface = shell.create_surface(session, creation_params, nullptr);
+    surface->move_to({100, 200});
+    surface->resize({50, 50});
+
+    msh::FocusController& focus_controller = shell;
+    focus_controller.set_focus_to(session, surface);
+    surface->set_confine_pointer_state(mir_pointer_confined_to_window);
+
+    msh::SurfaceSpecification modifications;
+    modifications.confinement_region = std::vector<geom::Rectangle>{{{60, 60}, {5, 5}}};
+
+    EXPECT_CALL(seat, set_confinement_regions(geom::Rectangles{{{100, 200}, {50, 50}}}));
+
+    shell.modify_surface(session, surface, modifications);
+}
+
 TEST_F(AbstractShell, when_remaining_session_has_no_surface_focus_next_session_doesnt_loop_endlessly)
 {
     std::shared_ptr<ms::Session> empty_session =
@@ -0,0 +1,120 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/server/scene/basic_idle_hub.h"
+
+#include "mir/test/doubles/fake_alarm_factory.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace ms = mir::scene;
+namespace mtd = mir::test::doubles;
+
+using namespace testing;
+using namespace std::literals::chrono_literals;
+
+namespace
+{
+class MockIdleStateObserver : public ms::IdleStateObserver
+{
+public:
+    MOCK_METHOD0(idle, void());
+    MOCK_METHOD0(active, void());
+};
+
+struct BasicIdleHub : Test
+{
+    mtd::FakeAlarmFactory alarm_factory;
+    std::shared_ptr<ms::BasicIdleHub> const hub{
+        std::make_shared<ms::BasicIdleHub>(alarm_factory.the_clock(), alarm_factory)};
+    std::shared_ptr<MockIdleStateObserver> const observer{std::make_shared<NiceMock<MockIdleStateObserver>>()};
+};
+}
+
+TEST_F(BasicIdleHub, observer_is_told_of_idle_after_timeout)
+{
+    hub->register_interest(observer, 30s);
+
+    EXPECT_CALL(*observer, idle()).Times(0);
+    alarm_factory.advance_by(29s);
+    Mock::VerifyAndClearExpectations(observer.get());
+
+    EXPECT_CALL(*observer, idle()).Times(1);
+    alarm_factory.advance_by(2s);
+}
+
+TEST_F(BasicIdleHub, poke_restarts_the_timeout)
+{
+    hub->register_interest(observer, 30s);
+    alarm_factory.advance_by(20s);
+    hub->poke();
+
+    EXPECT_CALL(*observer, idle()).Times(0);
+    alarm_factory.advance_by(20s);
+    Mock::VerifyAndClearExpectations(observer.get());
+
+    EXPECT_CALL(*observer, idle()).Times(1);
+    alarm_factory.advance_by(11s);
+}
+
+TEST_F(BasicIdleHub, poke_wakes_idle_observer)
+{
+    hub->register_interest(observer, 30s);
+    alarm_factory.advance_by(31s);
+
+    EXPECT_CALL(*observer, active()).Times(1);
+    hub->poke();
+}
+
+TEST_F(BasicIdleHub, wake_lock_prevents_idle_until_released)
+{
+    hub->register_interest(observer, 30s);
+    auto wake_lock = hub->inhibit_idle();
+
+    EXPECT_CALL(*observer, idle()).Times(0);
+    alarm_factory.advance_by(60s);
+    wake_lock.reset();
+    alarm_factory.advance_by(29s);
+    Mock::VerifyAndClearExpectations(observer.get());
+
+    EXPECT_CALL(*observer, idle()).Times(1);
+    alarm_factory.advance_by(2s);
+}
+
+TEST_F(BasicIdleHub, observers_with_different_timeouts_go_idle_in_turn)
+{
+    auto const later_observer = std::make_shared<NiceMock<MockIdleStateObserver>>();
+    hub->register_interest(observer, 10s);
+    hub->register_interest(later_observer, 30s);
+
+    EXPECT_CALL(*observer, idle()).Times(1);
+    EXPECT_CALL(*later_observer, idle()).Times(0);
+    alarm_factory.advance_by(11s);
+    Mock::VerifyAndClearExpectations(later_observer.get());
+
+    EXPECT_CALL(*later_observer, idle()).Times(1);
+    alarm_factory.advance_by(20s);
+}
+
+TEST_F(BasicIdleHub, unregistered_observer_is_not_notified)
+{
+    hub->register_interest(observer, 30s);
+    hub->unregister_interest(*observer);
+
+    EXPECT_CALL(*observer, idle()).Times(0);
+    alarm_factory.advance_by(31s);
+}
@@ -31,6 +31,7 @@
 #include "mir/test/doubles/mock_buffer_stream.h"
 #include "mir/test/doubles/stub_buffer.h"
 #include "mir/test/doubles/stub_session.h"
+#include "mir/test/doubles/fake_alarm_factory.h"
 #include "mir/test/fake_shared.h"
 
 #include "src/server/report/null_report_factory.h"
@@ -66,6 +67,7 @@ public:
     MOCK_METHOD3(attrib_changed, void(ms::Surface const*, MirWindowAttrib, int));
     MOCK_METHOD2(window_resized_to, void(ms::Surface const*, geom::Size const&));
     MOCK_METHOD2(content_resized_to, void(ms::Surface const*, geom::Size const&));
+    MOCK_METHOD2(moved_to, void(ms::Surface const*, geom::Point const&));
     MOCK_METHOD2(hidden_set_to, void(ms::Surface const*, bool));
     MOCK_METHOD2(renamed, void(ms::Surface const*, char const*));
     MOCK_METHOD1(client_surface_close_requested, void(ms::Surface const*));
@@ -196,6 +198,85 @@ TEST_F(BasicSurfaceTest, update_top_left)
     EXPECT_EQ(new_top_left, surface.top_left());
 }
 
+TEST_F(BasicSurfaceTest, moving_to_current_position_does_not_notify_observers)
+{
+    EXPECT_CALL(mock_callback, call())
+        .Times(0);
+
+    surface.add_observer(observer);
+
+    surface.move_to(rect.top_left);
+    EXPECT_EQ(rect.top_left, surface.top_left());
+}
+
+TEST_F(BasicSurfaceTest, without_an_alarm_factory_every_move_is_notified)
+{
+    using namespace testing;
+
+    auto const mock_surface_observer = std::make_shared<NiceMock<MockSurfaceObserver>>();
+    surface.add_observer(mock_surface_observer);
+
+    EXPECT_CALL(*mock_surface_observer, moved_to(_, _)).Times(3);
+
+    surface.move_to({10, 10});
+    surface.move_to({11, 11});
+    surface.move_to({12, 12});
+}
+
+TEST_F(BasicSurfaceTest, moves_within_an_interval_are_coalesced_to_the_latest_position)
+{
+    using namespace testing;
+    using namespace std::chrono_literals;
+
+    mtd::FakeAlarmFactory alarm_factory;
+    ms::BasicSurface coalescing_surface{
+        nullptr, name, rect, std::shared_ptr<ms::Surface>{}, mir_pointer_unconfined, streams,
+        std::shared_ptr<mg::CursorImage>(), report, alarm_factory};
+
+    geom::Point const first{10, 10};
+    geom::Point const last{12, 12};
+    auto const mock_surface_observer = std::make_shared<NiceMock<MockSurfaceObserver>>();
+    coalescing_surface.add_observer(mock_surface_observer);
+
+    InSequence seq;
+    EXPECT_CALL(*mock_surface_observer, moved_to(_, first));
+    EXPECT_CALL(*mock_surface_observer, moved_to(_, last));
+
+    coalescing_surface.move_to(first);
+    coalescing_surface.move_to({11, 11});
+    coalescing_surface.move_to(last);
+
+    // Nothing composites here: the latest position is delivered all the same
+    alarm_factory.advance_by(1s);
+
+    EXPECT_THAT(coalescing_surface.top_left(), Eq(last));
+}
+
+TEST_F(BasicSurfaceTest, a_move_after_a_quiet_interval_is_notified_at_once)
+{
+    using namespace testing;
+    using namespace std::chrono_literals;
+
+    mtd::FakeAlarmFactory alarm_factory;
+    ms::BasicSurface coalescing_surface{
+        nullptr, name, rect, std::shared_ptr<ms::Surface>{}, mir_pointer_unconfined, streams,
+        std::shared_ptr<mg::CursorImage>(), report, alarm_factory};
+
+    geom::Point const first{10, 10};
+    geom::Point const second{20, 20};
+    auto const mock_surface_observer = std::make_shared<NiceMock<MockSurfaceObserver>>();
+    coalescing_surface.add_observer(mock_surface_observer);
+
+    EXPECT_CALL(*mock_surface_observer, moved_to(_, first));
+    coalescing_surface.move_to(first);
+    alarm_factory.advance_by(1s);
+    Mock::VerifyAndClearExpectations(mock_surface_observer.get());
+
+    EXPECT_CALL(*mock_surface_observer, moved_to(_, second));
+    coalescing_surface.move_to(second);
+    Mock::VerifyAndClearExpectations(mock_surface_observer.get());
+}
+
 TEST_F(BasicSurfaceTest, update_size)
 {
     geom::Size const new_size{34, 56};
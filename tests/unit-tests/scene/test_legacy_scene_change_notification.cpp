@@ -39,6 +39,10 @@ struct MockBufferCallback
 {
     MOCK_METHOD1(invoke, void(int));
 };
+struct MockDamageCallback
+{
+    MOCK_METHOD2(invoke, void(int, mir::geometry::Rectangle const&));
+};
 
 struct LegacySceneChangeNotificationTest : public testing::Test
 {
@@ -49,8 +53,11 @@ struct LegacySceneChangeNotificationTest : public testing::Test
     }
     testing::NiceMock<MockSceneCallback> scene_callback;
     testing::NiceMock<MockBufferCallback> buffer_callback;
+    testing::NiceMock<MockDamageCallback> damage_callback;
     std::function<void(int)> buffer_change_callback{[this](int arg){buffer_callback.invoke(arg);}};
     std::function<void()> scene_change_callback{[this](){scene_callback.invoke();}};
+    std::function<void(int, mir::geometry::Rectangle const&)> damage_change_callback{
+        [this](int frames, mir::geometry::Rectangle const& damage){damage_callback.invoke(frames, damage);}};
     std::shared_ptr<testing::NiceMock<mtd::MockSurface>> surface;
 }; 
 }
@@ -144,3 +151,23 @@ TEST_F(LegacySceneChangeNotificationTest, ending_observation_unregisters_observe
     // Verify that its not simply the destruction removing the observer...
     ::testing::Mock::VerifyAndClearExpectations(&observer);
 }
+
+TEST_F(LegacySceneChangeNotificationTest, forwards_scene_damage_to_damage_callback)
+{
+    using namespace ::testing;
+    mir::geometry::Rectangle const damage{{10, 20}, {30, 40}};
+
+    EXPECT_CALL(scene_callback, invoke()).Times(0);
+    EXPECT_CALL(damage_callback, invoke(1, damage)).Times(1);
+
+    ms::LegacySceneChangeNotification observer(scene_change_callback, damage_change_callback);
+    observer.scene_damaged(damage);
+}
+
+TEST_F(LegacySceneChangeNotificationTest, scene_damage_without_damage_callback_is_a_scene_change)
+{
+    EXPECT_CALL(scene_callback, invoke()).Times(1);
+
+    ms::LegacySceneChangeNotification observer(scene_change_callback, buffer_change_callback);
+    observer.scene_damaged({{10, 20}, {30, 40}});
+}
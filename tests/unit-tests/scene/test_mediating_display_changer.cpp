@@ -22,9 +22,11 @@
 #include "mir/geometry/rectangles.h"
 #include "src/server/scene/broadcasting_session_event_sink.h"
 #include "mir/server_action_queue.h"
+#include "mir/graphics/incremental_display.h"
 
 #include "mir/test/doubles/mock_display.h"
 #include "mir/test/doubles/mock_compositor.h"
+#include "mir/test/doubles/null_display_sync_group.h"
 #include "mir/test/doubles/null_display_configuration.h"
 #include "mir/test/doubles/stub_display_configuration.h"
 #include "mir/test/doubles/mock_scene_session.h"
@@ -1043,3 +1045,81 @@ TEST_F(MediatingDisplayChangerTest, all_sessions_get_notified_on_configuration_c
     EXPECT_THAT(*received_configuration, mt::DisplayConfigMatches(std::cref(*new_config)));
 }
 
+
+namespace
+{
+struct StubIncrementalDisplay : mg::NativeDisplay, mg::IncrementalDisplay
+{
+    void configure_incrementally(
+        mg::DisplayConfiguration const&,
+        std::function<void(mg::DisplaySyncGroup& group)> const& removing,
+        std::function<void(mg::DisplaySyncGroup& group)> const& added) override
+    {
+        removing(old_group);
+        added(new_group);
+    }
+
+    mtd::StubDisplaySyncGroup old_group{{geom::Rectangle{{0, 0}, {640, 480}}}};
+    mtd::StubDisplaySyncGroup new_group{{geom::Rectangle{{640, 0}, {640, 480}}}};
+};
+}
+
+TEST_F(MediatingDisplayChangerTest, incremental_display_replaces_only_changed_sync_groups_without_stopping_compositor)
+{
+    mtd::NullDisplayConfiguration conf;
+    auto session = std::make_shared<mtd::StubSession>();
+    StubIncrementalDisplay incremental_display;
+
+    ON_CALL(mock_display, native_display()).WillByDefault(Return(&incremental_display));
+    ON_CALL(mock_display, apply_if_configuration_preserves_display_buffers(_)).WillByDefault(Return(false));
+
+    EXPECT_CALL(mock_compositor, stop()).Times(0);
+    EXPECT_CALL(mock_compositor, start()).Times(0);
+    EXPECT_CALL(mock_display, configure(_)).Times(0);
+    {
+        InSequence seq;
+        EXPECT_CALL(mock_compositor, remove_display_sync_group(Ref(incremental_display.old_group)));
+        EXPECT_CALL(mock_compositor, add_display_sync_group(Ref(incremental_display.new_group)));
+    }
+
+    session_event_sink.handle_focus_change(session);
+    changer->configure(session, mt::fake_shared(conf));
+}
+
+TEST_F(MediatingDisplayChangerTest, focusing_session_with_the_current_display_configuration_does_not_reconfigure)
+{
+    auto session1 = std::make_shared<mtd::StubSession>();
+    auto session2 = std::make_shared<mtd::StubSession>();
+
+    session_event_sink.handle_focus_change(session1);
+    changer->configure(session1, mock_display.configuration());
+    session_event_sink.handle_focus_change(session2);
+    changer->configure(session2, mock_display.configuration());
+
+    EXPECT_CALL(mock_display, apply_if_configuration_preserves_display_buffers(_)).Times(0);
+    EXPECT_CALL(mock_display, configure(_)).Times(0);
+
+    session_event_sink.handle_focus_change(session1);
+}
+
+TEST_F(MediatingDisplayChangerTest, focusing_session_compares_with_the_applied_configuration_not_the_reported_one)
+{
+    auto session1 = std::make_shared<mtd::StubSession>();
+    auto session2 = std::make_shared<mtd::StubSession>();
+    std::shared_ptr<mg::DisplayConfiguration> const original{mock_display.configuration()};
+    std::shared_ptr<mg::DisplayConfiguration> const rotated{mock_display.configuration()};
+    rotated->for_each_output([](mg::UserDisplayConfigurationOutput& output) { output.orientation = mir_orientation_left; });
+
+    // Like a display that applies configurations without updating what it reports
+    ON_CALL(mock_display, apply_if_configuration_preserves_display_buffers(_)).WillByDefault(Return(true));
+
+    session_event_sink.handle_focus_change(session2);
+    changer->configure(session2, original);
+    session_event_sink.handle_focus_change(session1);
+    changer->configure(session1, rotated);
+
+    EXPECT_CALL(mock_display, apply_if_configuration_preserves_display_buffers(Ref(*original)))
+        .WillOnce(Return(true));
+
+    session_event_sink.handle_focus_change(session2);
+}
@@ -227,3 +227,18 @@ TEST_F(PromptSessionContainer, associates_prompt_sessions_with_a_participant_unt
     EXPECT_THAT(list_participants_for(prompt_session1), ElementsAre(session2));
     EXPECT_THAT(list_participants_for(prompt_session2), ElementsAre(session1, session2));
 }
+
+TEST_F(PromptSessionContainer, removes_participant_that_has_gone_away)
+{
+    container.insert_prompt_session(prompt_session1);
+
+    std::shared_ptr<ms::Session> transient_session = std::make_shared<NiceMock<mtd::MockSceneSession>>();
+    std::weak_ptr<ms::Session> const gone_session = transient_session;
+
+    container.insert_participant(prompt_session1.get(), session1, ms::PromptSessionContainer::ParticipantType::prompt_provider);
+    container.insert_participant(prompt_session1.get(), transient_session, ms::PromptSessionContainer::ParticipantType::prompt_provider);
+    transient_session.reset();
+
+    EXPECT_TRUE(container.remove_participant(prompt_session1.get(), gone_session, ms::PromptSessionContainer::ParticipantType::prompt_provider));
+    EXPECT_THAT(list_participants_for(prompt_session1), ElementsAre(session1));
+}
@@ -23,7 +23,7 @@
 #include <gmock/gmock.h>
 
 namespace mtd = mir::test::doubles;
-namespace mc = mir::compositor;
+namespace ms = mir::scene;
 
 namespace
 {
@@ -33,9 +33,9 @@ struct RenderingTrackerTest : testing::Test
     std::shared_ptr<testing::NiceMock<mtd::MockSurface>> const mock_surface{
         std::make_shared<testing::NiceMock<mtd::MockSurface>>()};
     mir::scene::RenderingTracker tracker{mock_surface};
-    mc::CompositorID const compositor_id1{&mock_surface};
-    mc::CompositorID const compositor_id2{&compositor_id1};
-    mc::CompositorID const compositor_id3{&compositor_id2};
+    ms::RenderingTracker::CompositorMask const compositor_id1{1 << 0};
+    ms::RenderingTracker::CompositorMask const compositor_id2{1 << 1};
+    ms::RenderingTracker::CompositorMask const compositor_id3{1 << 5};
 };
 
 }
@@ -44,7 +44,7 @@ TEST_F(RenderingTrackerTest, occludes_surface_when_occluded_in_single_compositor
 {
     using namespace testing;
 
-    std::set<mc::CompositorID> const compositors{compositor_id1};
+    auto const compositors = compositor_id1;
 
     EXPECT_CALL(
         *mock_surface,
@@ -59,7 +59,7 @@ TEST_F(RenderingTrackerTest, exposes_surface_when_rendered_in_single_compositor)
 {
     using namespace testing;
 
-    std::set<mc::CompositorID> const compositors{compositor_id1};
+    auto const compositors = compositor_id1;
 
     EXPECT_CALL(
         *mock_surface,
@@ -74,7 +74,7 @@ TEST_F(RenderingTrackerTest, exposes_surface_when_rendered_in_one_of_many_compos
 {
     using namespace testing;
 
-    std::set<mc::CompositorID> const compositors{compositor_id1, compositor_id2, compositor_id3};
+    auto const compositors = compositor_id1 | compositor_id2 | compositor_id3;
 
     EXPECT_CALL(
         *mock_surface,
@@ -90,7 +90,7 @@ TEST_F(RenderingTrackerTest, does_not_occlude_surface_when_not_occluded_in_all_c
 {
     using namespace testing;
 
-    std::set<mc::CompositorID> const compositors{compositor_id1, compositor_id2, compositor_id3};
+    auto const compositors = compositor_id1 | compositor_id2 | compositor_id3;
 
     EXPECT_CALL(
         *mock_surface,
@@ -107,7 +107,7 @@ TEST_F(RenderingTrackerTest, occludes_surface_when_occluded_in_all_compositors)
 {
     using namespace testing;
 
-    std::set<mc::CompositorID> const compositors{compositor_id1, compositor_id2, compositor_id3};
+    auto const compositors = compositor_id1 | compositor_id2 | compositor_id3;
 
     EXPECT_CALL(
         *mock_surface,
@@ -124,7 +124,7 @@ TEST_F(RenderingTrackerTest, occludes_surface_when_occluded_in_remaining_composi
 {
     using namespace testing;
 
-    std::set<mc::CompositorID> compositors{compositor_id1, compositor_id2, compositor_id3};
+    auto compositors = compositor_id1 | compositor_id2 | compositor_id3;
 
     tracker.active_compositors(compositors);
 
@@ -138,7 +138,7 @@ TEST_F(RenderingTrackerTest, occludes_surface_when_occluded_in_remaining_composi
         *mock_surface,
         configure(mir_window_attrib_visibility, mir_window_visibility_occluded));
 
-    compositors.erase(compositor_id3);
+    compositors &= ~compositor_id3;
     tracker.active_compositors(compositors);
 }
 
@@ -152,3 +152,40 @@ TEST_F(RenderingTrackerTest, throws_when_passed_inactive_compositor_id)
         tracker.rendered_in(compositor_id2);
     }, std::logic_error);
 }
+
+TEST_F(RenderingTrackerTest, only_notifies_surface_of_visibility_transitions)
+{
+    using namespace testing;
+
+    tracker.active_compositors(compositor_id1 | compositor_id2);
+
+    InSequence seq;
+    EXPECT_CALL(
+        *mock_surface,
+        configure(mir_window_attrib_visibility, mir_window_visibility_exposed));
+    EXPECT_CALL(
+        *mock_surface,
+        configure(mir_window_attrib_visibility, mir_window_visibility_occluded));
+    EXPECT_CALL(
+        *mock_surface,
+        configure(mir_window_attrib_visibility, mir_window_visibility_exposed));
+
+    tracker.rendered_in(compositor_id1);
+    tracker.rendered_in(compositor_id2);
+    tracker.rendered_in(compositor_id1);
+    tracker.occluded_in(compositor_id1);
+    tracker.occluded_in(compositor_id2);
+    tracker.occluded_in(compositor_id1);
+    tracker.rendered_in(compositor_id2);
+}
+
+TEST_F(RenderingTrackerTest, is_exposed_only_in_compositors_it_is_not_occluded_in)
+{
+    tracker.active_compositors(compositor_id1 | compositor_id2);
+
+    tracker.occluded_in(compositor_id1);
+    tracker.rendered_in(compositor_id2);
+
+    EXPECT_FALSE(tracker.is_exposed_in(compositor_id1));
+    EXPECT_TRUE(tracker.is_exposed_in(compositor_id2));
+}
@@ -79,6 +79,7 @@ struct MockSceneObserver : public ms::Observer
     MOCK_METHOD1(surface_removed, void(std::shared_ptr<ms::Surface> const&));
     MOCK_METHOD0(surfaces_reordered, void());
     MOCK_METHOD0(scene_changed, void());
+    MOCK_METHOD1(scene_damaged, void(geom::Rectangle const&));
 
     MOCK_METHOD1(surface_exists, void(std::shared_ptr<ms::Surface> const&));
     MOCK_METHOD0(end_observation, void());
@@ -281,8 +282,7 @@ TEST_F(SurfaceStack, scene_doesnt_count_pending_frames_from_occluded_surfaces)
         report);
 
     stack.add_surface(surface, default_params.input_mode);
-    auto elements = stack.scene_elements_for(this);
-    for (auto const& elem : elements)
+    for (auto const& elem : stack.scene_elements_for(this))
         elem->occluded();
 
     EXPECT_EQ(0, stack.frames_pending(this));
@@ -321,14 +321,12 @@ TEST_F(SurfaceStack, scene_doesnt_count_pending_frames_from_partially_exposed_su
     EXPECT_EQ(3, stack.frames_pending(comp1));
     EXPECT_EQ(3, stack.frames_pending(comp2));
 
-    auto elements = stack.scene_elements_for(comp1);
-    for (auto const& elem : elements)
+    for (auto const& elem : stack.scene_elements_for(comp1))
     {
         elem->rendered();
     }
 
-    elements = stack.scene_elements_for(comp2);
-    for (auto const& elem : elements)
+    for (auto const& elem : stack.scene_elements_for(comp2))
     {
         elem->occluded();
     }
@@ -683,13 +681,15 @@ namespace
 {
 struct MockConfigureSurface : public ms::BasicSurface
 {
-    MockConfigureSurface() :
+    MockConfigureSurface(
+        std::list<ms::StreamInfo> const& streams =
+            { { std::make_shared<mtd::StubBufferStream>(), {}, {} } }) :
         ms::BasicSurface(
             {},
             {},
             {{},{}},
             mir_pointer_unconfined,
-            std::list<ms::StreamInfo> { { std::make_shared<mtd::StubBufferStream>(), {}, {} } },
+            streams,
             {},
             mir::report::null_scene_report())
     {
@@ -712,9 +712,9 @@ TEST_F(SurfaceStack, occludes_not_rendered_surface)
     
     stack.add_surface(mock_surface, default_params.input_mode);
 
-    auto const elements = stack.scene_elements_for(compositor_id);
+    auto elements = stack.scene_elements_for(compositor_id);
     ASSERT_THAT(elements.size(), Eq(1u));
-    auto const elements2 = stack.scene_elements_for(compositor_id2);
+    auto elements2 = stack.scene_elements_for(compositor_id2);
     ASSERT_THAT(elements2.size(), Eq(1u));
 
     EXPECT_CALL(*mock_surface, configure(mir_window_attrib_visibility, mir_window_visibility_occluded));
@@ -723,6 +723,129 @@ TEST_F(SurfaceStack, occludes_not_rendered_surface)
     elements2.back()->occluded();
 }
 
+TEST_F(SurfaceStack, does_not_occlude_a_surface_until_all_of_its_renderables_are_reported)
+{
+    using namespace testing;
+
+    stack.register_compositor(compositor_id);
+
+    auto const mock_surface = std::make_shared<MockConfigureSurface>(
+        std::list<ms::StreamInfo> {
+            { std::make_shared<mtd::StubBufferStream>(), {}, {} },
+            { std::make_shared<mtd::StubBufferStream>(), {}, {} } });
+    stack.add_surface(mock_surface, default_params.input_mode);
+
+    auto elements = stack.scene_elements_for(compositor_id);
+    ASSERT_THAT(elements.size(), Eq(2u));
+    elements.front()->rendered();
+    elements.back()->rendered();
+
+    elements = stack.scene_elements_for(compositor_id);
+    ASSERT_THAT(elements.size(), Eq(2u));
+
+    EXPECT_CALL(*mock_surface, configure(mir_window_attrib_visibility, _)).Times(0);
+
+    elements.front()->occluded();
+
+    Mock::VerifyAndClearExpectations(mock_surface.get());
+
+    EXPECT_CALL(*mock_surface, configure(mir_window_attrib_visibility, mir_window_visibility_occluded));
+
+    elements.back()->occluded();
+}
+
+TEST_F(SurfaceStack, unreported_renderables_leave_visibility_unchanged)
+{
+    using namespace testing;
+
+    stack.register_compositor(compositor_id);
+
+    auto const mock_surface = std::make_shared<MockConfigureSurface>(
+        std::list<ms::StreamInfo> {
+            { std::make_shared<mtd::StubBufferStream>(), {}, {} },
+            { std::make_shared<mtd::StubBufferStream>(), {}, {} } });
+    stack.add_surface(mock_surface, default_params.input_mode);
+
+    auto elements = stack.scene_elements_for(compositor_id);
+    ASSERT_THAT(elements.size(), Eq(2u));
+    elements.front()->rendered();
+    elements.back()->rendered();
+
+    elements = stack.scene_elements_for(compositor_id);
+    ASSERT_THAT(elements.size(), Eq(2u));
+
+    EXPECT_CALL(*mock_surface, configure(mir_window_attrib_visibility, _)).Times(0);
+
+    elements.front()->occluded();
+    elements.clear();
+}
+
+TEST_F(SurfaceStack, surfaces_reported_by_a_compositor_that_skips_others_are_still_updated)
+{
+    using namespace testing;
+
+    stack.register_compositor(compositor_id);
+
+    auto const reported_surface = std::make_shared<MockConfigureSurface>();
+    auto const unreported_surface = std::make_shared<MockConfigureSurface>();
+    stack.add_surface(reported_surface, default_params.input_mode);
+    stack.add_surface(unreported_surface, default_params.input_mode);
+
+    auto elements = stack.scene_elements_for(compositor_id);
+    ASSERT_THAT(elements.size(), Eq(2u));
+
+    EXPECT_CALL(*reported_surface, configure(mir_window_attrib_visibility, mir_window_visibility_exposed));
+    EXPECT_CALL(*unreported_surface, configure(mir_window_attrib_visibility, _)).Times(0);
+
+    elements.front()->rendered();
+    elements.clear();
+}
+
+TEST_F(SurfaceStack, frame_is_not_committed_for_a_compositor_reusing_the_slot_of_the_one_it_was_for)
+{
+    using namespace testing;
+
+    mc::CompositorID const compositor_id2{&compositor_id};
+
+    stack.register_compositor(compositor_id);
+
+    auto const mock_surface = std::make_shared<MockConfigureSurface>();
+    stack.add_surface(mock_surface, default_params.input_mode);
+
+    auto elements = stack.scene_elements_for(compositor_id);
+    ASSERT_THAT(elements.size(), Eq(1u));
+
+    stack.unregister_compositor(compositor_id);
+    stack.register_compositor(compositor_id2);
+
+    EXPECT_CALL(*mock_surface, configure(mir_window_attrib_visibility, mir_window_visibility_occluded)).Times(0);
+
+    elements.back()->occluded();
+}
+
+TEST_F(SurfaceStack, surface_is_exposed_if_any_of_its_renderables_is_rendered)
+{
+    using namespace testing;
+
+    stack.register_compositor(compositor_id);
+
+    auto const mock_surface = std::make_shared<MockConfigureSurface>(
+        std::list<ms::StreamInfo> {
+            { std::make_shared<mtd::StubBufferStream>(), {}, {} },
+            { std::make_shared<mtd::StubBufferStream>(), {}, {} } });
+    stack.add_surface(mock_surface, default_params.input_mode);
+
+    auto elements = stack.scene_elements_for(compositor_id);
+    ASSERT_THAT(elements.size(), Eq(2u));
+
+    EXPECT_CALL(*mock_surface, configure(mir_window_attrib_visibility, mir_window_visibility_occluded)).Times(0);
+    EXPECT_CALL(*mock_surface, configure(mir_window_attrib_visibility, mir_window_visibility_exposed));
+
+    elements.front()->rendered();
+    elements.back()->occluded();
+    elements.clear();
+}
+
 TEST_F(SurfaceStack, exposes_rendered_surface)
 {
     using namespace testing;
@@ -735,15 +858,17 @@ TEST_F(SurfaceStack, exposes_rendered_surface)
     auto const mock_surface = std::make_shared<MockConfigureSurface>();
         stack.add_surface(mock_surface, default_params.input_mode);
 
-    auto const elements = stack.scene_elements_for(compositor_id);
+    auto elements = stack.scene_elements_for(compositor_id);
     ASSERT_THAT(elements.size(), Eq(1u));
-    auto const elements2 = stack.scene_elements_for(compositor_id2);
+    auto elements2 = stack.scene_elements_for(compositor_id2);
     ASSERT_THAT(elements2.size(), Eq(1u));
 
     EXPECT_CALL(*mock_surface, configure(mir_window_attrib_visibility, mir_window_visibility_exposed));
 
     elements.back()->occluded();
     elements2.back()->rendered();
+    elements.clear();
+    elements2.clear();
 }
 
 TEST_F(SurfaceStack, occludes_surface_when_unregistering_all_compositors_that_rendered_it)
@@ -760,19 +885,23 @@ TEST_F(SurfaceStack, occludes_surface_when_unregistering_all_compositors_that_re
     auto const mock_surface = std::make_shared<MockConfigureSurface>();
     stack.add_surface(mock_surface, default_params.input_mode);
 
-    auto const elements = stack.scene_elements_for(compositor_id);
+    auto elements = stack.scene_elements_for(compositor_id);
     ASSERT_THAT(elements.size(), Eq(1u));
-    auto const elements2 = stack.scene_elements_for(compositor_id2);
+    auto elements2 = stack.scene_elements_for(compositor_id2);
     ASSERT_THAT(elements2.size(), Eq(1u));
-    auto const elements3 = stack.scene_elements_for(compositor_id3);
+    auto elements3 = stack.scene_elements_for(compositor_id3);
     ASSERT_THAT(elements3.size(), Eq(1u));
 
+    // Only the transition to exposed is notified
     EXPECT_CALL(*mock_surface, configure(mir_window_attrib_visibility, mir_window_visibility_exposed))
-        .Times(2);
+        .Times(1);
 
     elements.back()->occluded();
     elements2.back()->rendered();
     elements3.back()->rendered();
+    elements.clear();
+    elements2.clear();
+    elements3.clear();
 
     Mock::VerifyAndClearExpectations(mock_surface.get());
 
@@ -931,6 +1060,31 @@ TEST_F(SurfaceStack, scene_observers_notified_of_generic_scene_change)
     stack.emit_scene_changed();
 }
 
+TEST_F(SurfaceStack, scene_observers_notified_of_scene_damage)
+{
+    MockSceneObserver o1, o2;
+    geom::Rectangle const damage{{1, 2}, {3, 4}};
+
+    EXPECT_CALL(o1, scene_damaged(damage)).Times(1);
+    EXPECT_CALL(o2, scene_damaged(damage)).Times(1);
+    EXPECT_CALL(o1, scene_changed()).Times(0);
+    EXPECT_CALL(o2, scene_changed()).Times(0);
+
+    stack.add_observer(mt::fake_shared(o1));
+    stack.add_observer(mt::fake_shared(o2));
+
+    stack.emit_scene_damaged(damage);
+}
+
+TEST_F(SurfaceStack, scene_damage_does_not_schedule_every_compositor)
+{
+    stack.scene_elements_for(compositor_id);
+
+    stack.emit_scene_damaged({{1, 2}, {3, 4}});
+
+    EXPECT_THAT(stack.frames_pending(compositor_id), testing::Eq(0));
+}
+
 TEST_F(SurfaceStack, for_each_enumerates_all_input_surfaces)
 {
     using namespace ::testing;
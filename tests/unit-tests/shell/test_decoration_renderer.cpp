@@ -0,0 +1,101 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/server/shell/decoration/renderer.h"
+#include "src/server/shell/decoration/window.h"
+#include "src/server/shell/decoration/input.h"
+#include "src/server/scene/basic_surface.h"
+#include "src/server/report/null_report_factory.h"
+
+#include "mir/graphics/buffer.h"
+#include "mir/test/doubles/stub_buffer_allocator.h"
+#include "mir/test/doubles/mock_buffer_stream.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace ms = mir::scene;
+namespace mg = mir::graphics;
+namespace geom = mir::geometry;
+namespace msd = mir::shell::decoration;
+namespace mtd = mir::test::doubles;
+
+using namespace testing;
+
+namespace
+{
+msd::StaticGeometry const static_geometry{
+    geom::Height{24},   // titlebar_height
+    geom::Width{6},     // side_border_width
+    geom::Height{6},    // bottom_border_height
+    geom::Size{16, 16}, // resize_corner_input_size
+    geom::Width{24},    // button_width
+    geom::Width{6},     // padding_between_buttons
+    geom::Height{14},   // title_font_height
+    geom::Point{8, 2},  // title_font_top_left
+    geom::Displacement{5, 5}, // icon_padding
+    geom::Width{1},     // detail_line_width
+};
+
+struct DecorationRenderer : Test
+{
+    std::shared_ptr<msd::StaticGeometry const> const geometry{std::make_shared<msd::StaticGeometry>(static_geometry)};
+    std::shared_ptr<ms::BasicSurface> const surface{std::make_shared<ms::BasicSurface>(
+        nullptr,
+        "window",
+        geom::Rectangle{{}, {240, 120}},
+        mir_pointer_unconfined,
+        std::list<ms::StreamInfo>{{std::make_shared<NiceMock<mtd::MockBufferStream>>(), {0, 0}, {}}},
+        nullptr,
+        mir::report::null_scene_report())};
+    msd::InputState const input_state{{}, {}};
+    msd::Renderer renderer{std::make_shared<mtd::StubBufferAllocator>(), geometry};
+
+    void set_focus(MirWindowFocusState state)
+    {
+        surface->configure(mir_window_attrib_focus, state);
+        renderer.update_state(msd::WindowState{geometry, surface}, input_state);
+    }
+
+    static auto id_of(std::experimental::optional<std::shared_ptr<mg::Buffer>> const& buffer) -> mg::BufferID
+    {
+        EXPECT_TRUE(buffer);
+        return buffer ? buffer.value()->id() : mg::BufferID{};
+    }
+};
+}
+
+TEST_F(DecorationRenderer, rerendered_titlebar_has_a_new_buffer_id_after_the_old_one_is_released)
+{
+    set_focus(mir_window_focus_state_unfocused);
+    auto const first_id = id_of(renderer.render_titlebar());
+
+    set_focus(mir_window_focus_state_focused);
+    auto const second_id = id_of(renderer.render_titlebar());
+
+    EXPECT_THAT(second_id, Ne(first_id));
+}
+
+TEST_F(DecorationRenderer, rerendered_border_has_a_new_buffer_id_after_the_old_one_is_released)
+{
+    set_focus(mir_window_focus_state_unfocused);
+    auto const first_id = id_of(renderer.render_left_border());
+
+    set_focus(mir_window_focus_state_focused);
+    auto const second_id = id_of(renderer.render_left_border());
+
+    EXPECT_THAT(second_id, Ne(first_id));
+}
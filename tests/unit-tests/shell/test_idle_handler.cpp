@@ -0,0 +1,217 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/server/shell/idle_handler.h"
+#include "src/server/scene/basic_idle_hub.h"
+
+#include "mir/shell/display_configuration_controller.h"
+#include "mir/input/seat_observer.h"
+#include "mir/events/event_builders.h"
+#include "mir/observer_registrar.h"
+
+#include "mir/test/doubles/fake_alarm_factory.h"
+#include "mir/test/doubles/mock_input_manager.h"
+#include "mir/test/doubles/stub_display_configuration.h"
+#include "mir/test/doubles/stub_input_scene.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace msh = mir::shell;
+namespace ms = mir::scene;
+namespace mi = mir::input;
+namespace mg = mir::graphics;
+namespace mev = mir::events;
+namespace geom = mir::geometry;
+namespace mtd = mir::test::doubles;
+
+using namespace testing;
+using namespace std::literals::chrono_literals;
+
+namespace
+{
+struct MockInputScene : mtd::StubInputScene
+{
+    MOCK_METHOD1(add_input_visualization, void(std::shared_ptr<mg::Renderable> const&));
+    MOCK_METHOD1(remove_input_visualization, void(std::weak_ptr<mg::Renderable> const&));
+};
+
+struct FakeDisplayConfigurationController : msh::DisplayConfigurationController
+{
+    void set_base_configuration(std::shared_ptr<mg::DisplayConfiguration> const& conf) override
+    {
+        config = conf;
+        ++configurations_set;
+    }
+
+    auto base_configuration() -> std::shared_ptr<mg::DisplayConfiguration> override
+    {
+        return config->clone();
+    }
+
+    auto power_modes() const -> std::vector<MirPowerMode>
+    {
+        std::vector<MirPowerMode> result;
+        config->for_each_output([&](mg::DisplayConfigurationOutput const& output)
+            {
+                result.push_back(output.power_mode);
+            });
+        return result;
+    }
+
+    std::shared_ptr<mg::DisplayConfiguration> config{std::make_shared<mtd::StubDisplayConfig>(
+        std::vector<geom::Rectangle>{{{0, 0}, {640, 480}}, {{640, 0}, {640, 480}}})};
+    int configurations_set{0};
+};
+
+/// Keeps hold of the seat observer, so the test can dispatch events to it
+struct SeatObserverRegistrar : mir::ObserverRegistrar<mi::SeatObserver>
+{
+    void register_interest(std::weak_ptr<mi::SeatObserver> const& observer) override
+    {
+        this->observer = observer.lock();
+    }
+
+    void register_interest(std::weak_ptr<mi::SeatObserver> const& observer, mir::Executor&) override
+    {
+        this->observer = observer.lock();
+    }
+
+    void unregister_interest(mi::SeatObserver const&) override
+    {
+        observer.reset();
+    }
+
+    std::shared_ptr<mi::SeatObserver> observer;
+};
+
+auto const off_timeout = 60s;
+auto const dim_timeout = 50s;
+
+struct IdleHandler : Test
+{
+    mtd::FakeAlarmFactory alarm_factory;
+    std::shared_ptr<ms::BasicIdleHub> const idle_hub{
+        std::make_shared<ms::BasicIdleHub>(alarm_factory.the_clock(), alarm_factory)};
+    std::shared_ptr<MockInputScene> const input_scene{std::make_shared<NiceMock<MockInputScene>>()};
+    std::shared_ptr<FakeDisplayConfigurationController> const display_config_controller{
+        std::make_shared<FakeDisplayConfigurationController>()};
+    std::shared_ptr<mtd::MockInputManager> const input_manager{std::make_shared<NiceMock<mtd::MockInputManager>>()};
+    SeatObserverRegistrar seat_observer_registrar;
+
+    msh::IdleHandler handler{
+        idle_hub,
+        input_scene,
+        display_config_controller,
+        input_manager,
+        seat_observer_registrar,
+        alarm_factory.the_clock(),
+        off_timeout};
+
+    void dispatch_key_event()
+    {
+        ASSERT_THAT(seat_observer_registrar.observer, NotNull());
+
+        auto const now = alarm_factory.the_clock()->now().time_since_epoch();
+        std::shared_ptr<MirEvent const> const event{mev::make_event(
+            MirInputDeviceId{1},
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now),
+            std::vector<uint8_t>{},
+            mir_keyboard_action_down,
+            0,
+            30,
+            mir_input_event_modifier_none)};
+
+        seat_observer_registrar.observer->seat_dispatch_event(event);
+    }
+};
+}
+
+TEST_F(IdleHandler, dims_outputs_before_turning_them_off)
+{
+    EXPECT_CALL(*input_scene, add_input_visualization(_)).Times(0);
+    alarm_factory.advance_by(dim_timeout - 1s);
+    Mock::VerifyAndClearExpectations(input_scene.get());
+
+    EXPECT_CALL(*input_scene, add_input_visualization(_)).Times(1);
+    alarm_factory.advance_by(2s);
+
+    EXPECT_THAT(display_config_controller->power_modes(), Each(Eq(mir_power_mode_on)));
+}
+
+TEST_F(IdleHandler, turns_outputs_off_and_suspends_non_wake_devices_after_timeout)
+{
+    EXPECT_CALL(*input_manager, suspend_non_wake_devices()).Times(0);
+    alarm_factory.advance_by(off_timeout - 1s);
+    EXPECT_THAT(display_config_controller->power_modes(), Each(Eq(mir_power_mode_on)));
+    Mock::VerifyAndClearExpectations(input_manager.get());
+
+    EXPECT_CALL(*input_manager, suspend_non_wake_devices()).Times(1);
+    alarm_factory.advance_by(2s);
+    EXPECT_THAT(display_config_controller->power_modes(), Each(Eq(mir_power_mode_off)));
+}
+
+TEST_F(IdleHandler, input_undims_without_turning_outputs_off)
+{
+    alarm_factory.advance_by(dim_timeout + 1s);
+
+    EXPECT_CALL(*input_scene, remove_input_visualization(_)).Times(1);
+    EXPECT_CALL(*input_manager, suspend_non_wake_devices()).Times(0);
+    dispatch_key_event();
+    alarm_factory.advance_by(off_timeout - dim_timeout);
+
+    EXPECT_THAT(display_config_controller->power_modes(), Each(Eq(mir_power_mode_on)));
+}
+
+TEST_F(IdleHandler, input_resumes_devices_and_turns_outputs_back_on)
+{
+    alarm_factory.advance_by(off_timeout + 1s);
+
+    EXPECT_CALL(*input_manager, resume_non_wake_devices()).Times(1);
+    EXPECT_CALL(*input_scene, remove_input_visualization(_)).Times(1);
+    dispatch_key_event();
+
+    EXPECT_THAT(display_config_controller->power_modes(), Each(Eq(mir_power_mode_on)));
+}
+
+TEST_F(IdleHandler, outputs_are_back_on_as_the_first_input_event_is_dispatched)
+{
+    alarm_factory.advance_by(off_timeout + 1s);
+    auto const configurations_while_off = display_config_controller->configurations_set;
+
+    // No time passes (and no alarm fires) between the event and the outputs turning on
+    dispatch_key_event();
+    EXPECT_THAT(display_config_controller->configurations_set, Eq(configurations_while_off + 1));
+    EXPECT_THAT(display_config_controller->power_modes(), Each(Eq(mir_power_mode_on)));
+
+    // ...and later events don't reconfigure them again
+    dispatch_key_event();
+    EXPECT_THAT(display_config_controller->configurations_set, Eq(configurations_while_off + 1));
+}
+
+TEST_F(IdleHandler, outputs_turned_off_by_the_user_stay_off_on_resume)
+{
+    display_config_controller->config->for_each_output([](mg::UserDisplayConfigurationOutput& output)
+        {
+            if (output.id == mg::DisplayConfigurationOutputId{2})
+                output.power_mode = mir_power_mode_off;
+        });
+
+    alarm_factory.advance_by(off_timeout + 1s);
+    dispatch_key_event();
+
+    EXPECT_THAT(display_config_controller->power_modes(), ElementsAre(mir_power_mode_on, mir_power_mode_off));
+}
@@ -792,6 +792,59 @@ TEST_F(GLibMainLoopTest, dispatches_actions_resumed_externally)
     EXPECT_THAT(actions, ElementsAre(1, 0));
 }
 
+TEST_F(GLibMainLoopTest, resumed_actions_keep_their_order_relative_to_later_actions)
+{
+    using namespace testing;
+
+    std::vector<int> actions;
+    int const owner1{0};
+    int const owner2{0};
+
+    ml.pause_processing_for(&owner1);
+
+    for (int i = 0; i < 3; ++i)
+        ml.enqueue(&owner1, [&,i] { actions.push_back(i); });
+
+    ml.enqueue(
+        &owner2,
+        [&]
+        {
+            actions.push_back(10);
+            ml.resume_processing_for(&owner1);
+            ml.enqueue(&owner1, [&] { actions.push_back(3); ml.stop(); });
+        });
+
+    ml.run();
+
+    EXPECT_THAT(actions, ElementsAre(10, 0, 1, 2, 3));
+}
+
+TEST_F(GLibMainLoopTest, dispatches_large_burst_of_actions_in_order)
+{
+    using namespace testing;
+
+    int const num_actions{10000};
+    std::vector<int> actions;
+    int const owner1{0};
+    int const owner2{0};
+
+    for (int i = 0; i < num_actions; ++i)
+    {
+        ml.enqueue(
+            i % 2 ? &owner1 : &owner2,
+            [&,i]
+            {
+                actions.push_back(i);
+                if (i == num_actions - 1)
+                    ml.stop();
+            });
+    }
+
+    ml.run();
+
+    EXPECT_THAT(actions, ContainerEq(values_from_to(0, num_actions - 1)));
+}
+
 TEST_F(GLibMainLoopTest, propagates_exception_from_server_action)
 {
     // Execute in forked process to work around
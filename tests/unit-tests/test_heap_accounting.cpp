@@ -0,0 +1,80 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/heap_accounting.h"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+namespace mha = mir::heap_accounting;
+
+using namespace testing;
+
+TEST(HeapAccounting, allocations_are_charged_to_the_subsystem_in_scope)
+{
+    mha::Scope const scope{mha::Subsystem::decorations};
+
+    EXPECT_THAT(mha::charge_allocation(0), Eq(mha::Subsystem::decorations));
+    mha::credit_deallocation(mha::Subsystem::decorations, 0);
+}
+
+TEST(HeapAccounting, nested_scope_restores_enclosing_subsystem)
+{
+    mha::Scope const outer{mha::Subsystem::wayland};
+    {
+        mha::Scope const inner{mha::Subsystem::window_management};
+        EXPECT_THAT(mha::charge_allocation(0), Eq(mha::Subsystem::window_management));
+        mha::credit_deallocation(mha::Subsystem::window_management, 0);
+    }
+
+    EXPECT_THAT(mha::charge_allocation(0), Eq(mha::Subsystem::wayland));
+    mha::credit_deallocation(mha::Subsystem::wayland, 0);
+}
+
+TEST(HeapAccounting, scope_only_applies_to_its_own_thread)
+{
+    mha::Scope const scope{mha::Subsystem::compositor};
+
+    std::thread{[]
+        {
+            EXPECT_THAT(mha::charge_allocation(0), Eq(mha::Subsystem::other));
+            mha::credit_deallocation(mha::Subsystem::other, 0);
+        }}.join();
+}
+
+TEST(HeapAccounting, usage_counts_blocks_in_use_and_allocations_since_startup)
+{
+    auto const before = mha::usage_of(mha::Subsystem::xwayland);
+
+    {
+        mha::Scope const scope{mha::Subsystem::xwayland};
+        mha::charge_allocation(100);
+        mha::charge_allocation(28);
+    }
+    mha::credit_deallocation(mha::Subsystem::xwayland, 100);
+
+    auto const after = mha::usage_of(mha::Subsystem::xwayland);
+
+    EXPECT_THAT(after.bytes_in_use - before.bytes_in_use, Eq(28u));
+    EXPECT_THAT(after.blocks_in_use - before.blocks_in_use, Eq(1u));
+    EXPECT_THAT(after.bytes_allocated - before.bytes_allocated, Eq(128u));
+    EXPECT_THAT(after.allocations - before.allocations, Eq(2u));
+    EXPECT_TRUE(mha::enabled());
+
+    mha::credit_deallocation(mha::Subsystem::xwayland, 28);
+}
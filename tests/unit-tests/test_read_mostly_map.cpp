@@ -0,0 +1,150 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/client/read_mostly_map.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace mcl = mir::client;
+using namespace testing;
+using namespace std::chrono_literals;
+
+TEST(ReadMostlyMap, finds_inserted_values)
+{
+    mcl::ReadMostlyMap<int, int> map;
+
+    map.insert(1, 10);
+    map.insert(2, 20);
+
+    EXPECT_THAT(map.find(1), Eq(10));
+    EXPECT_THAT(map.find(2), Eq(20));
+}
+
+TEST(ReadMostlyMap, finds_default_value_for_missing_or_erased_key)
+{
+    mcl::ReadMostlyMap<int, int> map;
+
+    map.insert(1, 10);
+    map.erase(1);
+
+    EXPECT_THAT(map.find(1), Eq(0));
+    EXPECT_THAT(map.find(2), Eq(0));
+}
+
+TEST(ReadMostlyMap, for_each_visits_every_value)
+{
+    mcl::ReadMostlyMap<int, int> map;
+    map.insert(1, 10);
+    map.insert(2, 20);
+    map.insert(3, 30);
+
+    std::vector<int> visited;
+    map.for_each([&](int value) { visited.push_back(value); });
+
+    EXPECT_THAT(visited, UnorderedElementsAre(10, 20, 30));
+}
+
+TEST(ReadMostlyMap, readers_never_see_a_freed_value)
+{
+    mcl::ReadMostlyMap<int, std::shared_ptr<int>> map;
+    map.insert(0, std::make_shared<int>(0));
+    std::atomic<bool> done{false};
+    std::atomic<int> bad_reads{0};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i != 4; ++i)
+    {
+        readers.emplace_back([&]
+            {
+                while (!done)
+                {
+                    auto const value = map.find(0);
+                    if (!value || *value < 0)
+                        ++bad_reads;
+                }
+            });
+    }
+
+    for (int i = 1; i != 10000; ++i)
+        map.insert(0, std::make_shared<int>(i));
+
+    done = true;
+    for (auto& reader : readers)
+        reader.join();
+
+    EXPECT_THAT(bad_reads, Eq(0));
+}
+
+TEST(ReadMostlyMap, change_waits_only_for_readers_of_the_replaced_snapshot)
+{
+    mcl::ReadMostlyMap<int, int> map;
+    map.insert(0, 0);
+
+    std::promise<void> old_reader_entered;
+    std::promise<void> release_old_reader;
+    std::thread old_reader{[&]
+        {
+            auto const release = release_old_reader.get_future();
+            map.for_each([&](int)
+                {
+                    old_reader_entered.set_value();
+                    release.wait();
+                });
+        }};
+    old_reader_entered.get_future().wait();
+
+    auto change = std::async(std::launch::async, [&] { map.insert(1, 1); });
+
+    // Once published the change is held up by old_reader; let it start waiting
+    while (map.find(1) != 1)
+        std::this_thread::yield();
+    std::this_thread::sleep_for(10ms);
+
+    std::promise<void> new_reader_entered;
+    std::promise<void> release_new_reader;
+    std::thread new_reader{[&]
+        {
+            auto const release = release_new_reader.get_future();
+            bool entered{false};
+            map.for_each([&](int)
+                {
+                    if (entered)
+                        return;
+                    entered = true;
+                    new_reader_entered.set_value();
+                    release.wait_for(10s);
+                });
+        }};
+    new_reader_entered.get_future().wait();
+
+    release_old_reader.set_value();
+    auto const change_finished = change.wait_for(5s) == std::future_status::ready;
+
+    release_new_reader.set_value();
+    old_reader.join();
+    new_reader.join();
+    change.get();
+
+    EXPECT_TRUE(change_finished);
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 or 3,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/seqlock.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+
+namespace
+{
+struct Timing
+{
+    std::int64_t period;
+    std::int64_t phase;
+    bool flag;
+};
+}
+
+TEST(SeqLock, loads_initial_value)
+{
+    mir::SeqLock<Timing> const lock{Timing{16, 3, true}};
+
+    auto const loaded = lock.load();
+
+    EXPECT_THAT(loaded.period, Eq(16));
+    EXPECT_THAT(loaded.phase, Eq(3));
+    EXPECT_TRUE(loaded.flag);
+}
+
+TEST(SeqLock, loads_latest_stored_value)
+{
+    mir::SeqLock<Timing> lock;
+
+    lock.store(Timing{16, 3, true});
+    lock.store(Timing{8, 5, false});
+
+    auto const loaded = lock.load();
+
+    EXPECT_THAT(loaded.period, Eq(8));
+    EXPECT_THAT(loaded.phase, Eq(5));
+    EXPECT_FALSE(loaded.flag);
+}
+
+TEST(SeqLock, readers_never_see_a_partial_store)
+{
+    mir::SeqLock<Timing> lock{Timing{0, 0, true}};
+    std::atomic<bool> done{false};
+    std::atomic<int> torn_reads{0};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i != 4; ++i)
+    {
+        readers.emplace_back([&]
+            {
+                while (!done)
+                {
+                    auto const loaded = lock.load();
+                    if (loaded.phase != -loaded.period || loaded.flag != (loaded.period % 2 == 0))
+                        ++torn_reads;
+                }
+            });
+    }
+
+    for (std::int64_t i = 1; i != 100000; ++i)
+        lock.store(Timing{i, -i, i % 2 == 0});
+
+    done = true;
+    for (auto& reader : readers)
+        reader.join();
+
+    EXPECT_THAT(torn_reads, Eq(0));
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/server/frontend_wayland/configure_throttle.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <stdexcept>
+
+namespace mf = mir::frontend;
+
+using namespace testing;
+
+namespace
+{
+struct ConfigureThrottleTest : Test
+{
+    mf::ConfigureThrottle throttle;
+};
+}
+
+TEST_F(ConfigureThrottleTest, acked_configure_is_no_longer_in_flight)
+{
+    throttle.configure_sent(5);
+    EXPECT_TRUE(throttle.configure_in_flight());
+
+    throttle.configure_acked(5);
+    EXPECT_FALSE(throttle.configure_in_flight());
+}
+
+TEST_F(ConfigureThrottleTest, acking_a_configure_acks_those_sent_before_it)
+{
+    throttle.configure_sent(5);
+    throttle.configure_sent(6);
+    throttle.configure_sent(9);
+
+    throttle.configure_acked(9);
+
+    EXPECT_FALSE(throttle.configure_in_flight());
+}
+
+TEST_F(ConfigureThrottleTest, acking_an_earlier_configure_leaves_later_ones_in_flight)
+{
+    throttle.configure_sent(5);
+    throttle.configure_sent(6);
+
+    throttle.configure_acked(5);
+
+    EXPECT_TRUE(throttle.configure_in_flight());
+}
+
+TEST_F(ConfigureThrottleTest, acking_a_serial_that_was_not_sent_throws)
+{
+    throttle.configure_sent(5);
+    throttle.configure_sent(9);
+
+    EXPECT_THROW(throttle.configure_acked(7), std::runtime_error);
+}
+
+TEST_F(ConfigureThrottleTest, acking_a_configure_twice_throws)
+{
+    throttle.configure_sent(5);
+    throttle.configure_acked(5);
+
+    EXPECT_THROW(throttle.configure_acked(5), std::runtime_error);
+}
+
+TEST_F(ConfigureThrottleTest, serials_are_ordered_across_wraparound)
+{
+    throttle.configure_sent(0xfffffffe);
+    EXPECT_NO_THROW(throttle.configure_sent(0xffffffff));
+    EXPECT_NO_THROW(throttle.configure_sent(0));
+    EXPECT_NO_THROW(throttle.configure_sent(1));
+
+    throttle.configure_acked(0);
+    EXPECT_TRUE(throttle.configure_in_flight());
+
+    throttle.configure_acked(1);
+    EXPECT_FALSE(throttle.configure_in_flight());
+}
+
+TEST_F(ConfigureThrottleTest, sending_a_serial_that_does_not_follow_the_last_throws)
+{
+    throttle.configure_sent(0);
+
+    EXPECT_THROW(throttle.configure_sent(0xffffffff), std::runtime_error);
+    EXPECT_THROW(throttle.configure_sent(0), std::runtime_error);
+}
+
+TEST_F(ConfigureThrottleTest, resize_is_not_held_back_when_no_configure_is_in_flight)
+{
+    EXPECT_TRUE(throttle.resize_requested());
+
+    throttle.configure_sent(5);
+    throttle.configure_acked(5);
+
+    EXPECT_TRUE(throttle.resize_requested());
+}
+
+TEST_F(ConfigureThrottleTest, resizes_held_back_while_a_configure_is_in_flight_are_released_once_by_the_ack)
+{
+    throttle.configure_sent(5);
+
+    EXPECT_FALSE(throttle.resize_requested());
+    EXPECT_FALSE(throttle.resize_requested());
+    EXPECT_FALSE(throttle.resize_requested());
+
+    EXPECT_TRUE(throttle.configure_acked(5));
+}
+
+TEST_F(ConfigureThrottleTest, held_back_resize_waits_for_the_last_configure_to_be_acked)
+{
+    throttle.configure_sent(5);
+    EXPECT_FALSE(throttle.resize_requested());
+    throttle.configure_sent(6);
+    EXPECT_FALSE(throttle.resize_requested());
+
+    EXPECT_FALSE(throttle.configure_acked(5));
+    EXPECT_TRUE(throttle.configure_acked(6));
+}
+
+TEST_F(ConfigureThrottleTest, ack_releases_nothing_if_no_resize_was_held_back)
+{
+    throttle.configure_sent(5);
+
+    EXPECT_FALSE(throttle.configure_acked(5));
+}
+
+TEST_F(ConfigureThrottleTest, sending_a_configure_satisfies_a_held_back_resize)
+{
+    throttle.configure_sent(5);
+    EXPECT_FALSE(throttle.resize_requested());
+
+    // e.g. a state change, which carries the latest size
+    throttle.configure_sent(6);
+
+    EXPECT_FALSE(throttle.configure_acked(6));
+}
+
+TEST_F(ConfigureThrottleTest, client_that_acks_without_committing_is_not_held_back)
+{
+    throttle.configure_sent(5);
+    throttle.configure_acked(5);
+
+    EXPECT_TRUE(throttle.resize_requested());
+    throttle.configure_sent(6);
+    throttle.configure_acked(6);
+
+    EXPECT_TRUE(throttle.resize_requested());
+}
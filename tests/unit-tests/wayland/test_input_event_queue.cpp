@@ -0,0 +1,247 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "src/server/frontend_wayland/input_event_queue.h"
+
+#include "mir/events/event_builders.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+namespace mf = mir::frontend;
+namespace mev = mir::events;
+
+using namespace testing;
+using namespace std::literals::chrono_literals;
+
+namespace
+{
+MirInputDeviceId const device{7};
+MirInputDeviceId const touchscreen{8};
+
+auto motion(float x, float y, float vscroll = 0, float relative_x = 0) -> mir::EventUPtr
+{
+    return mev::make_event(
+        device, 0ns, std::vector<uint8_t>{}, mir_input_event_modifier_none, mir_pointer_action_motion,
+        0, x, y, 0, vscroll, relative_x, 0);
+}
+
+auto button_down(float x, float y) -> mir::EventUPtr
+{
+    return mev::make_event(
+        device, 0ns, std::vector<uint8_t>{}, mir_input_event_modifier_none, mir_pointer_action_button_down,
+        mir_pointer_button_primary, x, y, 0, 0, 0, 0);
+}
+
+auto key(MirKeyboardAction action) -> mir::EventUPtr
+{
+    return mev::make_event(device, 0ns, std::vector<uint8_t>{}, action, 0, 30, mir_input_event_modifier_none);
+}
+
+/// A touch event with a point for each id, all with the same action and position
+auto touch(std::vector<MirTouchId> const& ids, MirTouchAction action, float x) -> mir::EventUPtr
+{
+    auto event = mev::make_event(touchscreen, 0ns, std::vector<uint8_t>{}, mir_input_event_modifier_none);
+    for (auto const id : ids)
+        mev::add_touch(*event, id, action, mir_touch_tooltype_finger, x, x, 1, 1, 1, 1);
+    return event;
+}
+
+auto pointer(std::shared_ptr<MirEvent> const& event) -> MirPointerEvent const*
+{
+    return mir_input_event_get_pointer_event(mir_event_get_input_event(event.get()));
+}
+
+auto axis(std::shared_ptr<MirEvent> const& event, MirPointerAxis axis) -> float
+{
+    return mir_pointer_event_axis_value(pointer(event), axis);
+}
+
+auto input_type(std::shared_ptr<MirEvent> const& event) -> MirInputEventType
+{
+    return mir_input_event_get_type(mir_event_get_input_event(event.get()));
+}
+
+auto touch_x(std::shared_ptr<MirEvent> const& event) -> float
+{
+    auto const touch_event = mir_input_event_get_touch_event(mir_event_get_input_event(event.get()));
+    return mir_touch_event_axis_value(touch_event, 0, mir_touch_axis_x);
+}
+
+struct InputEventQueue : Test
+{
+    mf::InputEventQueue queue{4, 6};
+};
+}
+
+TEST_F(InputEventQueue, first_push_asks_for_delivery_and_later_pushes_do_not)
+{
+    EXPECT_TRUE(queue.push(*key(mir_keyboard_action_down)));
+    EXPECT_FALSE(queue.push(*key(mir_keyboard_action_up)));
+
+    queue.take();
+
+    EXPECT_TRUE(queue.push(*key(mir_keyboard_action_down)));
+}
+
+TEST_F(InputEventQueue, consecutive_motion_is_coalesced_to_the_latest_position)
+{
+    queue.push(*motion(1, 1, 1.0f, 2.0f));
+    queue.push(*motion(5, 6, 0.5f, 3.0f));
+
+    auto const events = queue.take();
+
+    ASSERT_THAT(events.size(), Eq(1u));
+    EXPECT_THAT(axis(events[0], mir_pointer_axis_x), Eq(5));
+    EXPECT_THAT(axis(events[0], mir_pointer_axis_y), Eq(6));
+    EXPECT_THAT(axis(events[0], mir_pointer_axis_vscroll), FloatEq(1.5f));
+    EXPECT_THAT(axis(events[0], mir_pointer_axis_relative_x), FloatEq(5.0f));
+}
+
+TEST_F(InputEventQueue, coalesced_motion_keeps_the_sum_of_unaccelerated_motion)
+{
+    auto first = motion(1, 1, 0, 4.0f);
+    mev::set_unaccelerated_motion(*first, 2.0f, 1.0f);
+    auto second = motion(5, 6, 0, 6.0f);
+    mev::set_unaccelerated_motion(*second, 3.0f, -1.5f);
+
+    queue.push(*first);
+    queue.push(*second);
+
+    auto const events = queue.take();
+
+    ASSERT_THAT(events.size(), Eq(1u));
+    EXPECT_THAT(axis(events[0], mir_pointer_axis_relative_x), FloatEq(10.0f));
+    EXPECT_THAT(axis(events[0], mir_pointer_axis_relative_unaccelerated_x), FloatEq(5.0f));
+    EXPECT_THAT(axis(events[0], mir_pointer_axis_relative_unaccelerated_y), FloatEq(-0.5f));
+}
+
+TEST_F(InputEventQueue, key_and_button_transitions_are_kept_in_order)
+{
+    queue.push(*key(mir_keyboard_action_down));
+    queue.push(*key(mir_keyboard_action_up));
+    queue.push(*key(mir_keyboard_action_down));
+
+    auto const events = queue.take();
+
+    ASSERT_THAT(events.size(), Eq(3u));
+    EXPECT_THAT(
+        mir_keyboard_event_action(mir_input_event_get_keyboard_event(mir_event_get_input_event(events[1].get()))),
+        Eq(mir_keyboard_action_up));
+}
+
+TEST_F(InputEventQueue, motion_is_not_coalesced_across_a_button_until_over_capacity)
+{
+    queue.push(*motion(1, 1));
+    queue.push(*button_down(1, 1));
+    queue.push(*motion(2, 2));
+
+    EXPECT_THAT(queue.size(), Eq(3u));
+}
+
+TEST_F(InputEventQueue, over_capacity_motion_is_folded_forward_but_transitions_are_not_lost)
+{
+    queue.push(*motion(1, 1, 1.0f));
+    queue.push(*key(mir_keyboard_action_down));
+    queue.push(*motion(2, 2, 1.0f));
+    queue.push(*key(mir_keyboard_action_up));
+    queue.push(*motion(3, 3, 1.0f));
+
+    auto const events = queue.take();
+
+    ASSERT_THAT(events.size(), Eq(3u));
+    EXPECT_THAT(mir_input_event_get_type(mir_event_get_input_event(events[0].get())), Eq(mir_input_event_type_key));
+    EXPECT_THAT(mir_input_event_get_type(mir_event_get_input_event(events[1].get())), Eq(mir_input_event_type_key));
+    EXPECT_THAT(axis(events[2], mir_pointer_axis_x), Eq(3));
+    EXPECT_THAT(axis(events[2], mir_pointer_axis_vscroll), FloatEq(3.0f));
+}
+
+TEST_F(InputEventQueue, events_stay_queued_until_the_retried_delivery_takes_them)
+{
+    EXPECT_TRUE(queue.push(*key(mir_keyboard_action_down)));
+
+    // The client was backed up, so the scheduled delivery is retried later instead of taking anything
+    EXPECT_FALSE(queue.push(*key(mir_keyboard_action_up)));
+    EXPECT_THAT(queue.size(), Eq(2u));
+
+    EXPECT_THAT(queue.take().size(), Eq(2u));
+    EXPECT_TRUE(queue.push(*key(mir_keyboard_action_down)));
+}
+
+TEST_F(InputEventQueue, touch_motion_is_coalesced_to_the_latest_position_of_each_touch)
+{
+    queue.push(*touch({1, 2}, mir_touch_action_change, 1));
+    queue.push(*touch({1, 2}, mir_touch_action_change, 5));
+
+    auto const events = queue.take();
+
+    ASSERT_THAT(events.size(), Eq(1u));
+    EXPECT_THAT(touch_x(events[0]), Eq(5));
+}
+
+TEST_F(InputEventQueue, touch_motion_is_not_coalesced_into_an_event_missing_one_of_its_touches)
+{
+    queue.push(*touch({1, 2}, mir_touch_action_change, 1));
+    queue.push(*touch({2}, mir_touch_action_change, 5));
+
+    EXPECT_THAT(queue.size(), Eq(2u));
+}
+
+TEST_F(InputEventQueue, touch_transitions_are_not_coalesced)
+{
+    queue.push(*touch({1}, mir_touch_action_down, 1));
+    queue.push(*touch({1}, mir_touch_action_change, 5));
+    queue.push(*touch({1}, mir_touch_action_up, 5));
+
+    EXPECT_THAT(queue.size(), Eq(3u));
+}
+
+TEST_F(InputEventQueue, over_capacity_touch_motion_is_folded_forward)
+{
+    queue.push(*touch({1}, mir_touch_action_change, 1));
+    queue.push(*key(mir_keyboard_action_down));
+    queue.push(*touch({1}, mir_touch_action_change, 2));
+    queue.push(*key(mir_keyboard_action_up));
+    queue.push(*touch({1}, mir_touch_action_change, 3));
+
+    auto const events = queue.take();
+
+    ASSERT_THAT(events.size(), Eq(3u));
+    EXPECT_THAT(input_type(events[0]), Eq(mir_input_event_type_key));
+    EXPECT_THAT(input_type(events[1]), Eq(mir_input_event_type_key));
+    EXPECT_THAT(touch_x(events[2]), Eq(3));
+}
+
+TEST_F(InputEventQueue, at_its_limit_the_oldest_motion_is_dropped_first)
+{
+    queue.push(*motion(1, 1));
+    queue.push(*touch({1}, mir_touch_action_change, 1));
+    for (auto i = 0; i != 5; ++i)
+        queue.push(*key(i % 2 ? mir_keyboard_action_up : mir_keyboard_action_down));
+
+    auto const events = queue.take();
+
+    ASSERT_THAT(events.size(), Eq(6u));
+    EXPECT_THAT(input_type(events[0]), Eq(mir_input_event_type_touch));
+}
+
+TEST_F(InputEventQueue, never_holds_more_than_its_limit)
+{
+    for (auto i = 0; i != 100; ++i)
+        queue.push(*key(i % 2 ? mir_keyboard_action_up : mir_keyboard_action_down));
+
+    EXPECT_THAT(queue.size(), Eq(6u));
+}
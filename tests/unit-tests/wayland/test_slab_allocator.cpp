@@ -0,0 +1,96 @@
+/*
+ * Copyright © 2020 Canonical Ltd.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 or 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mir/wayland/wayland_base.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <set>
+
+namespace mw = mir::wayland;
+
+using namespace testing;
+
+namespace
+{
+struct SlabAllocator : Test
+{
+    std::size_t const blocks_per_slab{4};
+    mw::SlabAllocator slab{blocks_per_slab};
+};
+}
+
+TEST_F(SlabAllocator, freed_blocks_are_reused)
+{
+    auto const first = slab.allocate(24);
+    slab.deallocate(first, 24);
+
+    EXPECT_THAT(slab.allocate(24), Eq(first));
+}
+
+TEST_F(SlabAllocator, blocks_are_distinct_and_aligned)
+{
+    std::set<void*> blocks;
+    for (auto i = 0u; i != 3 * blocks_per_slab; ++i)
+    {
+        auto const block = slab.allocate(40);
+        EXPECT_THAT(reinterpret_cast<std::uintptr_t>(block) % alignof(std::max_align_t), Eq(0u));
+        blocks.insert(block);
+    }
+
+    EXPECT_THAT(blocks.size(), Eq(3 * blocks_per_slab));
+    EXPECT_THAT(slab.slab_count(), Eq(3u));
+
+    for (auto const block : blocks)
+        slab.deallocate(block, 40);
+}
+
+TEST_F(SlabAllocator, churn_does_not_take_more_slabs)
+{
+    for (auto i = 0; i != 1000; ++i)
+    {
+        auto const block = slab.allocate(32);
+        slab.deallocate(block, 32);
+    }
+
+    EXPECT_THAT(slab.slab_count(), Eq(1u));
+    EXPECT_THAT(slab.blocks_in_use(), Eq(0u));
+}
+
+TEST_F(SlabAllocator, different_sizes_do_not_share_blocks)
+{
+    auto const small = slab.allocate(8);
+    slab.deallocate(small, 8);
+
+    auto const large = slab.allocate(256);
+
+    EXPECT_THAT(large, Ne(small));
+    slab.deallocate(large, 256);
+}
+
+TEST_F(SlabAllocator, adapter_works_with_allocate_shared)
+{
+    {
+        auto const value = std::allocate_shared<int>(mw::SlabAllocator::Adapter<int>{slab}, 42);
+
+        EXPECT_THAT(*value, Eq(42));
+        EXPECT_THAT(slab.blocks_in_use(), Eq(1u));
+    }
+
+    EXPECT_THAT(slab.blocks_in_use(), Eq(0u));
+}